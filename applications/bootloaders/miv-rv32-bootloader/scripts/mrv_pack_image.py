@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+#
+# SPDX-License-Identifier: MIT
+#
+# Packs a raw application binary into the image format loaded by the
+# bootloader (src/middleware/boot_image/boot_image.h): a 32 byte header
+# followed by the binary compressed in the LZ4 block format, or stored as is
+# when compression does not make it smaller.
+#
+# Usage:
+#   python3 mrv_pack_image.py <app.bin> <app.img> [--load ADDR] [--entry ADDR]
+#                             [--stored] [--max-size BYTES]
+#
+# The binary is generated from the ELF file of the application with:
+#   riscv64-unknown-elf-objcopy -O binary app.elf app.bin
+#
+# The packed image is decompressed again before being written to check that
+# it round-trips.
+#
+
+import argparse
+import struct
+import sys
+import zlib
+
+BOOT_IMAGE_MAGIC = 0x5A56494D       # "MIVZ"
+BOOT_IMAGE_VERSION = 1
+METHOD_STORED = 0
+METHOD_LZ4 = 1
+
+MIN_MATCH = 4
+MAX_OFFSET = 65535
+# LZ4 block format rules: the last 5 bytes are always literals and the last
+# match starts at least 12 bytes before the end of the block.
+LAST_LITERALS = 5
+MF_LIMIT = 12
+
+
+def write_length(out, length):
+    length -= 15
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def emit_sequence(out, literals, offset, match_length):
+    lit_len = len(literals)
+    token = min(lit_len, 15) << 4
+    if match_length:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+    if lit_len >= 15:
+        write_length(out, lit_len)
+    out += literals
+    if match_length:
+        out += struct.pack("<H", offset)
+        if match_length - MIN_MATCH >= 15:
+            write_length(out, match_length - MIN_MATCH)
+
+
+def lz4_compress(data, depth):
+    size = len(data)
+    out = bytearray()
+    head = {}
+    chain = {}
+    anchor = 0
+    pos = 0
+    match_limit = size - MF_LIMIT
+    end_limit = size - LAST_LITERALS
+
+    def insert(index):
+        key = data[index:index + MIN_MATCH]
+        chain[index] = head.get(key, -1)
+        head[key] = index
+
+    while pos < match_limit:
+        key = data[pos:pos + MIN_MATCH]
+        candidate = head.get(key, -1)
+        best_length = 0
+        best_offset = 0
+        tries = depth
+
+        while candidate >= 0 and pos - candidate <= MAX_OFFSET and tries > 0:
+            length = 0
+            while (pos + length < end_limit and
+                   data[candidate + length] == data[pos + length]):
+                length += 1
+            if length > best_length:
+                best_length = length
+                best_offset = pos - candidate
+            candidate = chain[candidate]
+            tries -= 1
+
+        insert(pos)
+
+        if best_length >= MIN_MATCH:
+            emit_sequence(out, data[anchor:pos], best_offset, best_length)
+            for index in range(pos + 1, min(pos + best_length, match_limit)):
+                insert(index)
+            pos += best_length
+            anchor = pos
+        else:
+            pos += 1
+
+    emit_sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def lz4_decompress(payload, size):
+    out = bytearray()
+    pos = 0
+
+    def read_length(length):
+        nonlocal pos
+        while True:
+            byte = payload[pos]
+            pos += 1
+            length += byte
+            if byte != 255:
+                return length
+
+    while True:
+        token = payload[pos]
+        pos += 1
+        length = token >> 4
+        if length == 15:
+            length = read_length(length)
+        out += payload[pos:pos + length]
+        pos += length
+        if pos == len(payload):
+            break
+        offset = payload[pos] | (payload[pos + 1] << 8)
+        pos += 2
+        length = token & 0x0F
+        if length == 15:
+            length = read_length(length)
+        length += MIN_MATCH
+        if offset == 0 or offset > len(out):
+            raise ValueError("invalid match offset")
+        for _ in range(length):
+            out.append(out[-offset])
+
+    if len(out) != size:
+        raise ValueError("decompressed size mismatch")
+    return bytes(out)
+
+
+def pack(data, load_addr, entry_addr, stored, depth):
+    method = METHOD_STORED
+    payload = data
+
+    if not stored:
+        compressed = lz4_compress(data, depth)
+        if len(compressed) < len(data):
+            if lz4_decompress(compressed, len(data)) != data:
+                sys.exit("error: compressed image does not round-trip")
+            method = METHOD_LZ4
+            payload = compressed
+
+    header = struct.pack("<IBBHIIIII", BOOT_IMAGE_MAGIC, BOOT_IMAGE_VERSION,
+                         method, 0, len(data), len(payload), load_addr,
+                         entry_addr, zlib.crc32(data) & 0xFFFFFFFF)
+    header += struct.pack("<I", zlib.crc32(header) & 0xFFFFFFFF)
+
+    return header + payload, method
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Pack an application binary for the Mi-V bootloader.")
+    parser.add_argument("binary", help="raw application binary")
+    parser.add_argument("image", help="packed image to write")
+    parser.add_argument("--load", type=lambda x: int(x, 0),
+                        default=0x80000000,
+                        help="load address (default 0x80000000)")
+    parser.add_argument("--entry", type=lambda x: int(x, 0), default=None,
+                        help="entry address (default: the load address)")
+    parser.add_argument("--stored", action="store_true",
+                        help="do not compress the binary")
+    parser.add_argument("--depth", type=int, default=64,
+                        help="match search depth, higher compresses better "
+                             "but slower (default 64)")
+    parser.add_argument("--max-size", type=lambda x: int(x, 0), default=None,
+                        help="fail if the packed image is larger, e.g. the "
+                             "32768 byte FLASH_EXECUTABLE_SIZE")
+    args = parser.parse_args()
+
+    with open(args.binary, "rb") as binary:
+        data = binary.read()
+
+    entry = args.load if args.entry is None else args.entry
+    image, method = pack(data, args.load, entry, args.stored, args.depth)
+
+    if args.max_size is not None and len(image) > args.max_size:
+        sys.exit("error: packed image is %d bytes, limit is %d"
+                 % (len(image), args.max_size))
+
+    with open(args.image, "wb") as out:
+        out.write(image)
+
+    print("%s: %d bytes -> %d bytes (%s, %.1f%%), load 0x%08X, entry 0x%08X"
+          % (args.image, len(data), len(image),
+             "lz4" if method == METHOD_LZ4 else "stored",
+             100.0 * len(image) / max(len(data), 1), args.load, entry))
+
+
+if __name__ == "__main__":
+    main()
@@ -11,10 +11,20 @@
  */
 #include <string.h>
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
 #include "drivers/fpga_ip/miv_i2c/miv_i2c.h"
 #include "drivers/off_chip/spi_flash/spi_flash.h"
 #include "ymodem/ymodem.h"
+#include "boot_image/boot_image.h"
+#include "flash_access/flash_access.h"
+
+#ifdef FLASH_SPI_IRQ_HANDLER
+#include "drivers/fpga_ip/CoreSPI/core_spi.h"
+
+extern spi_instance_t g_flash_core_spi;
+#endif
 
 #define FLASH_SECTOR_SIZE               65536   /* flash memory size */
 #define FLASH_SECTORS                   128    // There are 126 sectors of 64KB size, using 124
@@ -22,6 +32,19 @@
 #define FLASH_SEGMENT_SIZE              256    // Write segment size is 256
 
 #define FLASH_BLOCK_SEGMENTS            (FLASH_BLOCK_SIZE / FLASH_SEGMENT_SIZE)
+
+/*
+ * Bytes passed to each spi_flash_write() call when copying the image. With
+ * SPI_FLASH_LEGACY_WRITE, the image is written one segment per call with the
+ * previous write sequence of the driver, to compare the throughput.
+ */
+#ifdef SPI_FLASH_LEGACY_WRITE
+#define FLASH_WRITE_CHUNK               FLASH_SEGMENT_SIZE
+#define FLASH_WRITE_METHOD              " KB/s, legacy page write\r\n"
+#else
+#define FLASH_WRITE_CHUNK               FLASH_BLOCK_SIZE
+#define FLASH_WRITE_METHOD              " KB/s, pipelined page program\r\n"
+#endif
 #define FLASH_BYTE_SIZE                 (FLASH_SECTOR_SIZE * FLASH_SECTORS)
 #define LAST_BLOCK_ADDR                 (FLASH_BYTE_SIZE - FLASH_BLOCK_SIZE)
 
@@ -29,8 +52,14 @@ static int write_program_to_i2ceeprom(uint8_t *write_buf, uint32_t file_size);
 static int write_program_to_flash(uint8_t *write_buf, uint32_t file_size);
 static void copy_hex_to_i2ceeprom(void);
 static void copy_hex_to_spiflash(void);
+static void update_spiflash(void);
 static uint32_t rx_app_file(uint8_t *dest_address);
 static void Bootloader_JumpToApplication(uint32_t reset_vector);
+static void boot_packed_image(uint8_t source);
+static uint32_t nvm_image_size(void);
+static void eeprom_init(void);
+static void print_uint(uint32_t value);
+static void print_rate(uint32_t nb_bytes, uint64_t ticks);
 
 static uint8_t file_name[FILE_NAME_LENGTH + 1]; /* +1 for nul */
 
@@ -62,6 +91,9 @@ Choose the destination Non-Volatile memory: \r\n\
  Type 2 to copy raw binary from LSRAM to MikroBus EEPROM \r\n\
  Type 3 to download a raw binary over UART YMODEM to LSRAM\r\n\
  Type 4 to jump and run loaded application from LSRAM start address\r\n\
+ Type 5 to load a packed image from SPI Flash to LSRAM and run it\r\n\
+ Type 6 to load a packed image from MikroBus EEPROM to LSRAM and run it\r\n\
+ Type 7 to update SPI Flash from LSRAM, rewriting only the blocks that changed\r\n\
  ";
 
 /*
@@ -92,8 +124,6 @@ uint8_t target_slave_addr = 0x50;
 uint8_t i2c_tx_buffer[I2C_XFR_DATA_LEN];
 miv_i2c_instance_t g_miv_i2c_inst;
 
-volatile uint32_t g_10ms_count;
-
 const uint8_t g_greeting_msg_spi[] =
         " ----> SPI Flash is chosen as destination memory \r\n";
 
@@ -113,24 +143,81 @@ const char * g_greeting_msg_i2c =
 #define FLASH_EXECUTABLE_SIZE    32768u
 #define LSRAM_SIZE              131072u
 
-/* MIV I2C interrupt handler */
-void MSYS_EI2_IRQHandler(void)
+/*
+ * Sources of a packed image, see boot_packed_image().
+ */
+#define IMAGE_SOURCE_SPI_FLASH          0u
+#define IMAGE_SOURCE_EEPROM             1u
+
+/*
+ * Largest read issued by the image loader: CoreSPI transfers are limited to
+ * 16 bit sizes and the EEPROM is read one 256 byte page at a time.
+ */
+#define SPI_FLASH_IMAGE_READ_SIZE       4096u
+#define EEPROM_IMAGE_READ_SIZE          256u
+
+/*
+ * Size of the blocks of the SPI flash image read ahead in the background,
+ * see spi_flash_prefetch_read().
+ */
+#define SPI_FLASH_PREFETCH_SIZE         1024u
+
+static const char * const g_boot_image_errors[] =
 {
-    MIV_I2C_isr (&g_miv_i2c_inst);
-}
+    "\r\nPacked image loaded\r\n",
+    "\r\nNo packed image found\r\n",
+    "\r\nInvalid packed image header\r\n",
+    "\r\nRead error while loading the packed image\r\n",
+    "\r\nCorrupt packed image data\r\n",
+    "\r\nPacked image CRC error\r\n"
+};
+
+/*
+ * Time spent reading the SPI flash while loading a packed image and, when the
+ * image is read ahead in the background, time the loader waited for the data.
+ */
+static uint64_t g_flash_read_ticks;
+static uint64_t g_flash_wait_ticks;
 
-void SysTick_Handler(void)
+/*
+ * Read-ahead buffers of the SPI flash image: the loader reads from the current
+ * buffer while the other one is filled by the flash controller interrupt.
+ */
+typedef struct
 {
-    g_10ms_count += 10;
+    uint32_t start;
+    uint32_t length;
+    uint32_t data[SPI_FLASH_PREFETCH_SIZE / 4u];
+} prefetch_buf_t;
+
+static prefetch_buf_t g_prefetch[2];
+static uint8_t g_prefetch_cur;
+static uint8_t g_prefetch_pending;
+static uint32_t g_prefetch_end;
+static uint64_t g_prefetch_started;
+
+#ifdef FLASH_QSPI_IRQ_HANDLER
+/* CoreQSPI interrupt handler, moving the data of the background reads. */
+void FLASH_QSPI_IRQ_HANDLER(void)
+{
+    flash_access_isr();
+}
+#endif
 
-      /*
-       * For neatness, if we roll over, reset cleanly back to 0 so the count
-       * always goes up in proper 10s.
-       */
-     if(g_10ms_count < 10)
-         g_10ms_count = 0;
+#ifdef FLASH_SPI_IRQ_HANDLER
+/* CoreSPI interrupt handler, moving the data of the background reads. */
+void FLASH_SPI_IRQ_HANDLER(void)
+{
+    SPI_isr(&g_flash_core_spi);
+}
+#endif
 
+/* MIV I2C interrupt handler */
+void MSYS_EI2_IRQHandler(void)
+{
+    MIV_I2C_isr (&g_miv_i2c_inst);
 }
+
 /*-------------------------------------------------------------------------*//**
  * main() function.
  */
@@ -184,6 +271,15 @@ int main()
             case '4':
                 Bootloader_JumpToApplication((uint32_t)LSRAM_BASE_ADDRESS_LOAD);
                 break;
+            case '5':
+                boot_packed_image(IMAGE_SOURCE_SPI_FLASH);
+                break;
+            case '6':
+                boot_packed_image(IMAGE_SOURCE_EEPROM);
+                break;
+            case '7':
+                update_spiflash();
+                break;
             default:
                 UART_polled_tx_string( &g_uart, "Invalid selection. Try again...\r\n");
                 break;
@@ -204,9 +300,6 @@ static uint32_t rx_app_file(uint8_t *dest_address)
     uint8_t *g_bin_base = (uint8_t *)dest_address;
     uint32_t g_rx_size = 1024 * 1024 * 8;
 
-    /* Configure systick timer for interrupt at 10msec intervals */
-    MRV_systick_config(SYS_CLK_FREQ/100);
-
     UART_polled_tx_string( &g_uart,
         "\r\n------------------------ Starting YModem file transfer ------------------------\r\n" );
     UART_polled_tx_string( &g_uart,
@@ -232,12 +325,8 @@ static uint32_t rx_app_file(uint8_t *dest_address)
     return received;
 }
 
-void copy_hex_to_i2ceeprom(void)
+static void eeprom_init(void)
 {
-    uint8_t rx_size = 0u;
-    uint8_t rx_data[UART_RX_BUF_SIZE];
-
-    UART_polled_tx_string(&g_uart, g_greeting_msg_i2c);
     MIV_I2C_init(&g_miv_i2c_inst, MIV_I2C_BASE_ADDR);   //For ~100kHz I2C Clock
 
     MIV_I2C_config(&g_miv_i2c_inst, 0x0063);
@@ -257,6 +346,20 @@ void copy_hex_to_i2ceeprom(void)
 #endif
 
     MRV_systick_config(SYS_CLK_FREQ);
+}
+
+void copy_hex_to_i2ceeprom(void)
+{
+    UART_polled_tx_string(&g_uart, g_greeting_msg_i2c);
+
+    if (nvm_image_size() > FLASH_EXECUTABLE_SIZE)
+    {
+        UART_polled_tx_string(&g_uart,
+            "\r\nThe packed image does not fit in the EEPROM\r\n");
+        return;
+    }
+
+    eeprom_init();
 
     /* Copy 32KB from LSRAM which has the size of 128KB */
     write_program_to_i2ceeprom((uint8_t *)LSRAM_BASE_ADDRESS_LOAD, FLASH_EXECUTABLE_SIZE);
@@ -266,8 +369,451 @@ void copy_hex_to_spiflash(void)
 {
     spi_flash_init(FLASH_CORE_SPI_BASE);
 
-    /* Copy 32KB from LSRAM which has the size of 128KB */
-    write_program_to_flash((uint8_t *)LSRAM_BASE_ADDRESS_LOAD, FLASH_EXECUTABLE_SIZE);
+    /*
+     * Copy 32KB from LSRAM which has the size of 128KB, or only the packed
+     * image when the LSRAM holds one.
+     */
+    write_program_to_flash((uint8_t *)LSRAM_BASE_ADDRESS_LOAD, nvm_image_size());
+}
+
+/*
+ * Write the image in the LSRAM to the SPI flash like copy_hex_to_spiflash(),
+ * but only erase and program the 4KB blocks which differ from the image
+ * already in the flash, so that reflashing a slightly modified application
+ * is quick and does not wear the flash.
+ */
+static void update_spiflash(void)
+{
+    flash_content_t flash_content;
+    flash_content_t stored_content;
+    spi_flash_update_report_t report;
+    spi_flash_status_t status;
+    uint32_t file_size;
+    uint64_t start;
+
+    spi_flash_init(FLASH_CORE_SPI_BASE);
+
+    UART_polled_tx_string(&g_uart,
+        "\r\n---------------------- Updating SPI flash from LSRAM ----------------------\r\n");
+
+    file_size = nvm_image_size();
+    start = MRV_time_now();
+
+    /*
+     * Whole blocks are updated: the LSRAM content following the image is
+     * written to the rest of its last block, which it does not use.
+     */
+    status = spi_flash_update(0u, (const uint8_t *)LSRAM_BASE_ADDRESS_LOAD,
+                              (file_size + FLASH_BLOCK_SIZE - 1u) & ~(FLASH_BLOCK_SIZE - 1u),
+                              &report);
+
+    /*
+     * Record the size written, as write_program_to_flash() does, erasing the
+     * last block only when the record changes.
+     */
+    if (SPI_FLASH_SUCCESS == status)
+    {
+        memset(&flash_content, 0, sizeof(flash_content));
+        flash_content.validity_key = SPI_FLASH_VALID_CONTENT_KEY;
+        flash_content.spi_content_byte_size = file_size;
+
+        status = spi_flash_read(LAST_BLOCK_ADDR, (uint8_t *)&stored_content,
+                                sizeof(stored_content));
+        if ((SPI_FLASH_SUCCESS == status) &&
+            (0 != memcmp(&flash_content, &stored_content, sizeof(flash_content))))
+        {
+            status = spi_flash_erase_range(LAST_BLOCK_ADDR, FLASH_BLOCK_SIZE, 0u, NULL);
+            if (SPI_FLASH_SUCCESS == status)
+            {
+                status = spi_flash_write(LAST_BLOCK_ADDR, (uint8_t *)&flash_content,
+                                         sizeof(flash_content));
+            }
+        }
+    }
+
+    if (SPI_FLASH_SUCCESS != status)
+    {
+        UART_polled_tx_string(&g_uart, "Flash update failed\r\n");
+        return;
+    }
+
+    print_uint(report.blocks_updated);
+    UART_polled_tx_string(&g_uart, " blocks rewritten, ");
+    print_uint(report.blocks_unchanged);
+    UART_polled_tx_string(&g_uart, " unchanged blocks skipped in ");
+    print_uint((uint32_t)MRV_time_ticks_to_ms(MRV_time_now() - start));
+    UART_polled_tx_string(&g_uart, " ms\r\n");
+}
+
+/*
+ * Read functions used by the image loader.
+ */
+static int lsram_image_read(void * p_ctx, uint32_t offset, uint8_t * p_buf, uint32_t length)
+{
+    (void)p_ctx;
+    MRV_memcpy(p_buf, (const uint8_t *)LSRAM_BASE_ADDRESS_LOAD + offset, length);
+
+    return 0;
+}
+
+static int spi_flash_image_read(void * p_ctx, uint32_t offset, uint8_t * p_buf, uint32_t length)
+{
+    (void)p_ctx;
+
+    while (length > 0u)
+    {
+        uint32_t count = (length > SPI_FLASH_IMAGE_READ_SIZE) ? SPI_FLASH_IMAGE_READ_SIZE : length;
+        uint64_t start = MRV_time_now();
+
+        if (0 != flash_access_read(offset, p_buf, count))
+        {
+            return -1;
+        }
+        g_flash_read_ticks += MRV_time_now() - start;
+        offset += count;
+        p_buf += count;
+        length -= count;
+    }
+
+    return 0;
+}
+
+/*
+ * Local interrupt of the controller used in the selected read mode, or 0 when
+ * it is not connected and the image cannot be read in the background.
+ */
+static uint32_t flash_read_irq(void)
+{
+    if (FLASH_ACCESS_SPI_READ == flash_access_get_mode())
+    {
+#if defined(FLASH_SPI_IRQn) && defined(FLASH_SPI_IRQ_HANDLER)
+        return FLASH_SPI_IRQn;
+#endif
+    }
+    else
+    {
+#if defined(FLASH_QSPI_IRQn) && defined(FLASH_QSPI_IRQ_HANDLER)
+        return FLASH_QSPI_IRQn;
+#endif
+    }
+
+    return 0u;
+}
+
+static void prefetch_done(void)
+{
+    g_flash_read_ticks += MRV_time_now() - g_prefetch_started;
+}
+
+/*
+ * Start reading the block of the image at start into a read-ahead buffer.
+ * Nothing is read at the end of the image.
+ */
+static int prefetch_start(uint8_t idx, uint32_t start)
+{
+    prefetch_buf_t * p_prefetch = &g_prefetch[idx];
+    uint32_t length;
+
+    if (start >= g_prefetch_end)
+    {
+        return 0;
+    }
+
+    length = g_prefetch_end - start;
+    if (length > SPI_FLASH_PREFETCH_SIZE)
+    {
+        length = SPI_FLASH_PREFETCH_SIZE;
+    }
+
+    p_prefetch->start = start;
+    p_prefetch->length = 0u;
+    g_prefetch_started = MRV_time_now();
+    if (0 != flash_access_read_async(start, (uint8_t *)p_prefetch->data, length, prefetch_done))
+    {
+        return -1;
+    }
+    p_prefetch->length = length;
+    g_prefetch_pending = 1u;
+
+    return 0;
+}
+
+/*
+ * Wait for the background read in progress, if any, and make its buffer the
+ * current one.
+ */
+static void prefetch_wait(void)
+{
+    uint64_t start = MRV_time_now();
+
+    if (0u == g_prefetch_pending)
+    {
+        return;
+    }
+
+    while (0u != flash_access_is_read_busy())
+    {
+        ;
+    }
+    g_flash_wait_ticks += MRV_time_now() - start;
+
+    g_prefetch_pending = 0u;
+    g_prefetch_cur ^= 1u;
+}
+
+/*
+ * Wait for the background read in progress and stop the flash interrupt.
+ */
+static void prefetch_stop(void)
+{
+    prefetch_wait();
+    MRV_disable_local_irq(flash_read_irq());
+}
+
+/*
+ * Prepare the read-ahead of an image whose first end bytes are read.
+ */
+static void prefetch_init(uint32_t end)
+{
+    prefetch_wait();
+    g_prefetch[0].length = 0u;
+    g_prefetch[1].length = 0u;
+    g_prefetch_end = end;
+}
+
+/*
+ * Image read function used when the flash interrupt is connected. The image is
+ * read in blocks of SPI_FLASH_PREFETCH_SIZE bytes: as soon as the loader
+ * starts using a block, the next one is read by the flash controller
+ * interrupt, so the flash transfers overlap the decompression instead of
+ * alternating with it.
+ */
+static int spi_flash_prefetch_read(void * p_ctx, uint32_t offset, uint8_t * p_buf, uint32_t length)
+{
+    (void)p_ctx;
+
+    while (length > 0u)
+    {
+        prefetch_buf_t * p_cur = &g_prefetch[g_prefetch_cur];
+        prefetch_buf_t * p_next = &g_prefetch[g_prefetch_cur ^ 1u];
+
+        if ((offset - p_cur->start) < p_cur->length)
+        {
+            uint32_t count = p_cur->start + p_cur->length - offset;
+
+            if (count > length)
+            {
+                count = length;
+            }
+            MRV_memcpy(p_buf, (const uint8_t *)p_cur->data + (offset - p_cur->start), count);
+            offset += count;
+            p_buf += count;
+            length -= count;
+            continue;
+        }
+
+        /* The loader does not read the block in progress: read its block. */
+        if ((0u == g_prefetch_pending) || ((offset - p_next->start) >= p_next->length))
+        {
+            prefetch_wait();
+            if ((offset >= g_prefetch_end) ||
+                (0 != prefetch_start(g_prefetch_cur ^ 1u, offset)))
+            {
+                return -1;
+            }
+        }
+
+        prefetch_wait();
+
+        p_cur = &g_prefetch[g_prefetch_cur];
+        if (0 != prefetch_start(g_prefetch_cur ^ 1u, p_cur->start + p_cur->length))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int eeprom_image_read(void * p_ctx, uint32_t offset, uint8_t * p_buf, uint32_t length)
+{
+    (void)p_ctx;
+
+    while (length > 0u)
+    {
+        uint32_t count = (length > EEPROM_IMAGE_READ_SIZE) ? EEPROM_IMAGE_READ_SIZE : length;
+        uint8_t mem_addr[2];
+        miv_i2c_status_t status;
+
+        mem_addr[0] = (uint8_t)(offset >> 8);
+        mem_addr[1] = (uint8_t)offset;
+
+        MIV_I2C_write_read(&g_miv_i2c_inst,
+                           target_slave_addr,
+                           mem_addr,
+                           sizeof(mem_addr),
+                           p_buf,
+                           (uint16_t)count,
+                           MIV_I2C_RELEASE_BUS,
+                           MIV_I2C_ACK_POLLING_ENABLE);
+        do {
+            status = g_miv_i2c_inst.master_status;
+        } while (MIV_I2C_IN_PROGRESS == status);
+
+        if (MIV_I2C_SUCCESS != status)
+        {
+            return -1;
+        }
+        offset += count;
+        p_buf += count;
+        length -= count;
+    }
+
+    return 0;
+}
+
+/*
+ * Size of the data to copy from the LSRAM to the non-volatile memory: the
+ * packed image when the LSRAM holds one, FLASH_EXECUTABLE_SIZE otherwise.
+ */
+static uint32_t nvm_image_size(void)
+{
+    boot_image_header_t header;
+
+    if (BOOT_IMAGE_OK == boot_image_read_header(lsram_image_read, NULL, &header))
+    {
+        return BOOT_IMAGE_HEADER_SIZE + header.payload_size;
+    }
+
+    return FLASH_EXECUTABLE_SIZE;
+}
+
+static void print_uint(uint32_t value)
+{
+    uint8_t digits[11];
+    uint32_t idx = sizeof(digits) - 1u;
+
+    digits[idx] = 0u;
+    do {
+        digits[--idx] = (uint8_t)('0' + (value % 10u));
+        value /= 10u;
+    } while (0u != value);
+
+    UART_polled_tx_string(&g_uart, &digits[idx]);
+}
+
+/*
+ * Print a transfer rate in MB/s, with two decimals.
+ */
+static void print_rate(uint32_t nb_bytes, uint64_t ticks)
+{
+    uint32_t centi_mbps = (uint32_t)(((uint64_t)nb_bytes * MRV_TIME_TICKS_PER_SEC * 100u) /
+                                     ((ticks + 1u) * 1048576u));
+
+    print_uint(centi_mbps / 100u);
+    UART_polled_tx_string(&g_uart, (0u == ((centi_mbps % 100u) / 10u)) ? ".0" : ".");
+    print_uint(centi_mbps % 100u);
+}
+
+/*
+ * Load a packed image from the SPI flash or the EEPROM, decompressing it
+ * straight into the LSRAM, and run it.
+ */
+static void boot_packed_image(uint8_t source)
+{
+    boot_image_read_t read;
+    boot_image_header_t header;
+    boot_image_status_t status;
+    uint64_t start;
+
+    if (IMAGE_SOURCE_SPI_FLASH == source)
+    {
+#ifdef FLASH_CORE_QSPI_BASE
+        (void)flash_access_init(FLASH_CORE_QSPI_BASE, FLASH_CORE_SPI_BASE);
+#else
+        (void)flash_access_init(0u, FLASH_CORE_SPI_BASE);
+#endif
+        UART_polled_tx_string(&g_uart, "\r\nReading the SPI flash in ");
+        UART_polled_tx_string(&g_uart,
+                              (const uint8_t *)flash_access_mode_name(flash_access_get_mode()));
+        UART_polled_tx_string(&g_uart, " mode");
+        g_flash_read_ticks = 0u;
+        g_flash_wait_ticks = 0u;
+        read = spi_flash_image_read;
+
+        if (0u != flash_read_irq())
+        {
+            MRV_enable_local_irq(flash_read_irq());
+            HAL_enable_interrupts();
+            prefetch_init(BOOT_IMAGE_HEADER_SIZE);
+            read = spi_flash_prefetch_read;
+        }
+    }
+    else
+    {
+        eeprom_init();
+        read = eeprom_image_read;
+    }
+
+    start = MRV_time_now();
+
+    status = boot_image_read_header(read, NULL, &header);
+    if (BOOT_IMAGE_OK == status)
+    {
+        if ((header.load_addr < LSRAM_BASE_ADDRESS_LOAD) ||
+            (header.image_size > LSRAM_SIZE) ||
+            ((header.load_addr - LSRAM_BASE_ADDRESS_LOAD) > (LSRAM_SIZE - header.image_size)))
+        {
+            if (spi_flash_prefetch_read == read)
+            {
+                prefetch_stop();
+            }
+            UART_polled_tx_string(&g_uart, "\r\nThe packed image does not fit in the LSRAM\r\n");
+            return;
+        }
+
+        if (spi_flash_prefetch_read == read)
+        {
+            prefetch_init(BOOT_IMAGE_HEADER_SIZE + header.payload_size);
+        }
+
+        status = boot_image_load(read, NULL, &header);
+    }
+
+    if (spi_flash_prefetch_read == read)
+    {
+        prefetch_stop();
+    }
+
+    UART_polled_tx_string(&g_uart, g_boot_image_errors[status]);
+    if (BOOT_IMAGE_OK != status)
+    {
+        return;
+    }
+
+    print_uint(header.payload_size);
+    UART_polled_tx_string(&g_uart, " bytes read, ");
+    print_uint(header.image_size);
+    UART_polled_tx_string(&g_uart, " bytes loaded in ");
+    print_uint((uint32_t)MRV_time_ticks_to_ms(MRV_time_now() - start));
+    UART_polled_tx_string(&g_uart, " ms\r\n");
+
+    if (IMAGE_SOURCE_SPI_FLASH == source)
+    {
+        UART_polled_tx_string(&g_uart, "SPI flash read at ");
+        print_rate(header.payload_size + BOOT_IMAGE_HEADER_SIZE, g_flash_read_ticks);
+        UART_polled_tx_string(&g_uart, " MB/s\r\n");
+
+        if (spi_flash_prefetch_read == read)
+        {
+            UART_polled_tx_string(&g_uart, "Read in the background, the loader waited ");
+            print_uint((uint32_t)MRV_time_ticks_to_us(g_flash_wait_ticks));
+            UART_polled_tx_string(&g_uart, " us for the flash\r\n");
+        }
+    }
+
+    HAL_disable_interrupts();
+    Bootloader_JumpToApplication(header.entry_addr);
 }
 
 /*
@@ -477,68 +1023,90 @@ static int write_program_to_flash(uint8_t *write_buf, uint32_t file_size)
     /*--------------------------------------------------------------------------
      * Write something to all 32768 blocks of 256 bytes in the 8MB FLASH.
      */
-    uint32_t nb_blocks_to_write;
-    nb_blocks_to_write = (file_size / FLASH_SEGMENT_SIZE);
+    uint32_t nb_bytes_to_write;
+    uint32_t block_size;
+    uint32_t offset;
+    uint64_t program_ticks = 0u;
+    uint64_t start;
+    spi_flash_erase_report_t erase_report;
 
-    if ((file_size % FLASH_SEGMENT_SIZE) > 0)
+    /* Whole segments are written, the last one may go past the file. */
+    nb_bytes_to_write = ((file_size + FLASH_SEGMENT_SIZE - 1u) / FLASH_SEGMENT_SIZE) *
+                        FLASH_SEGMENT_SIZE;
+
+    /*--------------------------------------------------------------------------
+     * Erase the area first so that we are then free to write anything we want
+     * to it. If we don't do this the write may fail as we can only effectively
+     * turn 1s to 0s when we write. For example if we have an erased location
+     * with 0xFF in it and we write 0xAA to it first and then later on write
+     * 0x55, the resulting value is 0x00...
+     * Whole 64K sectors are erased at once and blocks already blank are left
+     * alone.
+     */
+    start = MRV_time_now();
+    result = spi_flash_erase_range(flash_address, nb_bytes_to_write,
+                                   SPI_FLASH_ERASE_SKIP_BLANK, &erase_report);
+    if( SPI_FLASH_SUCCESS != result )
     {
-        ++nb_blocks_to_write;
+        UART_polled_tx_string( &g_uart, "Flash erase failed\r\n" );
+        return(-1);
     }
 
-    for( count = 0; count != nb_blocks_to_write; ++count )
+    print_uint(erase_report.sectors_erased);
+    UART_polled_tx_string( &g_uart, " sectors and " );
+    print_uint(erase_report.blocks_erased);
+    UART_polled_tx_string( &g_uart, " blocks erased, " );
+    print_uint(erase_report.blocks_skipped);
+    UART_polled_tx_string( &g_uart, " blank blocks skipped in " );
+    print_uint((uint32_t)MRV_time_ticks_to_ms(MRV_time_now() - start));
+    UART_polled_tx_string( &g_uart, " ms\r\n" );
+
+    while( 0u != nb_bytes_to_write )
     {
         /*----------------------------------------------------------------------
-         * Vary the fill for each chunk of 256 bytes
-         */
-        memset( write_buffer, count, FLASH_SEGMENT_SIZE );
-        strcpy( (char *)write_buffer, "Microsemi FLASH test" );
-        /*----------------------------------------------------------------------
-         * at the start of each sector we need to make sure it is unprotected
-         * so we can erase blocks within it. The spi_flash_write() function
-         * unprotects the sector as well but we need to start erasing before the
-         * first write takes place.
+         * Program the whole block in one call so that the pages are pipelined,
+         * then read it back and compare. Placing a breakpoint on the while
+         * statement below will allow you break on any failures.
          */
-        if(0 == (flash_address % FLASH_SECTOR_SIZE))
-        {
-            result = spi_flash_control_hw(SPI_FLASH_SECTOR_UNPROTECT,
-                                          flash_address,
-                                          NULL);
-        }
-        /*----------------------------------------------------------------------
-         * At the start of each 4K block we issue an erase so that we are then
-         * free to write anything we want to the block. If we don't do this the
-         * write may fail as we can only effectively turn 1s to 0s when we
-         * write. For example if we have an erased location with 0xFF in it and
-         * we write 0xAA to it first and then later on write 0x55, the resulting
-         * value is 0x00...
-         */
-        if(0 == (flash_address % FLASH_BLOCK_SIZE))
+        block_size = (nb_bytes_to_write < FLASH_BLOCK_SIZE) ? nb_bytes_to_write : FLASH_BLOCK_SIZE;
+
+        start = MRV_time_now();
+        for( offset = 0u; offset < block_size; offset += FLASH_WRITE_CHUNK )
         {
-            result = spi_flash_control_hw(SPI_FLASH_4KBLOCK_ERASE,
-                                          flash_address,
-                                          NULL);
+            spi_flash_write( flash_address + offset, &write_buf[offset],
+                             ((block_size - offset) < FLASH_WRITE_CHUNK) ?
+                             (block_size - offset) : FLASH_WRITE_CHUNK );
         }
-        /*----------------------------------------------------------------------
-         * Write our values to the FLASH, read them back and compare.
-         * Placing a breakpoint on the while statement below will allow
-         * you break on any failures.
-         */
-        spi_flash_write( flash_address, write_buf, FLASH_SEGMENT_SIZE );
+        program_ticks += MRV_time_now() - start;
 
-        spi_flash_read ( flash_address, read_buffer, FLASH_SEGMENT_SIZE );
-        if( memcmp( write_buf, read_buffer, FLASH_SEGMENT_SIZE ) )
+        for( offset = 0u; offset < block_size; offset += FLASH_SEGMENT_SIZE )
         {
-            while(1) // Breakpoint here will trap write faults
+            spi_flash_read ( flash_address + offset, read_buffer, FLASH_SEGMENT_SIZE );
+            if( memcmp( &write_buf[offset], read_buffer, FLASH_SEGMENT_SIZE ) )
             {
+                while(1) // Breakpoint here will trap write faults
+                {
 
-            }
+                }
 
+            }
         }
-        write_buf += FLASH_SEGMENT_SIZE;
-        flash_address += FLASH_SEGMENT_SIZE; /* Step to the next 256 byte chunk */
-        //show_progress();
+        write_buf += block_size;
+        flash_address += block_size; /* Step to the next 4K block */
+        nb_bytes_to_write -= block_size;
     }
 
+    /*--------------------------------------------------------------------------
+     * Report the programming throughput, erase and verification excluded.
+     */
+    print_uint(file_size);
+    UART_polled_tx_string( &g_uart, " bytes programmed in " );
+    print_uint((uint32_t)MRV_time_ticks_to_ms(program_ticks));
+    UART_polled_tx_string( &g_uart, " ms, " );
+    print_uint((uint32_t)(((uint64_t)file_size * MRV_TIME_TICKS_PER_SEC) /
+                          ((program_ticks + 1u) * 1024u)));
+    UART_polled_tx_string( &g_uart, FLASH_WRITE_METHOD );
+
     /*--------------------------------------------------------------------------
      * Record the size written in the first SPI flash segment.
      */
@@ -67,6 +67,10 @@
 #define CORETIMER1_BASE_ADDR                    0x74000000UL
 #define COREGPIO_OUT_BASE_ADDR                  0x75000000UL
 #define FLASH_CORE_SPI_BASE                     0x76000000UL
+/*
+ * Define FLASH_CORE_QSPI_BASE with the base address of the CoreQSPI instance
+ * when the design also connects the SPI flash to CoreQSPI.
+ */
 #define MIV_I2C_BASE_ADDR                       0x7A000000UL
 
 /***************************************************************************//**
@@ -105,6 +109,18 @@ e.g
  number mapping is necessary on MIV_RV32 core.
  */
 
+/*
+ * When the interrupt of the controller reading the SPI flash is connected to
+ * a MIV_RV32 system interrupt, define its local interrupt mask and handler so
+ * that packed images are read in the background while being decompressed,
+ * e.g. for CoreSPI on MSYS_EI3:
+ *
+ * #define FLASH_SPI_IRQn                  MRV32_MSYS_EIE3_IRQn
+ * #define FLASH_SPI_IRQ_HANDLER           MSYS_EI3_IRQHandler
+ *
+ * and likewise FLASH_QSPI_IRQn and FLASH_QSPI_IRQ_HANDLER for CoreQSPI.
+ */
+
 /****************************************************************************
  * Baud value to achieve a 115200 baud rate with system clock defined by
  * SYS_CLK_FREQ.
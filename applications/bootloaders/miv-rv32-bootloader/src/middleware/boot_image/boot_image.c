@@ -0,0 +1,427 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file boot_image.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Packed application image format and streaming image loader. See file
+ * "boot_image.h" for description of the functions implemented in this file.
+ *
+ */
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "boot_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * LZ4 block format constants.
+ */
+#define LZ4_MIN_MATCH                   4u
+#define LZ4_LENGTH_EXTENDED             15u
+
+/*------------------------------------------------------------------------------
+ * Payload input stream. offset is the position in the packed image of the
+ * next read and end the position of the end of the payload.
+ */
+typedef struct
+{
+    boot_image_read_t read;
+    void * p_ctx;
+    uint32_t offset;
+    uint32_t end;
+    uint32_t pos;
+    uint32_t fill;
+    uint8_t buf[BOOT_IMAGE_READ_CHUNK];
+} stream_t;
+
+/*------------------------------------------------------------------------------
+ * CRC-32 table for 4 bits at a time: small enough for the boot code and fast
+ * enough to check the image in a fraction of its load time.
+ */
+static const uint32_t g_crc32_table[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+static uint32_t get_le32(const uint8_t * p_buf)
+{
+    return (uint32_t)p_buf[0] |
+           ((uint32_t)p_buf[1] << 8) |
+           ((uint32_t)p_buf[2] << 16) |
+           ((uint32_t)p_buf[3] << 24);
+}
+
+/*------------------------------------------------------------------------------
+ * Stream functions.
+ */
+static boot_image_status_t
+stream_refill
+(
+    stream_t * p_stream
+)
+{
+    uint32_t length = p_stream->end - p_stream->offset;
+
+    if (0u == length)
+    {
+        /* The compressed data refers past the end of the payload. */
+        return BOOT_IMAGE_CORRUPT;
+    }
+    if (length > BOOT_IMAGE_READ_CHUNK)
+    {
+        length = BOOT_IMAGE_READ_CHUNK;
+    }
+
+    if (0 != p_stream->read(p_stream->p_ctx, p_stream->offset,
+                            p_stream->buf, length))
+    {
+        return BOOT_IMAGE_READ_ERROR;
+    }
+
+    p_stream->offset += length;
+    p_stream->pos = 0u;
+    p_stream->fill = length;
+
+    return BOOT_IMAGE_OK;
+}
+
+static uint8_t stream_at_end(const stream_t * p_stream)
+{
+    return (p_stream->pos == p_stream->fill) &&
+           (p_stream->offset == p_stream->end);
+}
+
+static boot_image_status_t
+stream_get_byte
+(
+    stream_t * p_stream,
+    uint8_t * p_byte
+)
+{
+    if (p_stream->pos == p_stream->fill)
+    {
+        boot_image_status_t status = stream_refill(p_stream);
+
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+    }
+
+    *p_byte = p_stream->buf[p_stream->pos++];
+
+    return BOOT_IMAGE_OK;
+}
+
+/*
+ * Copy length bytes of the stream to p_dest. Large runs, such as a stored
+ * payload, are read directly to the destination once the buffer is empty.
+ */
+static boot_image_status_t
+stream_copy
+(
+    stream_t * p_stream,
+    uint8_t * p_dest,
+    uint32_t length
+)
+{
+    while (length > 0u)
+    {
+        uint32_t count = p_stream->fill - p_stream->pos;
+
+        if (0u == count)
+        {
+            boot_image_status_t status;
+
+            if (length >= BOOT_IMAGE_READ_CHUNK)
+            {
+                if (length > (p_stream->end - p_stream->offset))
+                {
+                    return BOOT_IMAGE_CORRUPT;
+                }
+                if (0 != p_stream->read(p_stream->p_ctx, p_stream->offset,
+                                        p_dest, length))
+                {
+                    return BOOT_IMAGE_READ_ERROR;
+                }
+                p_stream->offset += length;
+                return BOOT_IMAGE_OK;
+            }
+
+            status = stream_refill(p_stream);
+            if (BOOT_IMAGE_OK != status)
+            {
+                return status;
+            }
+            count = p_stream->fill;
+        }
+
+        if (count > length)
+        {
+            count = length;
+        }
+
+        (void)MRV_memcpy(p_dest, &p_stream->buf[p_stream->pos], count);
+        p_stream->pos += count;
+        p_dest += count;
+        length -= count;
+    }
+
+    return BOOT_IMAGE_OK;
+}
+
+/*
+ * Read the extension bytes of an LZ4 literal or match length.
+ */
+static boot_image_status_t
+lz4_read_length
+(
+    stream_t * p_stream,
+    uint32_t * p_length
+)
+{
+    uint8_t byte;
+
+    do {
+        boot_image_status_t status = stream_get_byte(p_stream, &byte);
+
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+        *p_length += byte;
+    } while (255u == byte);
+
+    return BOOT_IMAGE_OK;
+}
+
+/*------------------------------------------------------------------------------
+ * Decode an LZ4 block. Each sequence is a token holding the literal and match
+ * lengths, the literals, a 16 bit match offset and the match length
+ * extension. The last sequence of the block holds literals only.
+ */
+static boot_image_status_t
+lz4_decode
+(
+    stream_t * p_stream,
+    uint8_t * p_dest,
+    uint32_t size
+)
+{
+    uint32_t out = 0u;
+
+    for (;;)
+    {
+        boot_image_status_t status;
+        uint32_t length;
+        uint32_t offset;
+        uint8_t token;
+        uint8_t byte;
+
+        status = stream_get_byte(p_stream, &token);
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+
+        /* Literals */
+        length = (uint32_t)token >> 4;
+        if (LZ4_LENGTH_EXTENDED == length)
+        {
+            status = lz4_read_length(p_stream, &length);
+            if (BOOT_IMAGE_OK != status)
+            {
+                return status;
+            }
+        }
+        if (length > (size - out))
+        {
+            return BOOT_IMAGE_CORRUPT;
+        }
+
+        status = stream_copy(p_stream, &p_dest[out], length);
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+        out += length;
+
+        if (stream_at_end(p_stream))
+        {
+            break;
+        }
+
+        /* Match */
+        status = stream_get_byte(p_stream, &byte);
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+        offset = byte;
+        status = stream_get_byte(p_stream, &byte);
+        if (BOOT_IMAGE_OK != status)
+        {
+            return status;
+        }
+        offset |= (uint32_t)byte << 8;
+
+        length = (uint32_t)token & 0x0Fu;
+        if (LZ4_LENGTH_EXTENDED == length)
+        {
+            status = lz4_read_length(p_stream, &length);
+            if (BOOT_IMAGE_OK != status)
+            {
+                return status;
+            }
+        }
+        length += LZ4_MIN_MATCH;
+
+        if ((0u == offset) || (offset > out) || (length > (size - out)))
+        {
+            return BOOT_IMAGE_CORRUPT;
+        }
+
+        if (offset >= length)
+        {
+            (void)MRV_memcpy(&p_dest[out], &p_dest[out - offset], length);
+            out += length;
+        }
+        else
+        {
+            /* Overlapping match: repeats the last offset bytes. */
+            const uint8_t * p_src = &p_dest[out - offset];
+            uint8_t * p_out = &p_dest[out];
+
+            out += length;
+            while (length > 0u)
+            {
+                *p_out++ = *p_src++;
+                length--;
+            }
+        }
+    }
+
+    return (out == size) ? BOOT_IMAGE_OK : BOOT_IMAGE_CORRUPT;
+}
+
+/***************************************************************************//**
+ * boot_image_crc32()
+ * See "boot_image.h" for details of how to use this function.
+ */
+uint32_t boot_image_crc32(uint32_t crc, const uint8_t * p_buf, uint32_t length)
+{
+    crc = ~crc;
+    while (length > 0u)
+    {
+        crc ^= *p_buf++;
+        crc = (crc >> 4) ^ g_crc32_table[crc & 0x0Fu];
+        crc = (crc >> 4) ^ g_crc32_table[crc & 0x0Fu];
+        length--;
+    }
+
+    return ~crc;
+}
+
+/***************************************************************************//**
+ * boot_image_read_header()
+ * See "boot_image.h" for details of how to use this function.
+ */
+boot_image_status_t
+boot_image_read_header
+(
+    boot_image_read_t read,
+    void * p_ctx,
+    boot_image_header_t * p_header
+)
+{
+    uint8_t raw[BOOT_IMAGE_HEADER_SIZE];
+
+    if (0 != read(p_ctx, 0u, raw, sizeof(raw)))
+    {
+        return BOOT_IMAGE_READ_ERROR;
+    }
+
+    p_header->magic = get_le32(&raw[0]);
+    p_header->version = raw[4];
+    p_header->method = raw[5];
+    p_header->reserved = (uint16_t)(raw[6] | ((uint16_t)raw[7] << 8));
+    p_header->image_size = get_le32(&raw[8]);
+    p_header->payload_size = get_le32(&raw[12]);
+    p_header->load_addr = get_le32(&raw[16]);
+    p_header->entry_addr = get_le32(&raw[20]);
+    p_header->image_crc = get_le32(&raw[24]);
+    p_header->header_crc = get_le32(&raw[28]);
+
+    if (BOOT_IMAGE_MAGIC != p_header->magic)
+    {
+        return BOOT_IMAGE_NOT_FOUND;
+    }
+
+    if ((boot_image_crc32(0u, raw, BOOT_IMAGE_HEADER_SIZE - 4u) !=
+         p_header->header_crc) ||
+        (BOOT_IMAGE_VERSION != p_header->version) ||
+        (p_header->method > BOOT_IMAGE_METHOD_LZ4) ||
+        ((BOOT_IMAGE_METHOD_STORED == p_header->method) &&
+         (p_header->payload_size != p_header->image_size)))
+    {
+        return BOOT_IMAGE_BAD_HEADER;
+    }
+
+    return BOOT_IMAGE_OK;
+}
+
+/***************************************************************************//**
+ * boot_image_load()
+ * See "boot_image.h" for details of how to use this function.
+ */
+boot_image_status_t
+boot_image_load
+(
+    boot_image_read_t read,
+    void * p_ctx,
+    const boot_image_header_t * p_header
+)
+{
+    uint8_t * p_dest = (uint8_t *)(uintptr_t)p_header->load_addr;
+    boot_image_status_t status;
+    stream_t stream;
+
+    stream.read = read;
+    stream.p_ctx = p_ctx;
+    stream.offset = BOOT_IMAGE_HEADER_SIZE;
+    stream.end = BOOT_IMAGE_HEADER_SIZE + p_header->payload_size;
+    stream.pos = 0u;
+    stream.fill = 0u;
+
+    if (BOOT_IMAGE_METHOD_LZ4 == p_header->method)
+    {
+        status = lz4_decode(&stream, p_dest, p_header->image_size);
+    }
+    else
+    {
+        status = stream_copy(&stream, p_dest, p_header->image_size);
+    }
+
+    if (BOOT_IMAGE_OK != status)
+    {
+        return status;
+    }
+
+    if (boot_image_crc32(0u, p_dest, p_header->image_size) !=
+        p_header->image_crc)
+    {
+        return BOOT_IMAGE_CRC_ERROR;
+    }
+
+    return BOOT_IMAGE_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file boot_image.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Packed application image format and streaming image loader.
+ *
+ */
+
+/*=========================================================================*//**
+  Boot Image Loader
+  =======================================
+  A packed image is an application binary prefixed by a 32 byte header. The
+  payload following the header is either the binary itself, or the binary
+  compressed in the LZ4 block format. Code and initialized data usually
+  compress to 50-70% of their size, so a packed image takes less space in the
+  SPI flash or I2C EEPROM and less time to read back over SPI or I2C.
+
+  Packed images are created on the host with scripts/mrv_pack_image.py:
+
+      python3 scripts/mrv_pack_image.py app.bin app.img --load 0x80000000
+
+  boot_image_load() reads the payload through a read function supplied by the
+  caller, for example wrapping spi_flash_read(), and decompresses it straight
+  into its load address: no intermediate buffer is needed other than a small
+  input buffer, since LZ4 back-references are read from the data already
+  written to the destination memory. The CRC-32 of the decompressed image is
+  then checked against the header.
+
+  --------------------------------
+  Header layout
+  --------------------------------
+  All fields are little endian.
+
+  | Offset | Field          | Description                                  |
+  |--------|----------------|----------------------------------------------|
+  | 0      | magic          | BOOT_IMAGE_MAGIC, "MIVZ"                     |
+  | 4      | version        | BOOT_IMAGE_VERSION                           |
+  | 5      | method         | BOOT_IMAGE_METHOD_STORED or _LZ4             |
+  | 6      | reserved       | 0                                            |
+  | 8      | image_size     | Size of the decompressed image in bytes      |
+  | 12     | payload_size   | Size of the payload following the header     |
+  | 16     | load_addr      | Address the image is decompressed to         |
+  | 20     | entry_addr     | Address execution starts from                |
+  | 24     | image_crc      | CRC-32 of the decompressed image             |
+  | 28     | header_crc     | CRC-32 of the 28 bytes above                 |
+
+  The CRC-32 is the one used by zlib and Ethernet (reflected polynomial
+  0xEDB88320).
+
+ *//*=========================================================================*/
+#ifndef BOOT_IMAGE_H
+#define BOOT_IMAGE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_IMAGE_MAGIC                0x5A56494Du     /* "MIVZ" */
+#define BOOT_IMAGE_VERSION              1u
+#define BOOT_IMAGE_HEADER_SIZE          32u
+
+#define BOOT_IMAGE_METHOD_STORED        0u
+#define BOOT_IMAGE_METHOD_LZ4           1u
+
+/*
+ * Size of the buffer used to read the payload, in bytes. One SPI flash
+ * segment by default.
+ */
+#ifndef BOOT_IMAGE_READ_CHUNK
+#define BOOT_IMAGE_READ_CHUNK           256u
+#endif
+
+typedef struct
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t method;
+    uint16_t reserved;
+    uint32_t image_size;
+    uint32_t payload_size;
+    uint32_t load_addr;
+    uint32_t entry_addr;
+    uint32_t image_crc;
+    uint32_t header_crc;
+} boot_image_header_t;
+
+typedef enum
+{
+    BOOT_IMAGE_OK = 0,
+    BOOT_IMAGE_NOT_FOUND,           /* no magic number: not a packed image */
+    BOOT_IMAGE_BAD_HEADER,          /* header CRC or version mismatch */
+    BOOT_IMAGE_READ_ERROR,          /* the read function failed */
+    BOOT_IMAGE_CORRUPT,             /* invalid compressed data */
+    BOOT_IMAGE_CRC_ERROR            /* decompressed image CRC mismatch */
+} boot_image_status_t;
+
+/*
+ * Function reading length bytes at offset from the start of the packed image.
+ * Returns 0 on success.
+ */
+typedef int (*boot_image_read_t)(void * p_ctx,
+                                 uint32_t offset,
+                                 uint8_t * p_buf,
+                                 uint32_t length);
+
+/***************************************************************************//**
+  The boot_image_read_header() function reads and checks the header of a
+  packed image.
+
+  @param read
+  Function reading the packed image.
+
+  @param p_ctx
+  Value passed to the read function.
+
+  @param p_header
+  Pointer to the structure receiving the header.
+
+  @return
+  BOOT_IMAGE_OK when a valid header was read, BOOT_IMAGE_NOT_FOUND when the
+  magic number is absent, BOOT_IMAGE_BAD_HEADER or BOOT_IMAGE_READ_ERROR.
+ */
+boot_image_status_t
+boot_image_read_header
+(
+    boot_image_read_t read,
+    void * p_ctx,
+    boot_image_header_t * p_header
+);
+
+/***************************************************************************//**
+  The boot_image_load() function reads the payload of a packed image and
+  writes the decompressed image to its load address, then checks its CRC-32.
+
+  @param read
+  Function reading the packed image.
+
+  @param p_ctx
+  Value passed to the read function.
+
+  @param p_header
+  Header returned by boot_image_read_header().
+
+  @return
+  BOOT_IMAGE_OK when the image was loaded and its CRC-32 matches,
+  BOOT_IMAGE_READ_ERROR, BOOT_IMAGE_CORRUPT or BOOT_IMAGE_CRC_ERROR otherwise.
+ */
+boot_image_status_t
+boot_image_load
+(
+    boot_image_read_t read,
+    void * p_ctx,
+    const boot_image_header_t * p_header
+);
+
+/***************************************************************************//**
+  The boot_image_crc32() function updates a CRC-32 with a buffer. Start with
+  a crc of 0.
+ */
+uint32_t boot_image_crc32(uint32_t crc, const uint8_t * p_buf, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* BOOT_IMAGE_H */
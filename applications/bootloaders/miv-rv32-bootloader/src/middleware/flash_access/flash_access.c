@@ -0,0 +1,532 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_access.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief SPI flash read layer selecting the fastest read mode supported by the
+ * device and the design. See file "flash_access.h" for description of the
+ * functions implemented in this file.
+ *
+ */
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "drivers/fpga_ip/CoreQSPI/core_qspi.h"
+#include "drivers/off_chip/spi_flash/spi_flash.h"
+#include "flash_access.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Flash commands.
+ */
+#define CMD_READ_ARRAY                  0x03u
+#define CMD_FAST_READ                   0x0Bu
+#define CMD_READ_SFDP                   0x5Au
+#define CMD_READ_JEDEC_ID               0x9Fu
+
+#define FAST_READ_DUMMY_CLOCKS          8u
+#define SFDP_DUMMY_CLOCKS               8u
+#define NB_ADDRESS_BYTES                3u
+
+/*
+ * Mode byte sent after the address of the reads with mode clocks. 0xFF does
+ * not enable the continuous read mode of any known device.
+ */
+#define MODE_BYTE                       0xFFu
+
+/*------------------------------------------------------------------------------
+ * SFDP header and Basic Flash Parameter Table (BFPT) fields, see JESD216.
+ */
+#define SFDP_SIGNATURE                  0x50444653u     /* "SFDP" */
+#define SFDP_HEADERS_SIZE               16u
+#define SFDP_BFPT_ID                    0x00u
+#define SFDP_BFPT_MAX_DWORDS            16u
+
+#define BFPT_DWORD1                     0u
+#define BFPT_DWORD3                     2u
+#define BFPT_DWORD4                     3u
+#define BFPT_DWORD15                    14u
+
+#define BFPT_SUPPORTS_1_1_2             (1u << 16)
+#define BFPT_SUPPORTS_1_2_2             (1u << 20)
+#define BFPT_SUPPORTS_1_4_4             (1u << 21)
+#define BFPT_SUPPORTS_1_1_4             (1u << 22)
+
+#define BFPT_QER_SHIFT                  20u
+#define BFPT_QER_MASK                   0x7u
+
+/*
+ * Number of bytes compared to validate a read mode, and maximum number of
+ * read modes tried.
+ */
+#define VERIFY_SIZE                     64u
+#define MAX_READ_MODES                  5u
+
+#define MAX_IDLE_CYCLES                 15u
+
+/*------------------------------------------------------------------------------
+ * Read command of a CoreQSPI read mode. When mode_byte is set, a mode byte is
+ * sent on the address lanes after the address, followed by idle_cycles dummy
+ * clocks.
+ */
+typedef struct
+{
+    flash_access_mode_t mode;
+    qspi_io_format io_format;
+    uint8_t opcode;
+    uint8_t mode_byte;
+    uint8_t idle_cycles;
+} read_cmd_t;
+
+static qspi_instance_t g_qspi;
+static read_cmd_t g_read_cmd;
+static flash_access_mode_t g_mode = FLASH_ACCESS_SPI_READ;
+
+static uint32_t g_bounce[FLASH_ACCESS_BOUNCE_SIZE / 4u];
+
+/*
+ * Command and completion handler of the read in progress with
+ * flash_access_read_async().
+ */
+static uint8_t g_async_cmd[8];
+static flash_access_read_handler_t g_async_handler;
+
+static const char * const g_mode_names[] =
+{
+    "SPI 1-1-1",
+    "QSPI 1-1-1",
+    "QSPI 1-1-2",
+    "QSPI 1-2-2",
+    "QSPI 1-1-4",
+    "QSPI 1-4-4"
+};
+
+/*------------------------------------------------------------------------------
+ * Set the transfer format of the CoreQSPI instance.
+ */
+static void configure_qspi(qspi_io_format io_format)
+{
+    qspi_config_t config;
+
+    config.xip = 0u;
+    config.xip_addr = 0u;
+    config.spi_mode = QSPI_MODE3;
+    config.clk_div = (qspi_clk_div)FLASH_ACCESS_QSPI_CLK_DIV;
+    config.io_format = io_format;
+    config.sample = QSPI_SAMPLE_POSAGE_SPICLK;
+
+    QSPI_configure(&g_qspi, &config);
+}
+
+/*------------------------------------------------------------------------------
+ * Write the command, address and mode bytes of a read to p_bytes, in the order
+ * they are sent, returning the number of bytes following the command.
+ */
+static uint8_t
+build_read_cmd
+(
+    const read_cmd_t * p_cmd,
+    uint32_t address,
+    uint8_t * p_bytes
+)
+{
+    uint8_t nb_addr_bytes = NB_ADDRESS_BYTES;
+
+    p_bytes[0] = p_cmd->opcode;
+    p_bytes[1] = (uint8_t)(address >> 16);
+    p_bytes[2] = (uint8_t)(address >> 8);
+    p_bytes[3] = (uint8_t)address;
+
+    if (0u != p_cmd->mode_byte)
+    {
+        p_bytes[4] = MODE_BYTE;
+        nb_addr_bytes++;
+    }
+
+    return nb_addr_bytes;
+}
+
+/*------------------------------------------------------------------------------
+ * Read the flash through CoreQSPI with a read command. p_buf must be word
+ * aligned. The command, address and mode bytes are sent from a word aligned
+ * buffer.
+ */
+static void
+qspi_read
+(
+    const read_cmd_t * p_cmd,
+    uint32_t address,
+    void * p_buf,
+    uint32_t length
+)
+{
+    uint32_t cmd_words[2];
+    uint8_t nb_addr_bytes;
+
+    nb_addr_bytes = build_read_cmd(p_cmd, address, (uint8_t *)cmd_words);
+
+    QSPI_polled_transfer_block(&g_qspi, nb_addr_bytes, cmd_words, 0u,
+                               p_buf, length, p_cmd->idle_cycles);
+}
+
+/*------------------------------------------------------------------------------
+ * Read the JEDEC ID of the device, returning its manufacturer ID.
+ */
+static uint8_t read_manufacturer_id(void)
+{
+    uint32_t cmd_word = CMD_READ_JEDEC_ID;
+    uint32_t id_word = 0u;
+
+    QSPI_polled_transfer_block(&g_qspi, 0u, &cmd_word, 0u, &id_word, 3u, 0u);
+
+    return (uint8_t)id_word;
+}
+
+/*------------------------------------------------------------------------------
+ * Read the SFDP area of the device. p_words must be word aligned.
+ */
+static void read_sfdp(uint32_t address, uint32_t * p_words, uint32_t length)
+{
+    read_cmd_t cmd;
+
+    cmd.mode = FLASH_ACCESS_QSPI_1_1_1;
+    cmd.io_format = QSPI_NORMAL;
+    cmd.opcode = CMD_READ_SFDP;
+    cmd.mode_byte = 0u;
+    cmd.idle_cycles = SFDP_DUMMY_CLOCKS;
+
+    qspi_read(&cmd, address, p_words, length);
+}
+
+/*------------------------------------------------------------------------------
+ * Append the read mode described by a 16 bit BFPT field to the candidate
+ * modes. The field holds the dummy clocks in bits 4:0, the mode clocks in
+ * bits 7:5 and the command in bits 15:8. addr_lanes is the number of lanes
+ * the address and mode bits are sent on.
+ *
+ * The mode bits must fill exactly one byte, sent after the address: they are
+ * not left undriven, which could enable the continuous read mode.
+ */
+static uint32_t
+add_bfpt_mode
+(
+    read_cmd_t * p_cmds,
+    uint32_t nb_cmds,
+    flash_access_mode_t mode,
+    qspi_io_format io_format,
+    uint32_t field,
+    uint32_t addr_lanes
+)
+{
+    uint32_t dummy_clocks = field & 0x1Fu;
+    uint32_t mode_clocks = (field >> 5) & 0x7u;
+    uint8_t opcode = (uint8_t)(field >> 8);
+
+    if ((0u == opcode) || (dummy_clocks > MAX_IDLE_CYCLES) ||
+        ((0u != mode_clocks) && (8u != (mode_clocks * addr_lanes))))
+    {
+        return nb_cmds;
+    }
+
+    p_cmds[nb_cmds].mode = mode;
+    p_cmds[nb_cmds].io_format = io_format;
+    p_cmds[nb_cmds].opcode = opcode;
+    p_cmds[nb_cmds].mode_byte = (0u != mode_clocks) ? 1u : 0u;
+    p_cmds[nb_cmds].idle_cycles = (uint8_t)dummy_clocks;
+
+    return nb_cmds + 1u;
+}
+
+/*------------------------------------------------------------------------------
+ * Build the list of the read modes supported by the device, from the fastest
+ * to the slowest, from its Basic Flash Parameter Table. The 1-1-1 fast read is
+ * always last.
+ */
+static uint32_t get_read_modes(read_cmd_t * p_cmds)
+{
+    uint32_t headers[SFDP_HEADERS_SIZE / 4u];
+    uint32_t bfpt[SFDP_BFPT_MAX_DWORDS];
+    uint32_t nb_dwords;
+    uint32_t nb_cmds = 0u;
+
+    read_sfdp(0u, headers, SFDP_HEADERS_SIZE);
+
+    /* headers[2] and headers[3] are the parameter header of the BFPT. */
+    nb_dwords = headers[2] >> 24;
+    if ((SFDP_SIGNATURE == headers[0]) &&
+        (SFDP_BFPT_ID == (headers[2] & 0xFFu)) &&
+        (nb_dwords > BFPT_DWORD4))
+    {
+        uint8_t quad_enabled;
+
+        if (nb_dwords > SFDP_BFPT_MAX_DWORDS)
+        {
+            nb_dwords = SFDP_BFPT_MAX_DWORDS;
+        }
+
+        read_sfdp(headers[3] & 0x00FFFFFFu, bfpt, nb_dwords * 4u);
+
+        /*
+         * Quad modes are only tried when no Quad Enable bit has to be set,
+         * JESD216 revisions before B do not describe it.
+         */
+        quad_enabled = ((nb_dwords <= BFPT_DWORD15) ||
+                        (0u == ((bfpt[BFPT_DWORD15] >> BFPT_QER_SHIFT) & BFPT_QER_MASK)))
+                       ? 1u : 0u;
+
+        if ((0u != quad_enabled) && (0u != (bfpt[BFPT_DWORD1] & BFPT_SUPPORTS_1_4_4)))
+        {
+            nb_cmds = add_bfpt_mode(p_cmds, nb_cmds, FLASH_ACCESS_QSPI_1_4_4, QSPI_QUAD_EX_RW,
+                                    bfpt[BFPT_DWORD3] & 0xFFFFu, 4u);
+        }
+
+        if ((0u != quad_enabled) && (0u != (bfpt[BFPT_DWORD1] & BFPT_SUPPORTS_1_1_4)))
+        {
+            nb_cmds = add_bfpt_mode(p_cmds, nb_cmds, FLASH_ACCESS_QSPI_1_1_4, QSPI_QUAD_EX_RO,
+                                    bfpt[BFPT_DWORD3] >> 16, 1u);
+        }
+
+        if (0u != (bfpt[BFPT_DWORD1] & BFPT_SUPPORTS_1_2_2))
+        {
+            nb_cmds = add_bfpt_mode(p_cmds, nb_cmds, FLASH_ACCESS_QSPI_1_2_2, QSPI_DUAL_EX_RW,
+                                    bfpt[BFPT_DWORD4] >> 16, 2u);
+        }
+
+        if (0u != (bfpt[BFPT_DWORD1] & BFPT_SUPPORTS_1_1_2))
+        {
+            nb_cmds = add_bfpt_mode(p_cmds, nb_cmds, FLASH_ACCESS_QSPI_1_1_2, QSPI_DUAL_EX_RO,
+                                    bfpt[BFPT_DWORD4] & 0xFFFFu, 1u);
+        }
+    }
+
+    p_cmds[nb_cmds].mode = FLASH_ACCESS_QSPI_1_1_1;
+    p_cmds[nb_cmds].io_format = QSPI_NORMAL;
+    p_cmds[nb_cmds].opcode = CMD_FAST_READ;
+    p_cmds[nb_cmds].mode_byte = 0u;
+    p_cmds[nb_cmds].idle_cycles = FAST_READ_DUMMY_CLOCKS;
+
+    return nb_cmds + 1u;
+}
+
+/*------------------------------------------------------------------------------
+ * Check whether all the bytes of a buffer hold the same value, as blank flash
+ * does.
+ */
+static uint8_t is_uniform(const uint8_t * p_bytes, uint32_t length)
+{
+    uint32_t idx;
+
+    for (idx = 1u; idx < length; idx++)
+    {
+        if (p_bytes[idx] != p_bytes[0])
+        {
+            return 0u;
+        }
+    }
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * flash_access_init()
+ * See "flash_access.h" for details of how to use this function.
+ */
+flash_access_mode_t flash_access_init(addr_t qspi_base, uint32_t spi_base)
+{
+    read_cmd_t cmds[MAX_READ_MODES];
+    read_cmd_t reference;
+    uint32_t expected[VERIFY_SIZE / 4u];
+    uint32_t nb_cmds;
+    uint32_t idx;
+    uint8_t manufacturer_id;
+
+    g_mode = FLASH_ACCESS_SPI_READ;
+
+    if (0u != qspi_base)
+    {
+        QSPI_init(&g_qspi, qspi_base);
+        configure_qspi(QSPI_NORMAL);
+
+        manufacturer_id = read_manufacturer_id();
+        if ((0x00u != manufacturer_id) && (0xFFu != manufacturer_id))
+        {
+            reference.mode = FLASH_ACCESS_QSPI_1_1_1;
+            reference.io_format = QSPI_NORMAL;
+            reference.opcode = CMD_READ_ARRAY;
+            reference.mode_byte = 0u;
+            reference.idle_cycles = 0u;
+            qspi_read(&reference, 0u, expected, VERIFY_SIZE);
+
+            nb_cmds = get_read_modes(cmds);
+
+            /*
+             * Blank flash reads as 0xFF, as do lanes left floating high by a
+             * wrong dual or quad configuration: uniform data cannot validate
+             * a mode, only the 1-1-1 fast read, the last one, is tried.
+             */
+            idx = (0u != is_uniform((const uint8_t *)expected, VERIFY_SIZE))
+                  ? (nb_cmds - 1u) : 0u;
+
+            for (; idx < nb_cmds; idx++)
+            {
+                configure_qspi(cmds[idx].io_format);
+                qspi_read(&cmds[idx], 0u, g_bounce, VERIFY_SIZE);
+
+                if (0 == MRV_memcmp(g_bounce, expected, VERIFY_SIZE))
+                {
+                    g_read_cmd = cmds[idx];
+                    g_mode = cmds[idx].mode;
+                    return g_mode;
+                }
+            }
+        }
+    }
+
+    (void)spi_flash_init(spi_base);
+
+    return g_mode;
+}
+
+/***************************************************************************//**
+ * flash_access_read()
+ * See "flash_access.h" for details of how to use this function.
+ */
+int flash_access_read(uint32_t address, uint8_t * p_buf, uint32_t length)
+{
+    if (0u != flash_access_is_read_busy())
+    {
+        return -1;
+    }
+
+    if (FLASH_ACCESS_SPI_READ == g_mode)
+    {
+        return (SPI_FLASH_SUCCESS == spi_flash_read(address, p_buf, length)) ? 0 : -1;
+    }
+
+    if (0u == ((uintptr_t)p_buf & 3u))
+    {
+        if (length > 0u)
+        {
+            qspi_read(&g_read_cmd, address, p_buf, length);
+        }
+        return 0;
+    }
+
+    /* The CoreQSPI driver stores the received words with word accesses. */
+    while (length > 0u)
+    {
+        uint32_t count = (length > FLASH_ACCESS_BOUNCE_SIZE) ? FLASH_ACCESS_BOUNCE_SIZE : length;
+
+        qspi_read(&g_read_cmd, address, g_bounce, count);
+        MRV_memcpy(p_buf, g_bounce, count);
+
+        address += count;
+        p_buf += count;
+        length -= count;
+    }
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------
+ * CoreQSPI status handler, called from qspi_isr().
+ */
+static void async_read_status(uint32_t status)
+{
+    if ((STATUS_RXDONE_MASK == status) && (0 != g_async_handler))
+    {
+        g_async_handler();
+    }
+}
+
+/***************************************************************************//**
+ * flash_access_read_async()
+ * See "flash_access.h" for details of how to use this function.
+ */
+int
+flash_access_read_async
+(
+    uint32_t address,
+    uint8_t * p_buf,
+    uint32_t length,
+    flash_access_read_handler_t handler
+)
+{
+    uint8_t nb_addr_bytes;
+
+    if (FLASH_ACCESS_SPI_READ == g_mode)
+    {
+        return (SPI_FLASH_SUCCESS ==
+                spi_flash_read_async(address, p_buf, length, handler)) ? 0 : -1;
+    }
+
+    if ((0u == length) || (0u != QSPI_is_transfer_busy(&g_qspi)))
+    {
+        return -1;
+    }
+
+    g_async_handler = handler;
+    QSPI_set_status_handler(async_read_status);
+
+    nb_addr_bytes = build_read_cmd(&g_read_cmd, address, g_async_cmd);
+
+    return (0u == QSPI_irq_transfer_block(&g_qspi, nb_addr_bytes, g_async_cmd, 0u,
+                                          p_buf, length, g_read_cmd.idle_cycles))
+           ? 0 : -1;
+}
+
+/***************************************************************************//**
+ * flash_access_is_read_busy()
+ * See "flash_access.h" for details of how to use this function.
+ */
+uint8_t flash_access_is_read_busy(void)
+{
+    if (FLASH_ACCESS_SPI_READ == g_mode)
+    {
+        return spi_flash_is_read_busy();
+    }
+
+    return QSPI_is_transfer_busy(&g_qspi);
+}
+
+/***************************************************************************//**
+ * flash_access_isr()
+ * See "flash_access.h" for details of how to use this function.
+ */
+void flash_access_isr(void)
+{
+    if (FLASH_ACCESS_SPI_READ != g_mode)
+    {
+        qspi_isr(&g_qspi);
+    }
+}
+
+/***************************************************************************//**
+ * flash_access_get_mode()
+ * See "flash_access.h" for details of how to use this function.
+ */
+flash_access_mode_t flash_access_get_mode(void)
+{
+    return g_mode;
+}
+
+/***************************************************************************//**
+ * flash_access_mode_name()
+ * See "flash_access.h" for details of how to use this function.
+ */
+const char * flash_access_mode_name(flash_access_mode_t mode)
+{
+    if ((uint32_t)mode >= (sizeof(g_mode_names) / sizeof(g_mode_names[0])))
+    {
+        return "unknown";
+    }
+
+    return g_mode_names[mode];
+}
+
+#ifdef __cplusplus
+}
+#endif
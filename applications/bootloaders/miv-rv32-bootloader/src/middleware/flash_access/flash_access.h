@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_access.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief SPI flash read layer selecting the fastest read mode supported by the
+ * device and the design.
+ *
+ */
+
+/*=========================================================================*//**
+  Flash Access
+  =======================================
+  spi_flash_read() reads the SPI flash through CoreSPI with the READ ARRAY
+  (0x03) command: one bit per SPI clock, at the low clock rates this command
+  is specified for. When the flash is also connected to a CoreQSPI instance,
+  the same data can be read with the fast read commands, transferring up to
+  four bits per clock.
+
+  flash_access_init() probes the flash through CoreQSPI and selects a read
+  mode:
+    - the JEDEC ID (0x9F) is read to check a device answers,
+    - the Serial Flash Discoverable Parameters (SFDP, JESD216) of the device
+      are read, and the Basic Flash Parameter Table gives the fast read modes
+      the device supports, with their command, mode clocks and dummy clocks,
+    - the modes are tried from the fastest, 1-4-4, to the slowest, 1-1-1
+      fast read (0x0B). A mode is selected once the first bytes of the flash
+      read in that mode match the same bytes read in single mode. When these
+      bytes all have the same value, as on blank flash, they cannot tell a
+      working mode from lanes left floating, and only the 1-1-1 fast read is
+      used.
+
+  Quad modes are only used when the table says no Quad Enable bit has to be
+  set, or does not describe one: setting the Quad Enable bit is a non-volatile
+  configuration change the bootloader does not make. Devices without SFDP are
+  read with the 1-1-1 fast read command and 8 dummy clocks.
+
+  When no CoreQSPI instance is given, or no device answers through it,
+  flash_access_read() falls back to spi_flash_read() over CoreSPI.
+
+  Addresses are sent on 3 bytes, as spi_flash_read() does, so the first
+  16 MB of the flash can be read.
+
+  --------------------------------
+  Example
+  --------------------------------
+      #ifdef FLASH_CORE_QSPI_BASE
+      flash_access_init(FLASH_CORE_QSPI_BASE, FLASH_CORE_SPI_BASE);
+      #else
+      flash_access_init(0u, FLASH_CORE_SPI_BASE);
+      #endif
+
+      flash_access_read(0u, buffer, sizeof(buffer));
+
+  Large reads can be made with flash_access_read_async(), leaving the
+  processor free while the data is transferred: through CoreQSPI, the data is
+  moved by the CoreQSPI interrupt, a FIFO at a time.
+
+ *//*=========================================================================*/
+#ifndef FLASH_ACCESS_H
+#define FLASH_ACCESS_H
+
+#include <stdint.h>
+#include "hal/cpu_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CoreQSPI clock divider used for the flash reads, a qspi_clk_div_t value.
+ * QSPI_CLK_DIV_2 by default.
+ */
+#ifndef FLASH_ACCESS_QSPI_CLK_DIV
+#define FLASH_ACCESS_QSPI_CLK_DIV       0x1u
+#endif
+
+/*
+ * Size of the word aligned buffer used when the destination of a read through
+ * CoreQSPI is not word aligned, in bytes.
+ */
+#ifndef FLASH_ACCESS_BOUNCE_SIZE
+#define FLASH_ACCESS_BOUNCE_SIZE        256u
+#endif
+
+/***************************************************************************//**
+  Read modes, named after the number of lanes used for the command, the
+  address and the data.
+ */
+typedef enum
+{
+    FLASH_ACCESS_SPI_READ = 0,          /* CoreSPI, READ ARRAY (0x03)    */
+    FLASH_ACCESS_QSPI_1_1_1,            /* CoreQSPI, FAST READ (0x0B)    */
+    FLASH_ACCESS_QSPI_1_1_2,            /* CoreQSPI, dual output read    */
+    FLASH_ACCESS_QSPI_1_2_2,            /* CoreQSPI, dual I/O read       */
+    FLASH_ACCESS_QSPI_1_1_4,            /* CoreQSPI, quad output read    */
+    FLASH_ACCESS_QSPI_1_4_4             /* CoreQSPI, quad I/O read       */
+} flash_access_mode_t;
+
+/***************************************************************************//**
+  The flash_access_init() function selects the read mode and initializes the
+  controller used to read the flash.
+
+  @param qspi_base
+  Base address of the CoreQSPI instance connected to the flash, or 0 when the
+  flash is only connected to CoreSPI.
+
+  @param spi_base
+  Base address of the CoreSPI instance connected to the flash, used when the
+  flash cannot be read through CoreQSPI.
+
+  @return
+  This function returns the selected read mode.
+ */
+flash_access_mode_t flash_access_init(addr_t qspi_base, uint32_t spi_base);
+
+/***************************************************************************//**
+  The flash_access_read() function reads the flash in the selected read mode.
+
+  @param address
+  Address of the first byte to read.
+
+  @param p_buf
+  Buffer receiving the data. Reads through CoreQSPI are fastest when it is
+  word aligned.
+
+  @param length
+  Number of bytes to read.
+
+  @return
+  This function returns 0 on success, or -1 when the read failed or a read
+  started with flash_access_read_async() is in progress.
+ */
+int flash_access_read(uint32_t address, uint8_t * p_buf, uint32_t length);
+
+/***************************************************************************//**
+  Function called when a read started with flash_access_read_async() is
+  complete, from the interrupt handler of the controller.
+ */
+typedef void (*flash_access_read_handler_t)(void);
+
+/***************************************************************************//**
+  The flash_access_read_async() function starts reading the flash in the
+  selected read mode and returns without waiting for the data. Through
+  CoreQSPI, the data is moved by the CoreQSPI interrupt a FIFO at a time and
+  the application must call flash_access_isr() from the interrupt handler of
+  the CoreQSPI instance. Through CoreSPI, the read is made with
+  spi_flash_read_async() and the application must call SPI_isr() from the
+  interrupt handler of the CoreSPI instance.
+
+  @param address
+  Address of the first byte to read.
+
+  @param p_buf
+  Buffer receiving the data. It must remain valid until the read is complete.
+  It does not need to be word aligned.
+
+  @param length
+  Number of bytes to read.
+
+  @param handler
+  Function called when the read is complete, or 0.
+
+  @return
+  This function returns 0 when the read is started, or -1 when a read is
+  already in progress.
+ */
+int
+flash_access_read_async
+(
+    uint32_t address,
+    uint8_t * p_buf,
+    uint32_t length,
+    flash_access_read_handler_t handler
+);
+
+/***************************************************************************//**
+  The flash_access_is_read_busy() function returns a non-zero value while a
+  read started with flash_access_read_async() is in progress.
+ */
+uint8_t flash_access_is_read_busy(void);
+
+/***************************************************************************//**
+  The flash_access_isr() function services the CoreQSPI interrupt for the
+  reads started with flash_access_read_async(). It must be called from the
+  interrupt handler of the CoreQSPI instance.
+ */
+void flash_access_isr(void);
+
+/***************************************************************************//**
+  The flash_access_get_mode() function returns the read mode selected by
+  flash_access_init().
+ */
+flash_access_mode_t flash_access_get_mode(void);
+
+/***************************************************************************//**
+  The flash_access_mode_name() function returns a printable name for a read
+  mode, for example "QSPI 1-4-4".
+ */
+const char * flash_access_mode_name(flash_access_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FLASH_ACCESS_H */
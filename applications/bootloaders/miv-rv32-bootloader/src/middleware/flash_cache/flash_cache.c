@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_cache.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Least recently used block cache in front of the SPI flash reads. See
+ * file "flash_cache.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "drivers/off_chip/spi_flash/spi_flash.h"
+#include "flash_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Flash address of a cached block and value of the use counter when it was
+ * last read. The block with the lowest last_use is the least recently used.
+ */
+typedef struct
+{
+    uint32_t address;
+    uint32_t last_use;
+    uint8_t valid;
+} cache_tag_t;
+
+static cache_tag_t g_tags[FLASH_CACHE_NB_BLOCKS];
+static uint8_t g_blocks[FLASH_CACHE_NB_BLOCKS][FLASH_CACHE_BLOCK_SIZE];
+static uint32_t g_use_count;
+static flash_cache_stats_t g_stats;
+
+/*------------------------------------------------------------------------------
+ * Return the cached copy of a block, reading it from the flash in place of the
+ * least recently used block, or of an empty one, when it is not cached.
+ */
+static const uint8_t * get_block(uint32_t address)
+{
+    uint32_t idx;
+    uint32_t victim = FLASH_CACHE_NB_BLOCKS;
+
+    /* Restart the ages from 0 when the counter wraps around. */
+    g_use_count++;
+    if (0u == g_use_count)
+    {
+        for (idx = 0u; idx < FLASH_CACHE_NB_BLOCKS; idx++)
+        {
+            g_tags[idx].last_use = 0u;
+        }
+        g_use_count = 1u;
+    }
+
+    for (idx = 0u; idx < FLASH_CACHE_NB_BLOCKS; idx++)
+    {
+        if (0u == g_tags[idx].valid)
+        {
+            if ((FLASH_CACHE_NB_BLOCKS == victim) || (0u != g_tags[victim].valid))
+            {
+                victim = idx;
+            }
+        }
+        else if (address == g_tags[idx].address)
+        {
+            g_tags[idx].last_use = g_use_count;
+            g_stats.hits++;
+            return g_blocks[idx];
+        }
+        else if ((FLASH_CACHE_NB_BLOCKS == victim) ||
+                 ((0u != g_tags[victim].valid) &&
+                  (g_tags[idx].last_use < g_tags[victim].last_use)))
+        {
+            victim = idx;
+        }
+    }
+
+    g_tags[victim].valid = 0u;
+    if (SPI_FLASH_SUCCESS != spi_flash_read(address, g_blocks[victim], FLASH_CACHE_BLOCK_SIZE))
+    {
+        return 0;
+    }
+
+    g_tags[victim].address = address;
+    g_tags[victim].last_use = g_use_count;
+    g_tags[victim].valid = 1u;
+    g_stats.misses++;
+
+    return g_blocks[victim];
+}
+
+/***************************************************************************//**
+ * flash_cache_init()
+ * See "flash_cache.h" for details of how to use this function.
+ */
+void flash_cache_init(void)
+{
+    MRV_memset(g_tags, 0, sizeof(g_tags));
+    g_use_count = 0u;
+    flash_cache_reset_stats();
+
+    spi_flash_set_change_hook(flash_cache_invalidate);
+}
+
+/***************************************************************************//**
+ * flash_cache_read()
+ * See "flash_cache.h" for details of how to use this function.
+ */
+int flash_cache_read(uint32_t address, void * p_buf, uint32_t length)
+{
+    uint8_t * p_dest = (uint8_t *)p_buf;
+
+    if (length >= FLASH_CACHE_BYPASS_SIZE)
+    {
+        g_stats.bypassed++;
+        return (SPI_FLASH_SUCCESS == spi_flash_read(address, p_dest, length)) ? 0 : -1;
+    }
+
+    while (length > 0u)
+    {
+        uint32_t offset = address & (FLASH_CACHE_BLOCK_SIZE - 1u);
+        uint32_t count = FLASH_CACHE_BLOCK_SIZE - offset;
+        const uint8_t * p_block = get_block(address - offset);
+
+        if (0 == p_block)
+        {
+            return -1;
+        }
+
+        if (count > length)
+        {
+            count = length;
+        }
+
+        MRV_memcpy(p_dest, &p_block[offset], count);
+
+        address += count;
+        p_dest += count;
+        length -= count;
+    }
+
+    return 0;
+}
+
+/***************************************************************************//**
+ * flash_cache_invalidate()
+ * See "flash_cache.h" for details of how to use this function.
+ */
+void flash_cache_invalidate(uint32_t address, uint32_t size)
+{
+    uint64_t end = (uint64_t)address + size;
+    uint32_t idx;
+
+    for (idx = 0u; idx < FLASH_CACHE_NB_BLOCKS; idx++)
+    {
+        if ((0u != g_tags[idx].valid) &&
+            (((uint64_t)g_tags[idx].address + FLASH_CACHE_BLOCK_SIZE) > address) &&
+            ((uint64_t)g_tags[idx].address < end))
+        {
+            g_tags[idx].valid = 0u;
+            g_stats.invalidated++;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * flash_cache_get_stats()
+ * See "flash_cache.h" for details of how to use this function.
+ */
+void flash_cache_get_stats(flash_cache_stats_t * p_stats)
+{
+    *p_stats = g_stats;
+}
+
+/***************************************************************************//**
+ * flash_cache_reset_stats()
+ * See "flash_cache.h" for details of how to use this function.
+ */
+void flash_cache_reset_stats(void)
+{
+    MRV_memset(&g_stats, 0, sizeof(g_stats));
+}
+
+#ifdef __cplusplus
+}
+#endif
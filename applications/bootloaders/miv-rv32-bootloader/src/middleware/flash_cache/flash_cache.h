@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_cache.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Least recently used block cache in front of the SPI flash reads.
+ *
+ */
+
+/*=========================================================================*//**
+  Flash Cache
+  =======================================
+  Each spi_flash_read() call sends a read command and an address to the flash
+  before the data, and waits for the transfer to complete. Applications that
+  read small records from the SPI flash, such as configuration values, a file
+  system or a key-value store, pay that cost on every read, even when they
+  read the same data again.
+
+  flash_cache_read() serves reads from a cache of FLASH_CACHE_NB_BLOCKS
+  blocks of FLASH_CACHE_BLOCK_SIZE bytes held in RAM. A block is read from the
+  flash in a single transfer the first time one of its bytes is read, and
+  stays in the cache until it is replaced by a more recently used block, or
+  the flash content it holds is changed.
+
+  Reads of FLASH_CACHE_BYPASS_SIZE bytes or more, such as loading an image,
+  are made straight from the flash without going through the cache, so they
+  do not replace the blocks of the small reads.
+
+  flash_cache_init() registers flash_cache_invalidate() with
+  spi_flash_set_change_hook(): the blocks of the areas programmed or erased
+  through the spi_flash driver are dropped from the cache before the flash is
+  changed, so the cache never returns stale data.
+
+  flash_cache_get_stats() returns the number of hits, misses, bypassed reads
+  and invalidated blocks, to tune the size of the cache.
+
+  --------------------------------
+  Example
+  --------------------------------
+      spi_flash_init(FLASH_CORE_SPI_BASE);
+      flash_cache_init();
+
+      flash_cache_read(CONFIG_ADDR + offset, &value, sizeof(value));
+
+ *//*=========================================================================*/
+#ifndef FLASH_CACHE_H
+#define FLASH_CACHE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Size of a cache block in bytes, a power of two, and number of blocks.
+ */
+#ifndef FLASH_CACHE_BLOCK_SIZE
+#define FLASH_CACHE_BLOCK_SIZE          256u
+#endif
+
+#ifndef FLASH_CACHE_NB_BLOCKS
+#define FLASH_CACHE_NB_BLOCKS           16u
+#endif
+
+#if (FLASH_CACHE_BLOCK_SIZE & (FLASH_CACHE_BLOCK_SIZE - 1)) != 0
+#error FLASH_CACHE_BLOCK_SIZE must be a power of two
+#endif
+
+/*
+ * Size from which reads are made straight from the flash.
+ */
+#ifndef FLASH_CACHE_BYPASS_SIZE
+#define FLASH_CACHE_BYPASS_SIZE         (4u * FLASH_CACHE_BLOCK_SIZE)
+#endif
+
+/***************************************************************************//**
+  Cache statistics, counted since flash_cache_init() or
+  flash_cache_reset_stats().
+ */
+typedef struct
+{
+    uint32_t hits;              /* Blocks read from the cache              */
+    uint32_t misses;            /* Blocks read from the flash into it      */
+    uint32_t bypassed;          /* Reads made straight from the flash      */
+    uint32_t invalidated;       /* Blocks dropped because the flash changed */
+} flash_cache_stats_t;
+
+/***************************************************************************//**
+  The flash_cache_init() function empties the cache, clears the statistics and
+  registers flash_cache_invalidate() as the change hook of the spi_flash
+  driver.
+ */
+void flash_cache_init(void);
+
+/***************************************************************************//**
+  The flash_cache_read() function reads the flash through the cache.
+
+  @param address
+  Address of the first byte to read.
+
+  @param p_buf
+  Buffer receiving the data.
+
+  @param length
+  Number of bytes to read.
+
+  @return
+  This function returns 0 on success, or -1 when a read from the flash
+  failed.
+ */
+int flash_cache_read(uint32_t address, void * p_buf, uint32_t length);
+
+/***************************************************************************//**
+  The flash_cache_invalidate() function drops the blocks holding any byte of
+  an area from the cache. It is called by the spi_flash driver before the area
+  is changed, and must be called by the application when the flash is changed
+  by other means.
+
+  @param address
+  Address of the area.
+
+  @param size
+  Size of the area in bytes.
+ */
+void flash_cache_invalidate(uint32_t address, uint32_t size);
+
+/***************************************************************************//**
+  The flash_cache_get_stats() function copies the cache statistics.
+ */
+void flash_cache_get_stats(flash_cache_stats_t * p_stats);
+
+/***************************************************************************//**
+  The flash_cache_reset_stats() function clears the cache statistics.
+ */
+void flash_cache_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FLASH_CACHE_H */
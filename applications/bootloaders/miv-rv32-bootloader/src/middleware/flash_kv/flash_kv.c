@@ -0,0 +1,1068 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_kv.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Log-structured key-value store on the SPI flash. See file
+ * "flash_kv.h" for description of the functions implemented in this file.
+ *
+ */
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "drivers/off_chip/spi_flash/spi_flash.h"
+#include "boot_image/boot_image.h"
+#include "flash_cache/flash_cache.h"
+#include "flash_kv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Sector header. The obsolete word is left erased while the sector is in the
+ * ring, and is programmed to 0 before the sector is erased by a compaction.
+ */
+#define SECTOR_MAGIC                    0x31564B4Du     /* "MKV1" */
+#define SECTOR_IN_USE                   0xFFFFFFFFu
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t crc;               /* CRC-32 of the magic and seq words */
+    uint32_t obsolete;
+} sector_header_t;
+
+#define SECTOR_HEADER_SIZE              ((uint32_t)sizeof(sector_header_t))
+#define SECTOR_OBSOLETE_OFFSET          12u
+
+/*------------------------------------------------------------------------------
+ * Record header, followed by the key, the value and up to 3 padding bytes
+ * keeping the records word aligned. The CRC covers the first word of the
+ * header, the key and the value.
+ */
+#define RECORD_VALUE                    0x5Au
+#define RECORD_TOMBSTONE                0xA5u
+#define RECORD_BLANK                    0xFFu
+
+typedef struct
+{
+    uint8_t flags;
+    uint8_t key_length;
+    uint16_t value_length;
+    uint32_t crc;
+} record_header_t;
+
+#define RECORD_HEADER_SIZE              ((uint32_t)sizeof(record_header_t))
+#define RECORD_MAX_SIZE                 (RECORD_HEADER_SIZE + \
+                                         FLASH_KV_MAX_KEY_LENGTH + \
+                                         FLASH_KV_MAX_VALUE_LENGTH + 3u)
+
+#if (FLASH_KV_SECTOR_SIZE % 4096) != 0
+#error FLASH_KV_SECTOR_SIZE must be a multiple of 4096
+#endif
+
+#if FLASH_KV_MAX_VALUE_LENGTH > 0xFFFF
+#error FLASH_KV_MAX_VALUE_LENGTH must not be greater than 65535
+#endif
+
+#if FLASH_KV_MAX_SECTORS < 3
+#error FLASH_KV_MAX_SECTORS must be at least 3
+#endif
+
+/*------------------------------------------------------------------------------
+ * Result of parsing the record at a given offset of a sector.
+ */
+typedef enum
+{
+    RECORD_OK = 0,              /* complete record, read into the buffer  */
+    RECORD_TORN,                /* record whose CRC does not match        */
+    RECORD_END,                 /* erased space, the end of the log       */
+    RECORD_BAD                  /* no record can be found from this point */
+} record_status_t;
+
+/*------------------------------------------------------------------------------
+ * State of each sector of the ring. end is the offset following the last
+ * record, where the next record is written in the head sector. live is the
+ * size of the records holding the current value of a key.
+ */
+typedef struct
+{
+    uint32_t seq;
+    uint32_t end;
+    uint32_t live;
+    uint8_t used;
+} sector_info_t;
+
+/*------------------------------------------------------------------------------
+ * Index of the keys: an open addressing hash table with linear probing, with
+ * twice as many entries as keys. An entry is empty when its key_length is 0.
+ */
+#define INDEX_SIZE                      (2u * FLASH_KV_MAX_KEYS)
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t address;           /* address of the current record */
+    uint16_t value_length;
+    uint8_t key_length;
+} index_entry_t;
+
+static uint32_t g_base_address;
+static uint32_t g_nb_sectors;
+static uint32_t g_nb_used;
+static uint32_t g_head;
+static uint32_t g_next_seq;
+static uint32_t g_nb_keys;
+static uint32_t g_compactions;
+static uint32_t g_capacity;
+static uint8_t g_mounted;
+
+static sector_info_t g_sectors[FLASH_KV_MAX_SECTORS];
+static index_entry_t g_index[INDEX_SIZE];
+
+/* Record written by flash_kv_set() and flash_kv_delete(). */
+static uint8_t g_record[RECORD_MAX_SIZE];
+
+/* Record read while mounting or compacting. */
+static uint8_t g_scan[RECORD_MAX_SIZE];
+
+/*------------------------------------------------------------------------------
+ * Record size, header and padding included.
+ */
+static uint32_t record_size(uint32_t key_length, uint32_t value_length)
+{
+    return (RECORD_HEADER_SIZE + key_length + value_length + 3u) & ~3u;
+}
+
+/*------------------------------------------------------------------------------
+ * Size of the records holding the current value of a key.
+ */
+static uint32_t live_bytes(void)
+{
+    uint32_t live = 0u;
+    uint32_t sector;
+
+    for (sector = 0u; sector < g_nb_sectors; sector++)
+    {
+        if (0u != g_sectors[sector].used)
+        {
+            live += g_sectors[sector].live;
+        }
+    }
+
+    return live;
+}
+
+static uint32_t sector_address(uint32_t sector)
+{
+    return g_base_address + (sector * FLASH_KV_SECTOR_SIZE);
+}
+
+static uint32_t sector_of(uint32_t address)
+{
+    return (address - g_base_address) / FLASH_KV_SECTOR_SIZE;
+}
+
+static uint32_t record_crc(const uint8_t * p_record)
+{
+    const record_header_t * p_header = (const record_header_t *)p_record;
+    uint32_t crc;
+
+    crc = boot_image_crc32(0u, p_record, 4u);
+    return boot_image_crc32(crc, &p_record[RECORD_HEADER_SIZE],
+                            (uint32_t)p_header->key_length + p_header->value_length);
+}
+
+/*------------------------------------------------------------------------------
+ * FNV-1a hash of a key.
+ */
+static uint32_t hash_key(const uint8_t * p_key, uint32_t length)
+{
+    uint32_t hash = 0x811C9DC5u;
+    uint32_t idx;
+
+    for (idx = 0u; idx < length; idx++)
+    {
+        hash = (hash ^ p_key[idx]) * 0x01000193u;
+    }
+
+    return hash;
+}
+
+/*------------------------------------------------------------------------------
+ * Compare the flash content at an address with a buffer. Returns 1 when they
+ * match, 0 when they differ and -1 when the flash cannot be read.
+ */
+static int flash_matches(uint32_t address, const uint8_t * p_data, uint32_t length)
+{
+    uint8_t chunk[32];
+
+    while (length > 0u)
+    {
+        uint32_t count = (length > sizeof(chunk)) ? sizeof(chunk) : length;
+
+        if (0 != flash_cache_read(address, chunk, count))
+        {
+            return -1;
+        }
+
+        if (0 != MRV_memcmp(chunk, p_data, count))
+        {
+            return 0;
+        }
+
+        address += count;
+        p_data += count;
+        length -= count;
+    }
+
+    return 1;
+}
+
+/*------------------------------------------------------------------------------
+ * Look a key up in the index. Returns 1 with the slot of the key when it is
+ * found, 0 with the empty slot where it would be added when it is not found,
+ * and -1 when the flash cannot be read.
+ */
+static int
+find_key
+(
+    const uint8_t * p_key,
+    uint32_t key_length,
+    uint32_t hash,
+    uint32_t * p_slot
+)
+{
+    uint32_t slot = hash % INDEX_SIZE;
+    uint32_t count;
+
+    for (count = 0u; count < INDEX_SIZE; count++)
+    {
+        const index_entry_t * p_entry = &g_index[slot];
+
+        if (0u == p_entry->key_length)
+        {
+            *p_slot = slot;
+            return 0;
+        }
+
+        if ((hash == p_entry->hash) && (key_length == p_entry->key_length))
+        {
+            int match = flash_matches(p_entry->address + RECORD_HEADER_SIZE,
+                                      p_key,
+                                      key_length);
+            if (0 != match)
+            {
+                *p_slot = slot;
+                return match;
+            }
+        }
+
+        slot = (slot + 1u) % INDEX_SIZE;
+    }
+
+    /* Not reached: the index always has empty slots. */
+    return -1;
+}
+
+/*------------------------------------------------------------------------------
+ * Remove an entry from the index, moving the following entries of the probe
+ * sequence back so lookups do not stop at the freed slot.
+ */
+static void remove_entry(uint32_t slot)
+{
+    uint32_t next = slot;
+
+    for (;;)
+    {
+        uint32_t home;
+
+        next = (next + 1u) % INDEX_SIZE;
+        if (0u == g_index[next].key_length)
+        {
+            break;
+        }
+
+        /* Leave the entries whose home slot lies between slot and next. */
+        home = g_index[next].hash % INDEX_SIZE;
+        if ((slot <= next) ? ((slot < home) && (home <= next))
+                           : ((slot < home) || (home <= next)))
+        {
+            continue;
+        }
+
+        g_index[slot] = g_index[next];
+        slot = next;
+    }
+
+    g_index[slot].key_length = 0u;
+}
+
+/*------------------------------------------------------------------------------
+ * Account for the record at an address no longer holding the value of its key.
+ */
+static void release_record(const index_entry_t * p_entry)
+{
+    g_sectors[sector_of(p_entry->address)].live -=
+        record_size(p_entry->key_length, p_entry->value_length);
+}
+
+/*------------------------------------------------------------------------------
+ * Point the index to a record holding the value of its key, or remove the key
+ * when the record is a tombstone.
+ */
+static int apply_record(const uint8_t * p_record, uint32_t address)
+{
+    const record_header_t * p_header = (const record_header_t *)p_record;
+    const uint8_t * p_key = &p_record[RECORD_HEADER_SIZE];
+    uint32_t hash = hash_key(p_key, p_header->key_length);
+    uint32_t slot;
+    int found;
+
+    found = find_key(p_key, p_header->key_length, hash, &slot);
+    if (found < 0)
+    {
+        return -1;
+    }
+
+    if (0 != found)
+    {
+        release_record(&g_index[slot]);
+    }
+
+    if (RECORD_TOMBSTONE == p_header->flags)
+    {
+        if (0 != found)
+        {
+            remove_entry(slot);
+            g_nb_keys--;
+        }
+        return 0;
+    }
+
+    if (0 == found)
+    {
+        if (g_nb_keys >= FLASH_KV_MAX_KEYS)
+        {
+            return 0;
+        }
+        g_nb_keys++;
+    }
+
+    g_index[slot].hash = hash;
+    g_index[slot].address = address;
+    g_index[slot].key_length = p_header->key_length;
+    g_index[slot].value_length = p_header->value_length;
+
+    g_sectors[sector_of(address)].live +=
+        record_size(p_header->key_length, p_header->value_length);
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------
+ * Read the record at an offset of a sector into g_scan.
+ */
+static record_status_t
+read_record
+(
+    uint32_t sector,
+    uint32_t offset,
+    uint32_t * p_size
+)
+{
+    record_header_t header;
+    uint32_t address = sector_address(sector) + offset;
+    uint32_t size;
+
+    if ((offset + RECORD_HEADER_SIZE) > FLASH_KV_SECTOR_SIZE)
+    {
+        return RECORD_END;
+    }
+
+    if (0 != flash_cache_read(address, &header, RECORD_HEADER_SIZE))
+    {
+        return RECORD_BAD;
+    }
+
+    if (RECORD_BLANK == header.flags)
+    {
+        /* The log ends here, provided nothing was programmed after the
+         * flags. */
+        if ((0xFFu == header.key_length) && (0xFFFFu == header.value_length) &&
+            (0xFFFFFFFFu == header.crc))
+        {
+            return RECORD_END;
+        }
+        return RECORD_BAD;
+    }
+
+    if (((RECORD_VALUE != header.flags) && (RECORD_TOMBSTONE != header.flags)) ||
+        (0u == header.key_length) ||
+        (header.key_length > FLASH_KV_MAX_KEY_LENGTH) ||
+        (header.value_length > FLASH_KV_MAX_VALUE_LENGTH) ||
+        ((RECORD_TOMBSTONE == header.flags) && (0u != header.value_length)))
+    {
+        return RECORD_BAD;
+    }
+
+    size = record_size(header.key_length, header.value_length);
+    if ((offset + size) > FLASH_KV_SECTOR_SIZE)
+    {
+        return RECORD_BAD;
+    }
+
+    *p_size = size;
+
+    MRV_memcpy(g_scan, &header, RECORD_HEADER_SIZE);
+    if (0 != flash_cache_read(address + RECORD_HEADER_SIZE,
+                              &g_scan[RECORD_HEADER_SIZE],
+                              (uint32_t)header.key_length + header.value_length))
+    {
+        return RECORD_BAD;
+    }
+
+    return (header.crc == record_crc(g_scan)) ? RECORD_OK : RECORD_TORN;
+}
+
+/*------------------------------------------------------------------------------
+ * Rebuild the index entries of the records of a sector, in the order they
+ * were written, and find the end of its log.
+ */
+static int scan_sector(uint32_t sector)
+{
+    uint32_t offset = SECTOR_HEADER_SIZE;
+
+    for (;;)
+    {
+        uint32_t size = 0u;
+        record_status_t status = read_record(sector, offset, &size);
+
+        if (RECORD_END == status)
+        {
+            break;
+        }
+
+        if (RECORD_BAD == status)
+        {
+            /* Nothing more is written to this sector. */
+            offset = FLASH_KV_SECTOR_SIZE;
+            break;
+        }
+
+        if (RECORD_OK == status)
+        {
+            if (0 != apply_record(g_scan, sector_address(sector) + offset))
+            {
+                return -1;
+            }
+        }
+
+        offset += size;
+    }
+
+    g_sectors[sector].end = offset;
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------
+ * Make the next free sector of the ring, in address order, the head.
+ */
+static flash_kv_status_t open_head(void)
+{
+    sector_header_t header;
+    uint32_t sector = g_head;
+    uint32_t count;
+
+    for (count = 0u; count < g_nb_sectors; count++)
+    {
+        sector = (sector + 1u) % g_nb_sectors;
+        if (0u == g_sectors[sector].used)
+        {
+            break;
+        }
+    }
+
+    if (0u != g_sectors[sector].used)
+    {
+        return FLASH_KV_FULL;
+    }
+
+    /* Free sectors are normally erased by the compaction. This erases the
+     * ones left programmed by a power failure. */
+    if (SPI_FLASH_SUCCESS != spi_flash_erase_range(sector_address(sector),
+                                                   FLASH_KV_SECTOR_SIZE,
+                                                   SPI_FLASH_ERASE_SKIP_BLANK,
+                                                   0))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    header.magic = SECTOR_MAGIC;
+    header.seq = g_next_seq;
+    header.crc = boot_image_crc32(0u, (const uint8_t *)&header, 8u);
+    header.obsolete = SECTOR_IN_USE;
+
+    if (SPI_FLASH_SUCCESS != spi_flash_write(sector_address(sector),
+                                             (uint8_t *)&header,
+                                             SECTOR_HEADER_SIZE))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    g_sectors[sector].seq = g_next_seq;
+    g_sectors[sector].end = SECTOR_HEADER_SIZE;
+    g_sectors[sector].live = 0u;
+    g_sectors[sector].used = 1u;
+
+    g_head = sector;
+    g_next_seq++;
+    g_nb_used++;
+
+    return FLASH_KV_OK;
+}
+
+/*------------------------------------------------------------------------------
+ * Append a record to the head, opening a new head when it is full as long as
+ * reserve free sectors remain afterwards.
+ */
+static flash_kv_status_t
+append_record
+(
+    uint8_t * p_record,
+    uint32_t size,
+    uint32_t reserve,
+    uint32_t * p_address
+)
+{
+    sector_info_t * p_head = &g_sectors[g_head];
+    uint32_t address;
+
+    if ((p_head->end + size) > FLASH_KV_SECTOR_SIZE)
+    {
+        flash_kv_status_t status;
+
+        if ((g_nb_sectors - g_nb_used) <= reserve)
+        {
+            return FLASH_KV_FULL;
+        }
+
+        status = open_head();
+        if (FLASH_KV_OK != status)
+        {
+            return status;
+        }
+        p_head = &g_sectors[g_head];
+    }
+
+    address = sector_address(g_head) + p_head->end;
+
+    /* The space is used even if the write fails part way. */
+    p_head->end += size;
+
+    if (SPI_FLASH_SUCCESS != spi_flash_write(address, p_record, size))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    *p_address = address;
+
+    return FLASH_KV_OK;
+}
+
+/*------------------------------------------------------------------------------
+ * Return the sector with the lowest sequence number.
+ */
+static uint32_t oldest_sector(void)
+{
+    uint32_t oldest = g_head;
+    uint32_t sector;
+
+    for (sector = 0u; sector < g_nb_sectors; sector++)
+    {
+        if ((0u != g_sectors[sector].used) &&
+            (g_sectors[sector].seq < g_sectors[oldest].seq))
+        {
+            oldest = sector;
+        }
+    }
+
+    return oldest;
+}
+
+/*------------------------------------------------------------------------------
+ * Copy the records of the oldest sector holding the value of a key to the
+ * head, then erase it. Tombstones are dropped: the oldest sector holds the
+ * oldest records, so no older record of their key remains after the erase.
+ */
+static flash_kv_status_t compact_oldest(void)
+{
+    uint32_t sector = oldest_sector();
+    uint32_t offset = SECTOR_HEADER_SIZE;
+    uint32_t obsolete = 0u;
+
+    if (sector == g_head)
+    {
+        return FLASH_KV_FULL;
+    }
+
+    while (offset < g_sectors[sector].end)
+    {
+        uint32_t size = 0u;
+        record_status_t status = read_record(sector, offset, &size);
+
+        if ((RECORD_END == status) || (RECORD_BAD == status))
+        {
+            break;
+        }
+
+        if ((RECORD_OK == status) && (RECORD_VALUE == g_scan[0]))
+        {
+            uint32_t address = sector_address(sector) + offset;
+            uint32_t key_length = g_scan[1];
+            uint32_t slot;
+            int found;
+
+            found = find_key(&g_scan[RECORD_HEADER_SIZE],
+                             key_length,
+                             hash_key(&g_scan[RECORD_HEADER_SIZE], key_length),
+                             &slot);
+            if (found < 0)
+            {
+                return FLASH_KV_FLASH_ERROR;
+            }
+
+            if ((0 != found) && (address == g_index[slot].address))
+            {
+                flash_kv_status_t result;
+                uint32_t new_address;
+
+                /* Compaction may use the last free sector. */
+                result = append_record(g_scan, size, 0u, &new_address);
+                if (FLASH_KV_OK != result)
+                {
+                    return result;
+                }
+
+                release_record(&g_index[slot]);
+                g_index[slot].address = new_address;
+                g_sectors[g_head].live += size;
+            }
+        }
+
+        offset += size;
+    }
+
+    /* Once marked obsolete, the sector is ignored even if the erase is
+     * interrupted. */
+    if (SPI_FLASH_SUCCESS != spi_flash_write(sector_address(sector) + SECTOR_OBSOLETE_OFFSET,
+                                             (uint8_t *)&obsolete,
+                                             sizeof(obsolete)))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    g_sectors[sector].used = 0u;
+    g_nb_used--;
+    g_compactions++;
+
+    if (SPI_FLASH_SUCCESS != spi_flash_erase_range(sector_address(sector),
+                                                   FLASH_KV_SECTOR_SIZE,
+                                                   0u,
+                                                   0))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    return FLASH_KV_OK;
+}
+
+/*------------------------------------------------------------------------------
+ * Write a record built in g_record, compacting sectors when the ring has no
+ * room left for it. One free sector is kept for the compaction.
+ */
+static flash_kv_status_t write_record(uint32_t size, uint32_t * p_address)
+{
+    uint32_t attempts;
+
+    for (attempts = 0u; attempts <= g_nb_sectors; attempts++)
+    {
+        flash_kv_status_t status;
+
+        status = append_record(g_record, size, 1u, p_address);
+        if (FLASH_KV_FULL != status)
+        {
+            return status;
+        }
+
+        status = compact_oldest();
+        if (FLASH_KV_OK != status)
+        {
+            return status;
+        }
+    }
+
+    return FLASH_KV_FULL;
+}
+
+/*------------------------------------------------------------------------------
+ * Check a key and return its length, or 0 when it is invalid.
+ */
+static uint32_t check_key(const char * p_key)
+{
+    uint32_t length = 0u;
+
+    if (0 == p_key)
+    {
+        return 0u;
+    }
+
+    while ('\0' != p_key[length])
+    {
+        length++;
+        if (length > FLASH_KV_MAX_KEY_LENGTH)
+        {
+            return 0u;
+        }
+    }
+
+    return length;
+}
+
+/*------------------------------------------------------------------------------
+ * Build a record in g_record and return its size.
+ */
+static uint32_t
+build_record
+(
+    uint8_t flags,
+    const char * p_key,
+    uint32_t key_len,
+    const void * p_value,
+    uint32_t length
+)
+{
+    record_header_t * p_header = (record_header_t *)g_record;
+    uint32_t size = record_size(key_len, length);
+
+    MRV_memset(g_record, 0xFF, size);
+
+    p_header->flags = flags;
+    p_header->key_length = (uint8_t)key_len;
+    p_header->value_length = (uint16_t)length;
+
+    MRV_memcpy(&g_record[RECORD_HEADER_SIZE], p_key, key_len);
+    if (0u != length)
+    {
+        MRV_memcpy(&g_record[RECORD_HEADER_SIZE + key_len], p_value, length);
+    }
+
+    p_header->crc = record_crc(g_record);
+
+    return size;
+}
+
+/***************************************************************************//**
+ * flash_kv_init()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+flash_kv_status_t flash_kv_init(uint32_t base_address, uint32_t nb_sectors)
+{
+    uint8_t order[FLASH_KV_MAX_SECTORS];
+    uint32_t sector;
+    uint32_t idx;
+
+    g_mounted = 0u;
+
+    if ((nb_sectors < 3u) || (nb_sectors > FLASH_KV_MAX_SECTORS) ||
+        (0u != (base_address % FLASH_KV_SECTOR_SIZE)))
+    {
+        return FLASH_KV_INVALID;
+    }
+
+    g_base_address = base_address;
+    g_nb_sectors = nb_sectors;
+    g_nb_used = 0u;
+    g_head = 0u;
+    g_next_seq = 0u;
+    g_nb_keys = 0u;
+    g_compactions = 0u;
+
+    /* Live records must fit in all the sectors but the one kept for the
+     * compaction, with a record size lost at the end of each sector, and
+     * leave room for a tombstone so keys can still be deleted. */
+    g_capacity = ((nb_sectors - 1u) *
+                  (FLASH_KV_SECTOR_SIZE - SECTOR_HEADER_SIZE - RECORD_MAX_SIZE)) -
+                 record_size(FLASH_KV_MAX_KEY_LENGTH, 0u);
+
+    MRV_memset(g_sectors, 0, sizeof(g_sectors));
+    MRV_memset(g_index, 0, sizeof(g_index));
+
+    /* Find the sectors of the ring and sort them from the oldest. */
+    for (sector = 0u; sector < nb_sectors; sector++)
+    {
+        sector_header_t header;
+
+        if (0 != flash_cache_read(sector_address(sector), &header, SECTOR_HEADER_SIZE))
+        {
+            return FLASH_KV_FLASH_ERROR;
+        }
+
+        if ((SECTOR_MAGIC != header.magic) || (SECTOR_IN_USE != header.obsolete) ||
+            (header.crc != boot_image_crc32(0u, (const uint8_t *)&header, 8u)))
+        {
+            continue;
+        }
+
+        g_sectors[sector].seq = header.seq;
+        g_sectors[sector].used = 1u;
+
+        idx = g_nb_used;
+        while ((idx > 0u) && (g_sectors[order[idx - 1u]].seq > header.seq))
+        {
+            order[idx] = order[idx - 1u];
+            idx--;
+        }
+        order[idx] = (uint8_t)sector;
+        g_nb_used++;
+    }
+
+    /* Replay the records from the oldest, the last one of a key wins. */
+    for (idx = 0u; idx < g_nb_used; idx++)
+    {
+        if (0 != scan_sector(order[idx]))
+        {
+            return FLASH_KV_FLASH_ERROR;
+        }
+    }
+
+    if (0u == g_nb_used)
+    {
+        /* Empty store: open_head() starts after the head. */
+        g_head = nb_sectors - 1u;
+        if (FLASH_KV_OK != open_head())
+        {
+            return FLASH_KV_FLASH_ERROR;
+        }
+    }
+    else
+    {
+        g_head = order[g_nb_used - 1u];
+        g_next_seq = g_sectors[g_head].seq + 1u;
+    }
+
+    g_mounted = 1u;
+
+    return FLASH_KV_OK;
+}
+
+/***************************************************************************//**
+ * flash_kv_set()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+flash_kv_status_t
+flash_kv_set
+(
+    const char * p_key,
+    const void * p_value,
+    uint32_t length
+)
+{
+    uint32_t key_len = check_key(p_key);
+    uint32_t hash;
+    uint32_t slot;
+    uint32_t size;
+    uint32_t address;
+    flash_kv_status_t status;
+    int found;
+
+    if ((0u == g_mounted) || (0u == key_len) ||
+        (length > FLASH_KV_MAX_VALUE_LENGTH) || ((0 == p_value) && (0u != length)))
+    {
+        return FLASH_KV_INVALID;
+    }
+
+    hash = hash_key((const uint8_t *)p_key, key_len);
+    found = find_key((const uint8_t *)p_key, key_len, hash, &slot);
+    if (found < 0)
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    if (0 == found)
+    {
+        if (g_nb_keys >= FLASH_KV_MAX_KEYS)
+        {
+            return FLASH_KV_FULL;
+        }
+    }
+    else if (length == g_index[slot].value_length)
+    {
+        /* Do not rewrite a value which does not change. */
+        int match = flash_matches(g_index[slot].address + RECORD_HEADER_SIZE + key_len,
+                                  (const uint8_t *)p_value,
+                                  length);
+        if (match < 0)
+        {
+            return FLASH_KV_FLASH_ERROR;
+        }
+        if (0 != match)
+        {
+            return FLASH_KV_OK;
+        }
+    }
+
+    size = build_record(RECORD_VALUE, p_key, key_len, p_value, length);
+    if ((live_bytes() + size -
+         ((0 != found) ? record_size(key_len, g_index[slot].value_length) : 0u)) > g_capacity)
+    {
+        return FLASH_KV_FULL;
+    }
+
+    status = write_record(size, &address);
+    if (FLASH_KV_OK != status)
+    {
+        return status;
+    }
+
+    /* The compaction may have moved the previous record of the key. */
+    return (0 == apply_record(g_record, address)) ? FLASH_KV_OK : FLASH_KV_FLASH_ERROR;
+}
+
+/***************************************************************************//**
+ * flash_kv_get()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+flash_kv_status_t
+flash_kv_get
+(
+    const char * p_key,
+    void * p_value,
+    uint32_t size,
+    uint32_t * p_length
+)
+{
+    uint32_t key_len = check_key(p_key);
+    const index_entry_t * p_entry;
+    uint32_t slot;
+    int found;
+
+    if ((0u == g_mounted) || (0u == key_len) || ((0 == p_value) && (0u != size)))
+    {
+        return FLASH_KV_INVALID;
+    }
+
+    found = find_key((const uint8_t *)p_key, key_len,
+                     hash_key((const uint8_t *)p_key, key_len), &slot);
+    if (found < 0)
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+    if (0 == found)
+    {
+        return FLASH_KV_NOT_FOUND;
+    }
+
+    p_entry = &g_index[slot];
+    if (size > p_entry->value_length)
+    {
+        size = p_entry->value_length;
+    }
+
+    if ((0u != size) &&
+        (0 != flash_cache_read(p_entry->address + RECORD_HEADER_SIZE + key_len,
+                               p_value,
+                               size)))
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+
+    if (0 != p_length)
+    {
+        *p_length = p_entry->value_length;
+    }
+
+    return FLASH_KV_OK;
+}
+
+/***************************************************************************//**
+ * flash_kv_delete()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+flash_kv_status_t flash_kv_delete(const char * p_key)
+{
+    uint32_t key_len = check_key(p_key);
+    uint32_t slot;
+    uint32_t size;
+    uint32_t address;
+    flash_kv_status_t status;
+    int found;
+
+    if ((0u == g_mounted) || (0u == key_len))
+    {
+        return FLASH_KV_INVALID;
+    }
+
+    found = find_key((const uint8_t *)p_key, key_len,
+                     hash_key((const uint8_t *)p_key, key_len), &slot);
+    if (found < 0)
+    {
+        return FLASH_KV_FLASH_ERROR;
+    }
+    if (0 == found)
+    {
+        return FLASH_KV_NOT_FOUND;
+    }
+
+    size = build_record(RECORD_TOMBSTONE, p_key, key_len, 0, 0u);
+    status = write_record(size, &address);
+    if (FLASH_KV_OK != status)
+    {
+        return status;
+    }
+
+    return (0 == apply_record(g_record, address)) ? FLASH_KV_OK : FLASH_KV_FLASH_ERROR;
+}
+
+/***************************************************************************//**
+ * flash_kv_process()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+uint8_t flash_kv_process(void)
+{
+    uint32_t oldest;
+
+    if ((0u == g_mounted) || ((g_nb_sectors - g_nb_used) >= FLASH_KV_SPARE_SECTORS))
+    {
+        return 0u;
+    }
+
+    /* Compacting a sector only holding current values frees no space. */
+    oldest = oldest_sector();
+    if ((oldest == g_head) ||
+        ((g_sectors[oldest].end - SECTOR_HEADER_SIZE) == g_sectors[oldest].live))
+    {
+        return 0u;
+    }
+
+    return (FLASH_KV_OK == compact_oldest()) ? 1u : 0u;
+}
+
+/***************************************************************************//**
+ * flash_kv_get_stats()
+ * See "flash_kv.h" for details of how to use this function.
+ */
+void flash_kv_get_stats(flash_kv_stats_t * p_stats)
+{
+    p_stats->nb_keys = g_nb_keys;
+    p_stats->live_bytes = live_bytes();
+    p_stats->free_sectors = g_nb_sectors - g_nb_used;
+    p_stats->compactions = g_compactions;
+}
+
+#ifdef __cplusplus
+}
+#endif
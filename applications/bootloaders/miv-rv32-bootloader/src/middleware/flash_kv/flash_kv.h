@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_kv.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Log-structured key-value store on the SPI flash.
+ *
+ */
+
+/*=========================================================================*//**
+  Flash Key-Value Store
+  =======================================
+  Settings kept at a fixed place in the SPI flash, like the flash_content_t
+  block of the bootloader, cost a 4KB erase each time they change, always of
+  the same block. This module stores named values in a log instead:
+
+    - the store is a ring of FLASH_KV_SECTOR_SIZE sectors. Each sector starts
+      with a header holding a sequence number, giving the order of the
+      sectors in the ring,
+    - setting or deleting a key appends a record to the newest sector, the
+      head. Nothing is erased until a sector is compacted,
+    - when the head is full, the next free sector becomes the head,
+    - compaction copies the records of the oldest sector which still hold
+      the current value of their key to the head, then erases the oldest
+      sector, which becomes free. Every sector is erased in turn, so the
+      erases are spread evenly over the ring, including the sectors holding
+      values which never change,
+    - an index in RAM maps each key to the address of its current record, so
+      a lookup reads a single record.
+
+  --------------------------------
+  Power failure
+  --------------------------------
+  Each record holds a CRC-32 of its content. A record is only taken into
+  account once it is completely programmed: a record interrupted by a power
+  failure fails its CRC and is ignored when the store is mounted, and the
+  previous value of the key is kept. The space it takes is not reused.
+
+  A compacted sector is marked obsolete before it is erased, so the records
+  it holds are ignored even when its erase is interrupted. Records copied
+  twice, when a compaction is interrupted, are the same and the newest copy
+  is used.
+
+  --------------------------------
+  Compaction
+  --------------------------------
+  One sector is always kept free, so a compaction always has room to copy the
+  records of the oldest sector. flash_kv_set() and flash_kv_delete()
+  compact sectors themselves when a new head is needed and no other sector is
+  free. flash_kv_process(), called from the main loop, compacts ahead of time,
+  while fewer than FLASH_KV_SPARE_SECTORS sectors are free and the oldest
+  sector holds outdated records, so writes rarely wait for an erase.
+
+  --------------------------------
+  Example
+  --------------------------------
+      spi_flash_init(FLASH_CORE_SPI_BASE);
+      flash_cache_init();
+      flash_kv_init(KV_BASE_ADDR, 8u);
+
+      flash_kv_set("boot_count", &count, sizeof(count));
+      flash_kv_get("boot_count", &count, sizeof(count), &length);
+
+      while (1)
+      {
+          flash_kv_process();
+      }
+
+  The records are read through flash_cache_read(), so flash_cache_init() must
+  be called before flash_kv_init().
+
+ *//*=========================================================================*/
+#ifndef FLASH_KV_H
+#define FLASH_KV_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Size of a sector of the store, a multiple of the 4KB flash erase block.
+ */
+#ifndef FLASH_KV_SECTOR_SIZE
+#define FLASH_KV_SECTOR_SIZE            4096u
+#endif
+
+/*
+ * Maximum number of sectors, of keys, and of key and value lengths.
+ */
+#ifndef FLASH_KV_MAX_SECTORS
+#define FLASH_KV_MAX_SECTORS            16u
+#endif
+
+#ifndef FLASH_KV_MAX_KEYS
+#define FLASH_KV_MAX_KEYS               64u
+#endif
+
+#ifndef FLASH_KV_MAX_KEY_LENGTH
+#define FLASH_KV_MAX_KEY_LENGTH         32u
+#endif
+
+#ifndef FLASH_KV_MAX_VALUE_LENGTH
+#define FLASH_KV_MAX_VALUE_LENGTH       256u
+#endif
+
+/*
+ * Number of free sectors flash_kv_process() keeps ahead of the writes.
+ */
+#ifndef FLASH_KV_SPARE_SECTORS
+#define FLASH_KV_SPARE_SECTORS          2u
+#endif
+
+#if FLASH_KV_MAX_KEY_LENGTH > 255
+#error FLASH_KV_MAX_KEY_LENGTH must not be greater than 255
+#endif
+
+/***************************************************************************//**
+  Status returned by the functions of the store.
+ */
+typedef enum
+{
+    FLASH_KV_OK = 0,
+    FLASH_KV_NOT_FOUND,                 /* the key is not in the store     */
+    FLASH_KV_INVALID,                   /* invalid key, value or settings  */
+    FLASH_KV_FULL,                      /* no room left for the record     */
+    FLASH_KV_FLASH_ERROR                /* the flash could not be accessed */
+} flash_kv_status_t;
+
+/***************************************************************************//**
+  Store statistics.
+ */
+typedef struct
+{
+    uint32_t nb_keys;                   /* keys in the store                */
+    uint32_t live_bytes;                /* size of their current records    */
+    uint32_t free_sectors;              /* erased sectors                   */
+    uint32_t compactions;               /* sectors compacted since the init */
+} flash_kv_stats_t;
+
+/***************************************************************************//**
+  The flash_kv_init() function mounts the store: it reads the sector headers
+  and rebuilds the index from the records. A blank area is mounted as an empty
+  store.
+
+  @param base_address
+  Address of the store in the flash, aligned on FLASH_KV_SECTOR_SIZE.
+
+  @param nb_sectors
+  Number of sectors of the store, from 3 to FLASH_KV_MAX_SECTORS.
+
+  @return
+  This function returns FLASH_KV_OK, FLASH_KV_INVALID when the settings are
+  invalid or FLASH_KV_FLASH_ERROR.
+ */
+flash_kv_status_t flash_kv_init(uint32_t base_address, uint32_t nb_sectors);
+
+/***************************************************************************//**
+  The flash_kv_set() function sets the value of a key, adding the key when it
+  is not in the store. The value is committed when the function returns.
+
+  @param p_key
+  Key, a nul terminated string of 1 to FLASH_KV_MAX_KEY_LENGTH characters.
+
+  @param p_value
+  Value.
+
+  @param length
+  Length of the value in bytes, up to FLASH_KV_MAX_VALUE_LENGTH.
+
+  @return
+  This function returns FLASH_KV_OK, FLASH_KV_INVALID, FLASH_KV_FULL when the
+  store has no room for the value or FLASH_KV_MAX_KEYS keys, or
+  FLASH_KV_FLASH_ERROR.
+ */
+flash_kv_status_t
+flash_kv_set
+(
+    const char * p_key,
+    const void * p_value,
+    uint32_t length
+);
+
+/***************************************************************************//**
+  The flash_kv_get() function reads the value of a key.
+
+  @param p_key
+  Key.
+
+  @param p_value
+  Buffer receiving the value.
+
+  @param size
+  Size of the buffer. Longer values are truncated.
+
+  @param p_length
+  Receives the length of the value, or null (0).
+
+  @return
+  This function returns FLASH_KV_OK, FLASH_KV_NOT_FOUND, FLASH_KV_INVALID or
+  FLASH_KV_FLASH_ERROR.
+ */
+flash_kv_status_t
+flash_kv_get
+(
+    const char * p_key,
+    void * p_value,
+    uint32_t size,
+    uint32_t * p_length
+);
+
+/***************************************************************************//**
+  The flash_kv_delete() function removes a key from the store.
+
+  @return
+  This function returns FLASH_KV_OK, FLASH_KV_NOT_FOUND, FLASH_KV_INVALID,
+  FLASH_KV_FULL or FLASH_KV_FLASH_ERROR.
+ */
+flash_kv_status_t flash_kv_delete(const char * p_key);
+
+/***************************************************************************//**
+  The flash_kv_process() function compacts the oldest sector when fewer than
+  FLASH_KV_SPARE_SECTORS sectors are free and the oldest sector holds
+  outdated records. It compacts at most one sector per call.
+
+  @return
+  This function returns 1 when a sector was compacted, 0 otherwise.
+ */
+uint8_t flash_kv_process(void);
+
+/***************************************************************************//**
+  The flash_kv_get_stats() function returns the store statistics.
+ */
+void flash_kv_get_stats(flash_kv_stats_t * p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FLASH_KV_H */
@@ -33,12 +33,12 @@
 #include "sf2_bl_defs.h"
 #else
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
 #endif
 #include "ymodem.h"
 
 
 extern UART_instance_t g_uart;
-extern volatile uint32_t g_10ms_count;
 
 static uint8_t packet_data[PACKET_1K_SIZE + PACKET_OVERHEAD];
 static int32_t  packet_length;
@@ -182,13 +182,7 @@ void sf2bl_ymodem_deinit(void)
 static void _sleep(uint32_t seconds_delay)
 
 {
-    uint32_t start_time;
-
-    start_time = g_10ms_count; /* record starting point */
-    seconds_delay *= 1000;     /* Convert to ms */
-
-    while((g_10ms_count - start_time) < seconds_delay)
-        ;
+    MRV_delay_ms(seconds_delay * 1000u);
 }
 
 /***************************************************************************//**
@@ -196,7 +190,7 @@ static void _sleep(uint32_t seconds_delay)
  */
 static int32_t _getchar(int32_t timeout)
 {
-    uint32_t start_time;
+    mrv_deadline_t deadline;
     uint8_t  rx_byte;
     int32_t  done;
     int32_t received;
@@ -228,8 +222,7 @@ static int32_t _getchar(int32_t timeout)
     }
     else if(timeout > 0) /* time limited mode */
     {
-        start_time = g_10ms_count; /* record starting point */
-        timeout *= 1000;           /* Convert timeout to ms */
+        MRV_deadline_set_ms(&deadline, (uint32_t)timeout * 1000u);
         while(!done)
         {
 #ifndef RTG4_DEMO
@@ -248,7 +241,7 @@ static int32_t _getchar(int32_t timeout)
                 }
             }
 
-           if((g_10ms_count) >= start_time + timeout)
+           if(MRV_deadline_expired(&deadline))
            {
                 /* Timed out so exit with ret_value == -1 */
                 done = 1;
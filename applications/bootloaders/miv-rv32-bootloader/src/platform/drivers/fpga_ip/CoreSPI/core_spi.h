@@ -203,6 +203,56 @@
   subsequent SPI transactions. A call to this function is only required if
   the master is communicating with multiple slave devices.
 
+  -------------------------------------------------
+  SPI Master Interrupt Driven Block Transfer Control
+  -------------------------------------------------
+  SPI_transfer_block() keeps the processor polling the receive FIFO for the
+  whole transfer. For long transfers, such as reading several kilobytes from
+  an SPI flash, SPI_transfer_block_async() performs the same transfer from the
+  CoreSPI interrupt and returns straight away:
+    •   SPI_transfer_block_async()
+    •   SPI_is_transfer_busy()
+    •   SPI_isr()
+
+  SPI_transfer_block_async() loads the transmit FIFO and enables the receive
+  data interrupt. Each time SPI_isr() is called it empties the receive FIFO
+  into the receive buffer and refills the transmit FIFO with as many frames as
+  were received, so that no more than fifo_depth frames are ever in flight and
+  the receive FIFO cannot overflow. The last frame is written to the TXLAST
+  register, as with SPI_transfer_block(), so the slave select behaves the same
+  way. When the last frame has been received the interrupt is disabled and the
+  completion handler passed to SPI_transfer_block_async() is called from
+  SPI_isr().
+
+  The CoreSPI interrupt output must be connected to a processor interrupt
+  whose handler calls SPI_isr(). The buffers must remain valid until the
+  transfer is complete. Starting another interrupt driven transfer fails while
+  one is in progress, and the polled transfer functions wait for its end, so
+  they must not be called with the CoreSPI interrupt masked.
+
+  -------------------------------------------------
+  SPI Master Scatter-Gather Transfer Control
+  -------------------------------------------------
+  SPI_transfer_block() sends a single contiguous command buffer, so a command
+  followed by a data payload held elsewhere, such as an SPI flash page program,
+  has to be copied into a staging buffer first. The following functions
+  describe the transfer as a list of segments instead, streamed one after the
+  other without deselecting the slave:
+    •   SPI_transfer_segments()
+    •   SPI_transfer_segments_async()
+
+  Each spi_segment_t segment transfers size frames. Frames are sent from its
+  tx_buffer, or are 0s when tx_buffer is null, and received frames are stored
+  in its rx_buffer, or discarded when rx_buffer is null. Command, address and
+  payload segments have a tx_buffer only, dummy segments have neither buffer
+  and read segments have an rx_buffer only. The last frame of the last segment
+  is written to TXLAST.
+
+  SPI_transfer_segments() waits for the end of the transfer.
+  SPI_transfer_segments_async() works like SPI_transfer_block_async(): the
+  transfer is performed by SPI_isr() and the segment list, as well as the
+  buffers it points to, must remain valid until it is complete.
+
   -------------------------------------
   SPI Slave Frame Transfer Control
   -------------------------------------  
@@ -358,6 +408,21 @@ typedef void (*spi_frame_rx_handler_t)( uint32_t rx_frame );
  */
 typedef void (*spi_block_rx_handler_t)( uint8_t * rx_buff, uint32_t rx_size );
 
+/***************************************************************************//**
+  This defines the function prototype that must be followed by the SPI master
+  transfer completion handler functions. These functions are registered with
+  the SPI driver through the SPI_transfer_block_async() function and called
+  from SPI_isr() once the transfer is complete.
+
+  Declaring and Implementing Transfer Completion Handler Functions:
+     Transfer completion handler functions should follow the following
+     prototype:
+         void spi_xfer_done_handler ( spi_instance_t * this_spi );
+     The this_spi parameter identifies the CoreSPI instance which completed
+     the transfer. A new transfer can be started from the handler.
+ */
+typedef void (*spi_xfer_done_handler_t)( spi_instance_t * this_spi );
+
 /***************************************************************************//**
  This enumeration is used to select a specific SPI slave device (0 to 7). It is
  used as a parameter to the SPI_configure_master_mode(), SPI_set_slave_select(),
@@ -387,6 +452,17 @@ typedef enum __spi_sxfer_mode_t
     SPI_SLAVE_XFER_FRAME = 2  /* Single frame transfers */
 } spi_sxfer_mode_t;
 
+/***************************************************************************//**
+  The spi_segment_t structure describes one segment of a transfer performed by
+  SPI_transfer_segments() or SPI_transfer_segments_async().
+ */
+typedef struct __spi_segment_t
+{
+    const uint8_t * tx_buffer;           /* Frames to send, or null (0) to send 0s */
+    uint8_t * rx_buffer;                 /* Received frames, or null (0) to discard them */
+    uint32_t size;                       /* Number of frames of the segment */
+} spi_segment_t;
+
 /***************************************************************************//**
   There is one instance of this structure for each of the core SPIs. Instances
   of this structure are used to identify a specific SPI. A pointer to an
@@ -435,6 +511,20 @@ struct spi_instance{
 
     /* How we are expecting to deal with slave transfers */
     spi_sxfer_mode_t slave_xfer_mode;    /* Current slave mode transfer configuration */
+
+    /* Master segment and interrupt driven block transfers: */
+    const spi_segment_t * xfer_segs;     /* Segments of the transfer */
+    uint32_t xfer_nb_segs;               /* Number of segments */
+    spi_segment_t xfer_block_segs[2];    /* Segments of SPI_transfer_block_async() */
+    uint32_t xfer_size;                  /* Total number of frames of the transfer */
+    uint32_t xfer_tx_idx;                /* Number of frames written to the TX FIFO */
+    uint32_t xfer_tx_seg;                /* Segment of the next frame to write */
+    uint32_t xfer_tx_off;                /* Offset of the next frame to write in its segment */
+    uint32_t xfer_rx_idx;                /* Number of frames read from the RX FIFO */
+    uint32_t xfer_rx_seg;                /* Segment of the next frame to read */
+    uint32_t xfer_rx_off;                /* Offset of the next frame to read in its segment */
+    spi_xfer_done_handler_t xfer_done_handler; /* Called from SPI_isr() at the end of the transfer */
+    volatile uint8_t xfer_busy;          /* Set while a transfer is in progress */
 };
 
 /*------------------------Public Function-------------------------------------*/
@@ -820,6 +910,175 @@ void SPI_transfer_block_store_all_resp
     uint8_t * cmd_response_buffer
 );
 
+/***************************************************************************//**
+  The SPI_transfer_block_async() function starts the same transfer as
+  SPI_transfer_block(), a command followed by the reading of a block of data,
+  and returns without waiting for it. The rest of the transfer is performed
+  by SPI_isr(), in bursts of up to fifo_depth frames, and the completion
+  handler is called from SPI_isr() once the last frame has been received.
+  Transfers are not limited to 16 bit sizes.
+
+  @param this_spi
+  The this_spi parameter is a pointer to a spi_instance_t structure that identifies
+  the CoreSPI hardware block to operate on. This parameter must point to
+  a g_core_spi global data structure defined within the application code.
+
+  @param cmd_buffer
+  The cmd_buffer parameter is a pointer to the buffer holding the bytes sent
+  at the start of the transfer. It must remain valid until the transfer is
+  complete. This pointer can be null (0) if cmd_byte_size is 0.
+
+  @param cmd_byte_size
+  The cmd_byte_size parameter specifies the number of bytes of cmd_buffer.
+
+  @param rx_buffer
+  The rx_buffer parameter is a pointer to the buffer receiving the bytes read
+  from the slave after the command. This pointer can be null (0) if
+  rx_byte_size is 0.
+
+  @param rx_byte_size
+  The rx_byte_size parameter specifies the number of bytes to read.
+
+  @param done_handler
+  The done_handler parameter is the function called from SPI_isr() when the
+  transfer is complete, or null (0) if SPI_is_transfer_busy() is polled
+  instead.
+
+  @return
+  This function returns 1 when the transfer is started, or 0 when nothing is
+  done because a transfer is already in progress, the CoreSPI instance is not
+  a master or the transfer is empty.
+
+  @example
+  @code
+      static uint8_t g_read_cmd[4];
+      static uint8_t g_page_buffer[4096];
+
+      void MSYS_EI3_IRQHandler( void )
+      {
+          SPI_isr( &g_spi0 );
+      }
+
+      static void read_done( spi_instance_t * this_spi )
+      {
+          g_read_done = 1u;
+      }
+
+      g_read_cmd[0] = 0x03u;
+      ...
+      SPI_transfer_block_async( &g_spi0, g_read_cmd, sizeof(g_read_cmd),
+                                g_page_buffer, sizeof(g_page_buffer),
+                                read_done );
+  @endcode
+ */
+uint8_t SPI_transfer_block_async
+(
+    spi_instance_t * this_spi,
+    const uint8_t * cmd_buffer,
+    uint32_t cmd_byte_size,
+    uint8_t * rx_buffer,
+    uint32_t rx_byte_size,
+    spi_xfer_done_handler_t done_handler
+);
+
+/***************************************************************************//**
+  The SPI_transfer_segments() function performs a transfer made of a list of
+  segments, such as a command, an address, a payload, dummy frames and a read,
+  streaming each segment directly from or to its own buffer. The slave is not
+  deselected between segments. This function returns at the end of the
+  transfer.
+
+  @param this_spi
+  The this_spi parameter is a pointer to a spi_instance_t structure that identifies
+  the CoreSPI hardware block to operate on. This parameter must point to
+  a g_core_spi global data structure defined within the application code.
+
+  @param segments
+  The segments parameter is a pointer to an array of spi_segment_t structures
+  describing the segments, in transfer order. Segments of size 0 are skipped.
+
+  @param nb_segments
+  The nb_segments parameter specifies the number of segments.
+
+  @return
+  This function returns 1 when the transfer is performed, or 0 when nothing is
+  done because the CoreSPI instance is not a master or the transfer is empty.
+  A transfer started with SPI_transfer_segments_async() or
+  SPI_transfer_block_async() is waited for first.
+
+  @example
+  @code
+      uint8_t page_program[4] = { 0x02u, addr_h, addr_m, addr_l };
+      spi_segment_t segments[2] =
+      {
+          { page_program, 0, sizeof(page_program) },
+          { p_page_data,  0, 256u }
+      };
+
+      SPI_transfer_segments( &g_spi0, segments, 2u );
+  @endcode
+ */
+uint8_t SPI_transfer_segments
+(
+    spi_instance_t * this_spi,
+    const spi_segment_t * segments,
+    uint32_t nb_segments
+);
+
+/***************************************************************************//**
+  The SPI_transfer_segments_async() function starts the same transfer as
+  SPI_transfer_segments() and returns without waiting for it. The transfer is
+  performed by SPI_isr(), which calls the completion handler once the last
+  frame has been received, as described for SPI_transfer_block_async().
+
+  @param this_spi
+  The this_spi parameter is a pointer to a spi_instance_t structure that identifies
+  the CoreSPI hardware block to operate on.
+
+  @param segments
+  The segments parameter is a pointer to an array of spi_segment_t structures
+  describing the segments. The array and the buffers it points to must remain
+  valid until the transfer is complete.
+
+  @param nb_segments
+  The nb_segments parameter specifies the number of segments.
+
+  @param done_handler
+  The done_handler parameter is the function called from SPI_isr() when the
+  transfer is complete, or null (0) if SPI_is_transfer_busy() is polled
+  instead.
+
+  @return
+  This function returns 1 when the transfer is started, or 0 when nothing is
+  done because a transfer is already in progress, the CoreSPI instance is not
+  a master or the transfer is empty.
+ */
+uint8_t SPI_transfer_segments_async
+(
+    spi_instance_t * this_spi,
+    const spi_segment_t * segments,
+    uint32_t nb_segments,
+    spi_xfer_done_handler_t done_handler
+);
+
+/***************************************************************************//**
+  The SPI_is_transfer_busy() function indicates whether a transfer started
+  with SPI_transfer_block_async() or SPI_transfer_segments_async() is still in
+  progress.
+
+  @param this_spi
+  The this_spi parameter is a pointer to a spi_instance_t structure that identifies
+  the CoreSPI hardware block to operate on.
+
+  @return
+  This function returns 1 while the transfer is in progress and 0 once it is
+  complete.
+ */
+uint8_t SPI_is_transfer_busy
+(
+    const spi_instance_t * this_spi
+);
+
 /***************************************************************************//**
   The SPI_set_frame_rx_handler() function is used by the SPI slaves to specify
   the receive handler function that is called by the SPI driver interrupt
@@ -1062,6 +1321,9 @@ void SPI_set_slave_block_buffers
   SPI_set_cmd_handler(), SPI_set_cmd_response(), and SPI_set_slave_tx_frame()
   functions.
 
+  In master mode, SPI_isr() performs the transfers started with
+  SPI_transfer_block_async() and calls their completion handler.
+
   @param this_spi
   The this_spi parameter is a pointer to a spi_instance_t structure that identifies
   the CoreSPI hardware block to operate on. This parameter must point to
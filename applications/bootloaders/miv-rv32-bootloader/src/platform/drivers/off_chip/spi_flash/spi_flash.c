@@ -23,6 +23,7 @@
 #else
 #include "hal.h"
 #endif
+#include "miv_rv32_hal/miv_rv32_time.h"
 #include "drivers/fpga_ip/CoreSPI/core_spi.h"
 #include "spi_flash.h"
 
@@ -48,19 +49,58 @@
 
 #define DONT_CARE                    0
 
+/*
+ * Longest time, in milliseconds, the device may stay busy after a program or
+ * a 64KB sector erase command, and after a chip erase command or while its
+ * flag status register reports an erase in progress. The polling loops give
+ * up once it has elapsed, so that a missing or faulty device does not hang
+ * the processor.
+ */
+#ifndef SPI_FLASH_READY_TIMEOUT_MS
+#define SPI_FLASH_READY_TIMEOUT_MS      3000u
+#endif
+
+#ifndef SPI_FLASH_ERASE_TIMEOUT_MS
+#define SPI_FLASH_ERASE_TIMEOUT_MS      500000u
+#endif
+
 #define NB_BYTES_PER_PAGE          256
 
 #define BLOCK_ALIGN_MASK_4K      0xFFFFF000
 #define BLOCK_ALIGN_MASK_32K     0xFFFF8000
 #define BLOCK_ALIGN_MASK_64K     0xFFFF0000
 
+/*
+ * Number of 64KB sectors whose protection state is tracked.
+ */
+#ifndef SPI_FLASH_NB_SECTORS
+#define SPI_FLASH_NB_SECTORS     128u
+#endif
+
+#define SECTOR_SHIFT             16u
+
+#define NB_BYTES_PER_BLOCK       0x1000u
+#define NB_BYTES_PER_SECTOR      0x10000u
+#define NB_BLOCKS_PER_SECTOR     (NB_BYTES_PER_SECTOR / NB_BYTES_PER_BLOCK)
+
+/*
+ * Typical erase times of a 4KB block and of a 64KB sector, in milliseconds.
+ * The erase planner uses them to choose between the two erase sizes.
+ */
+#ifndef SPI_FLASH_4K_ERASE_MS
+#define SPI_FLASH_4K_ERASE_MS    50u
+#endif
+
+#ifndef SPI_FLASH_64K_ERASE_MS
+#define SPI_FLASH_64K_ERASE_MS   400u
+#endif
+
 /*
  * Maximum bytes required for command including opcode,
  * address and any dummy bytes.
  */
 
 #define ATMEL_MAX_CMD_BYTES 6
-#define ATMEL_MAX_WRITE_BYTES (ATMEL_MAX_CMD_BYTES + NB_BYTES_PER_PAGE)
 
 spi_instance_t g_flash_core_spi;
 
@@ -71,17 +111,43 @@ spi_instance_t g_flash_core_spi;
 #define SPI_TRANS_BLOCK SPI_transfer_block
 
 /*
- * Our maximum write to the SPI FLASH device will be a 6 byte command
- * and a full 256 byte page of data. We construct this here because the
- * SPI block transfer only supports a single write buffer. To avoid the
- * overhead of buffer copying you could use the driver SPI_transfer_block()
- * as a template for writing a block transfer routine that allowed transfers
- * from two separate buffers without deselecting the slave.
+ * Command and segments of the read in progress with spi_flash_read_async(),
+ * which must remain valid until the end of the transfer, and its completion
+ * handler.
  */
-static uint8_t flash_write_buffer[ATMEL_MAX_WRITE_BYTES];
+static uint8_t async_read_cmd[4];
+static spi_segment_t async_read_segments[2];
+static spi_flash_read_handler_t async_read_handler;
+
+/*
+ * One bit per 64KB sector, set once the sector is known to be unprotected so
+ * that programming does not send the unprotect command again.
+ */
+static uint32_t unprotected_sectors[(SPI_FLASH_NB_SECTORS + 31u) / 32u];
+
+/*
+ * Function called before the content of the flash is changed.
+ */
+static spi_flash_change_hook_t change_hook;
+
+/*
+ * Function called between two reads of the status of a busy device.
+ */
+static spi_flash_wait_hook_t wait_hook;
 
 static uint8_t wait_ready( void );
+static uint8_t wait_ready_ms( uint32_t timeout_ms );
 static uint8_t wait_ready_erase( void );
+static void async_read_done( spi_instance_t * this_spi );
+static void set_sector_unprotected( uint32_t address, uint8_t unprotected );
+static uint8_t is_sector_unprotected( uint32_t address );
+static spi_flash_status_t unprotect_sector( uint32_t address );
+static const uint8_t * buffer_page_source( void * p_ctx, uint32_t offset, uint32_t length );
+static spi_flash_status_t read_array( uint32_t address, uint8_t * rx_buffer, uint32_t size_in_bytes );
+static uint8_t is_blank( uint32_t address, uint32_t size_in_bytes );
+static spi_flash_status_t erase_block( uint32_t address );
+static uint8_t is_same( uint32_t address, const uint8_t * p_data, uint32_t size_in_bytes );
+static void notify_change( uint32_t address, uint32_t size );
 
 /******************************************************************************
  *For more details please refer the spi_flash.h file
@@ -96,6 +162,9 @@ spi_flash_status_t spi_flash_init( uint32_t base_addr )
     SPI_configure_master_mode( SPI_INSTANCE );
     SPI_set_slave_select( SPI_INSTANCE, SPI_SLAVE );
 
+    /* The protection state of the sectors is not known yet. */
+    memset( unprotected_sectors, 0, sizeof(unprotected_sectors) );
+
     return( SPI_FLASH_SUCCESS );
 }
 
@@ -159,6 +228,7 @@ spi_flash_control_hw
                                     sizeof(cmd_buffer),
                                     0,
                                     0 );
+            set_sector_unprotected( address, 0 );
         }
         break;
         case SPI_FLASH_SECTOR_UNPROTECT:
@@ -186,6 +256,7 @@ spi_flash_control_hw
                                     sizeof(cmd_buffer),
                                     0,
                                     0 );
+            set_sector_unprotected( address, 1 );
         }
         break;
 
@@ -211,11 +282,17 @@ spi_flash_control_hw
             SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 2, 0, 0 );
             if(wait_ready())
                 return SPI_FLASH_UNSUCCESS;
+
+            /* Writing 0 to the status register clears the global protection. */
+            memset( unprotected_sectors, 0xFF, sizeof(unprotected_sectors) );
         }
         break;
         case SPI_FLASH_CHIP_ERASE:
         {
             uint8_t cmd_buffer;
+
+            notify_change( 0, 0xFFFFFFFFu );
+
             /* Send Write Enable command */
             cmd_buffer = WRITE_ENABLE_CMD;
 
@@ -231,7 +308,7 @@ spi_flash_control_hw
                 return SPI_FLASH_UNSUCCESS;
 
             SPI_TRANS_BLOCK( SPI_INSTANCE, &cmd_buffer, 1, 0, 0 );
-            if(wait_ready())
+            if(wait_ready_ms(SPI_FLASH_ERASE_TIMEOUT_MS))
                 return SPI_FLASH_UNSUCCESS;
         }
         break;
@@ -252,6 +329,9 @@ spi_flash_control_hw
         {
             uint32_t address = param1 & BLOCK_ALIGN_MASK_4K;
             uint8_t cmd_buffer[4];
+
+            notify_change( address, NB_BYTES_PER_BLOCK );
+
             /* Send Write Enable command */
             cmd_buffer[0] = WRITE_ENABLE_CMD;
 
@@ -286,6 +366,9 @@ spi_flash_control_hw
         {
             uint32_t address = param1 & BLOCK_ALIGN_MASK_32K;
             uint8_t cmd_buffer[4];
+
+            notify_change( address, 0x8000u );
+
             /* Send Write Enable command */
             cmd_buffer[0] = WRITE_ENABLE_CMD;
 
@@ -310,6 +393,9 @@ spi_flash_control_hw
         {
             uint32_t address = param1 & BLOCK_ALIGN_MASK_64K;
             uint8_t cmd_buffer[4];
+
+            notify_change( address, NB_BYTES_PER_SECTOR );
+
             /* Send Write Enable command */
             cmd_buffer[0] = WRITE_ENABLE_CMD;
 
@@ -396,69 +482,155 @@ spi_flash_read
     size_t size_in_bytes
 )
 {
-    uint8_t cmd_buffer[6];
+    wait_ready_erase();
+
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    wait_ready_erase();
+
+    if( SPI_FLASH_SUCCESS != read_array( address, rx_buffer, (uint32_t)size_in_bytes ) )
+        return SPI_FLASH_UNSUCCESS;
+
+    wait_ready_erase();
+    return 0;
+}
+
+/*******************************************************************************
+ * This function reads data from the FLASH device, which must be ready.
+ */
+static spi_flash_status_t read_array( uint32_t address, uint8_t * rx_buffer, uint32_t size_in_bytes )
+{
+    uint8_t cmd_buffer[4];
+    spi_segment_t segments[2];
 
     cmd_buffer[0] = 0x03;//READ_ARRAY_OPCODE;
     cmd_buffer[1] = (uint8_t)((address >> 16) & 0xFF);
-    cmd_buffer[2] = (uint8_t)((address >> 8) & 0xFF);;
+    cmd_buffer[2] = (uint8_t)((address >> 8) & 0xFF);
     cmd_buffer[3] = (uint8_t)(address & 0xFF);
-    cmd_buffer[4] = DONT_CARE;
-    cmd_buffer[5] = DONT_CARE;
 
-    wait_ready_erase();
+    /* Command and address, then the data read straight into rx_buffer. */
+    segments[0].tx_buffer = cmd_buffer;
+    segments[0].rx_buffer = 0;
+    segments[0].size = sizeof(cmd_buffer);
+    segments[1].tx_buffer = 0;
+    segments[1].rx_buffer = rx_buffer;
+    segments[1].size = size_in_bytes;
+
+    if( 0u == SPI_transfer_segments( SPI_INSTANCE, segments, 2 ) )
+        return SPI_FLASH_UNSUCCESS;
+
+    return SPI_FLASH_SUCCESS;
+}
+
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_read_async
+(
+    uint32_t address,
+    uint8_t * rx_buffer,
+    size_t size_in_bytes,
+    spi_flash_read_handler_t handler
+)
+{
+    if( SPI_is_transfer_busy( SPI_INSTANCE ) )
+        return SPI_FLASH_UNSUCCESS;
 
     if(wait_ready())
         return SPI_FLASH_UNSUCCESS;
 
-    wait_ready_erase();
+    async_read_cmd[0] = 0x03;//READ_ARRAY_OPCODE;
+    async_read_cmd[1] = (uint8_t)((address >> 16) & 0xFF);
+    async_read_cmd[2] = (uint8_t)((address >> 8) & 0xFF);
+    async_read_cmd[3] = (uint8_t)(address & 0xFF);
+    async_read_handler = handler;
 
-    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 4/*sizeof(cmd_buffer)*/, rx_buffer, size_in_bytes );
-    wait_ready_erase();
-    return 0;
+    async_read_segments[0].tx_buffer = async_read_cmd;
+    async_read_segments[0].rx_buffer = 0;
+    async_read_segments[0].size = sizeof(async_read_cmd);
+    async_read_segments[1].tx_buffer = 0;
+    async_read_segments[1].rx_buffer = rx_buffer;
+    async_read_segments[1].size = (uint32_t)size_in_bytes;
+
+    if( 0u == SPI_transfer_segments_async( SPI_INSTANCE, async_read_segments, 2, async_read_done ) )
+        return SPI_FLASH_UNSUCCESS;
+
+    return SPI_FLASH_SUCCESS;
 }
 
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+uint8_t spi_flash_is_read_busy( void )
+{
+    return SPI_is_transfer_busy( SPI_INSTANCE );
+}
 
 /*******************************************************************************
- * This function sends the command and data to the FLASH device via SPI.
+ * Completion handler of the reads started with spi_flash_read_async(), called
+ * from SPI_isr().
  */
-static void write_cmd_data
+static void async_read_done( spi_instance_t * this_spi )
+{
+    (void)this_spi;
+
+    if( async_read_handler )
+        async_read_handler();
+}
+
+/*******************************************************************************
+ * This function sends the command and data to the FLASH device via SPI. The
+ * data is streamed from the caller's buffer, right after the command, without
+ * deselecting the device.
+ */
+static spi_flash_status_t write_cmd_data
 (
     spi_instance_t * this_spi,
     const uint8_t * cmd_buffer,
     uint16_t cmd_byte_size,
-    uint8_t * data_buffer,
+    const uint8_t * data_buffer,
     uint16_t data_byte_size
 )
 {
-    /*
-     * Construct our combined command and data block
-     */
-    if( cmd_byte_size )
-        memcpy( flash_write_buffer, cmd_buffer, cmd_byte_size );
+    spi_segment_t segments[2];
 
-    if( data_byte_size )
-        memcpy( &flash_write_buffer[cmd_byte_size], data_buffer, data_byte_size );
+    segments[0].tx_buffer = cmd_buffer;
+    segments[0].rx_buffer = 0;
+    segments[0].size = cmd_byte_size;
+    segments[1].tx_buffer = data_buffer;
+    segments[1].rx_buffer = 0;
+    segments[1].size = data_byte_size;
 
-    SPI_TRANS_BLOCK( this_spi, flash_write_buffer, cmd_byte_size + data_byte_size, 0, 0 );
+    if( 0u == SPI_transfer_segments( this_spi, segments, 2 ) )
+        return SPI_FLASH_UNSUCCESS;
+
+    return SPI_FLASH_SUCCESS;
 }
 
-/******************************************************************************
- *For more details please refer the spi_flash.h file
- ******************************************************************************/
-spi_flash_status_t
-spi_flash_write
+#ifdef SPI_FLASH_LEGACY_WRITE
+/*******************************************************************************
+ * Write sequence used before spi_flash_program(), kept to compare the
+ * programming throughput: the sector is unprotected on each call and the
+ * device status is polled several times around each page program.
+ */
+static spi_flash_status_t legacy_write
 (
     uint32_t address,
-    uint8_t * write_buffer,
+    const uint8_t * write_buffer,
     size_t size_in_bytes
 )
 {
     uint8_t cmd_buffer[4];
-
     uint32_t in_buffer_idx;
     uint32_t nb_bytes_to_write;
+    uint32_t size_left;
     uint32_t target_addr;
 
+    notify_change( address, size_in_bytes );
+
     /* Send Write Enable command */
     cmd_buffer[0] = WRITE_ENABLE_CMD;
     wait_ready();
@@ -472,30 +644,20 @@ spi_flash_write
     wait_ready();
     SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, sizeof(cmd_buffer), 0, 0 );
     wait_ready_erase();
+    set_sector_unprotected( address, 1 );
 
-    /* Send Write Enable command */
-    cmd_buffer[0] = WRITE_ENABLE_CMD;
-    if(wait_ready())
-        return SPI_FLASH_UNSUCCESS;
-
-    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 1, 0, 0 );
-
-    /**/
     in_buffer_idx = 0;
-    nb_bytes_to_write = size_in_bytes;
     target_addr = address;
 
     while ( in_buffer_idx < size_in_bytes )
     {
         wait_ready_erase();
-        uint32_t size_left;
-        nb_bytes_to_write = 0x100 - (target_addr & 0xFF);
+
         /* adjust max possible size to page boundary. */
+        nb_bytes_to_write = NB_BYTES_PER_PAGE - (target_addr & (NB_BYTES_PER_PAGE - 1));
         size_left = size_in_bytes - in_buffer_idx;
         if ( size_left < nb_bytes_to_write )
-        {
             nb_bytes_to_write = size_left;
-        }
 
         if(wait_ready())
             return SPI_FLASH_UNSUCCESS;
@@ -508,20 +670,13 @@ spi_flash_write
         if(wait_ready())
             return SPI_FLASH_UNSUCCESS;
 
-
         cmd_buffer[0] = PROGRAM_PAGE_CMD;
         cmd_buffer[1] = (target_addr >> 16) & 0xFF;
         cmd_buffer[2] = (target_addr >> 8 ) & 0xFF;
         cmd_buffer[3] = target_addr & 0xFF;
-
-        write_cmd_data
-          (
-            SPI_INSTANCE,
-            cmd_buffer,
-            sizeof(cmd_buffer),
-            &write_buffer[in_buffer_idx],
-            nb_bytes_to_write
-          );
+        if( SPI_FLASH_SUCCESS != write_cmd_data( SPI_INSTANCE, cmd_buffer, sizeof(cmd_buffer),
+                                                 &write_buffer[in_buffer_idx], nb_bytes_to_write ) )
+            return SPI_FLASH_UNSUCCESS;
 
         target_addr += nb_bytes_to_write;
         in_buffer_idx += nb_bytes_to_write;
@@ -530,43 +685,476 @@ spi_flash_write
 
     /* Send Write Disable command. */
     cmd_buffer[0] = WRITE_DISABLE_CMD;
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 1, 0, 0 );
+    return SPI_FLASH_SUCCESS;
+}
+#endif
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_write
+(
+    uint32_t address,
+    uint8_t * write_buffer,
+    size_t size_in_bytes
+)
+{
+#ifdef SPI_FLASH_LEGACY_WRITE
+    return legacy_write( address, write_buffer, size_in_bytes );
+#else
+    return spi_flash_program( address, size_in_bytes, buffer_page_source, write_buffer );
+#endif
+}
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_program
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    spi_flash_page_source_t source,
+    void * p_ctx
+)
+{
+    uint8_t cmd_buffer[4];
+    const uint8_t * p_page;
+    uint32_t offset = 0;
+    uint32_t page_size;
+    uint32_t next_page_size = 0;
+    uint32_t target_addr;
+
+    if( (0 == source) || (0 == size_in_bytes) )
+        return SPI_FLASH_INVALID_ARGUMENTS;
+
+    /* The first page ends at a page boundary. */
+    page_size = NB_BYTES_PER_PAGE - (address & (NB_BYTES_PER_PAGE - 1));
+    if( page_size > size_in_bytes )
+        page_size = size_in_bytes;
+
+    p_page = source( p_ctx, 0, page_size );
+    if( 0 == p_page )
+        return SPI_FLASH_UNSUCCESS;
+
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    notify_change( address, size_in_bytes );
+
+    while( offset < size_in_bytes )
+    {
+        target_addr = address + offset;
+
+        if( SPI_FLASH_SUCCESS != unprotect_sector( target_addr ) )
+            return SPI_FLASH_UNSUCCESS;
+
+        /* Send Write Enable command, cleared by the device after the program */
+        cmd_buffer[0] = WRITE_ENABLE_CMD;
+        SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 1, 0, 0 );
+
+        /* Program page, straight from the buffer returned by the source */
+        cmd_buffer[0] = PROGRAM_PAGE_CMD;
+        cmd_buffer[1] = (target_addr >> 16) & 0xFF;
+        cmd_buffer[2] = (target_addr >> 8 ) & 0xFF;
+        cmd_buffer[3] = target_addr & 0xFF;
+        if( SPI_FLASH_SUCCESS != write_cmd_data( SPI_INSTANCE, cmd_buffer, sizeof(cmd_buffer), p_page, page_size ) )
+            return SPI_FLASH_UNSUCCESS;
+
+        /* Prepare the next page while the device programs this one. */
+        offset += page_size;
+        if( offset < size_in_bytes )
+        {
+            next_page_size = size_in_bytes - offset;
+            if( next_page_size > NB_BYTES_PER_PAGE )
+                next_page_size = NB_BYTES_PER_PAGE;
+
+            p_page = source( p_ctx, offset, next_page_size );
+            if( 0 == p_page )
+            {
+                wait_ready();
+                return SPI_FLASH_UNSUCCESS;
+            }
+        }
+
+        /* Single status poll for the page, also covering the next command. */
+        if(wait_ready())
+            return SPI_FLASH_WRITE_ERROR;
+
+        page_size = next_page_size;
+    }
+
+    return SPI_FLASH_SUCCESS;
+}
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_erase_range
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    uint8_t options,
+    spi_flash_erase_report_t * p_report
+)
+{
+    spi_flash_erase_report_t report = { 0, 0, 0 };
+    spi_flash_status_t status = SPI_FLASH_SUCCESS;
+    uint32_t end;
+    uint32_t dirty_blocks;
+    uint32_t nb_dirty;
+    uint32_t idx;
+
+    if( 0 == size_in_bytes )
+        return SPI_FLASH_INVALID_ARGUMENTS;
+
+    /* Whole 4KB blocks covering the range. */
+    end = (address + size_in_bytes + NB_BYTES_PER_BLOCK - 1u) & BLOCK_ALIGN_MASK_4K;
+    address &= BLOCK_ALIGN_MASK_4K;
 
     if(wait_ready())
         return SPI_FLASH_UNSUCCESS;
 
+    while( (SPI_FLASH_SUCCESS == status) && (address < end) )
+    {
+        if( SPI_FLASH_SUCCESS != unprotect_sector( address ) )
+        {
+            status = SPI_FLASH_UNSUCCESS;
+        }
+        else if( (0u == (address & (NB_BYTES_PER_SECTOR - 1u))) &&
+                 ((end - address) >= NB_BYTES_PER_SECTOR) )
+        {
+            /*
+             * Whole sector: find the blocks holding data, then pick the
+             * cheapest of one sector erase or erasing these blocks alone.
+             */
+            dirty_blocks = 0u;
+            nb_dirty = 0u;
+            for( idx = 0u; idx < NB_BLOCKS_PER_SECTOR; ++idx )
+            {
+                if( (0u == (options & SPI_FLASH_ERASE_SKIP_BLANK)) ||
+                    !is_blank( address + (idx * NB_BYTES_PER_BLOCK), NB_BYTES_PER_BLOCK ) )
+                {
+                    dirty_blocks |= (1u << idx);
+                    ++nb_dirty;
+                }
+            }
+
+            if( (nb_dirty * SPI_FLASH_4K_ERASE_MS) > SPI_FLASH_64K_ERASE_MS )
+            {
+                status = spi_flash_control_hw( SPI_FLASH_64KBLOCK_ERASE, address, 0 );
+                ++report.sectors_erased;
+            }
+            else
+            {
+                for( idx = 0u; (SPI_FLASH_SUCCESS == status) && (idx < NB_BLOCKS_PER_SECTOR); ++idx )
+                {
+                    if( dirty_blocks & (1u << idx) )
+                    {
+                        status = erase_block( address + (idx * NB_BYTES_PER_BLOCK) );
+                        ++report.blocks_erased;
+                    }
+                }
+                report.blocks_skipped += NB_BLOCKS_PER_SECTOR - nb_dirty;
+            }
+            address += NB_BYTES_PER_SECTOR;
+        }
+        else
+        {
+            /* Partial sector: one block at a time. */
+            if( (0u == (options & SPI_FLASH_ERASE_SKIP_BLANK)) ||
+                !is_blank( address, NB_BYTES_PER_BLOCK ) )
+            {
+                status = erase_block( address );
+                ++report.blocks_erased;
+            }
+            else
+            {
+                ++report.blocks_skipped;
+            }
+            address += NB_BYTES_PER_BLOCK;
+        }
+    }
+
+    if( 0 != p_report )
+        *p_report = report;
+
+    return status;
+}
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_update
+(
+    uint32_t address,
+    const uint8_t * p_data,
+    size_t size_in_bytes,
+    spi_flash_update_report_t * p_report
+)
+{
+    spi_flash_update_report_t report = { 0, 0 };
+    spi_flash_status_t status = SPI_FLASH_SUCCESS;
+    uint32_t offset = 0;
+
+    /* A block is erased as a whole, so partial blocks would lose data. */
+    if( (0 == p_data) || (0 == size_in_bytes) ||
+        (0u != (address & (NB_BYTES_PER_BLOCK - 1u))) ||
+        (0u != (size_in_bytes & (NB_BYTES_PER_BLOCK - 1u))) )
+        return SPI_FLASH_INVALID_ARGUMENTS;
+
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    while( (SPI_FLASH_SUCCESS == status) && (offset < size_in_bytes) )
+    {
+        if( is_same( address + offset, &p_data[offset], NB_BYTES_PER_BLOCK ) )
+        {
+            ++report.blocks_unchanged;
+        }
+        else
+        {
+            status = unprotect_sector( address + offset );
+            if( SPI_FLASH_SUCCESS == status )
+                status = erase_block( address + offset );
+            if( SPI_FLASH_SUCCESS == status )
+                status = spi_flash_program( address + offset, NB_BYTES_PER_BLOCK,
+                                            buffer_page_source, (void *)&p_data[offset] );
+            if( (SPI_FLASH_SUCCESS == status) &&
+                !is_same( address + offset, &p_data[offset], NB_BYTES_PER_BLOCK ) )
+                status = SPI_FLASH_WRITE_ERROR;
+
+            ++report.blocks_updated;
+        }
+
+        offset += NB_BYTES_PER_BLOCK;
+    }
+
+    if( 0 != p_report )
+        *p_report = report;
+
+    return status;
+}
+
+/*******************************************************************************
+ * This function returns 1 if the FLASH content matches the data passed as
+ * parameter. It stops reading at the first difference, and returns 0 when the
+ * FLASH cannot be read.
+ */
+static uint8_t is_same( uint32_t address, const uint8_t * p_data, uint32_t size_in_bytes )
+{
+    uint8_t buffer[NB_BYTES_PER_PAGE];
+    uint32_t chunk;
+
+    while( size_in_bytes > 0u )
+    {
+        chunk = (size_in_bytes < sizeof(buffer)) ? size_in_bytes : sizeof(buffer);
+        if( SPI_FLASH_SUCCESS != read_array( address, buffer, chunk ) )
+            return 0;
+
+        if( 0 != memcmp( buffer, p_data, chunk ) )
+            return 0;
+
+        address += chunk;
+        p_data += chunk;
+        size_in_bytes -= chunk;
+    }
+
+    return 1;
+}
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+void spi_flash_set_change_hook( spi_flash_change_hook_t hook )
+{
+    change_hook = hook;
+}
+
+/******************************************************************************
+ *For more details please refer the spi_flash.h file
+ ******************************************************************************/
+void spi_flash_set_wait_hook( spi_flash_wait_hook_t hook )
+{
+    wait_hook = hook;
+}
+
+/*******************************************************************************
+ * This function calls the change hook, if any, before the area is changed.
+ */
+static void notify_change( uint32_t address, uint32_t size )
+{
+    if( change_hook )
+        change_hook( address, size );
+}
+
+/*******************************************************************************
+ * This function erases a 4KB block and waits for the end of the erase.
+ */
+static spi_flash_status_t erase_block( uint32_t address )
+{
+    uint8_t cmd_buffer[4];
+
+    notify_change( address, NB_BYTES_PER_BLOCK );
+
+    /* Send Write Enable command */
+    cmd_buffer[0] = WRITE_ENABLE_CMD;
     SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 1, 0, 0 );
-    return 0;
+
+    cmd_buffer[0] = ERASE_4K_BLOCK_OPCODE;
+    cmd_buffer[1] = (address >> 16) & 0xFF;
+    cmd_buffer[2] = (address >> 8 ) & 0xFF;
+    cmd_buffer[3] = address & 0xFF;
+    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, sizeof(cmd_buffer), 0, 0 );
+
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    return SPI_FLASH_SUCCESS;
+}
+
+/*******************************************************************************
+ * This function returns 1 if the area only holds 0xFF bytes. It stops reading
+ * at the first programmed byte, so areas holding data are rejected quickly.
+ * An area that cannot be read is not blank.
+ */
+static uint8_t is_blank( uint32_t address, uint32_t size_in_bytes )
+{
+    uint32_t words[NB_BYTES_PER_PAGE / sizeof(uint32_t)];
+    uint32_t chunk;
+    uint32_t idx;
+
+    while( size_in_bytes > 0u )
+    {
+        chunk = (size_in_bytes < sizeof(words)) ? size_in_bytes : sizeof(words);
+        if( SPI_FLASH_SUCCESS != read_array( address, (uint8_t *)words, chunk ) )
+            return 0;
+
+        for( idx = 0u; idx < (chunk / sizeof(uint32_t)); ++idx )
+        {
+            if( 0xFFFFFFFFu != words[idx] )
+                return 0;
+        }
+
+        address += chunk;
+        size_in_bytes -= chunk;
+    }
+
+    return 1;
+}
+
+/*******************************************************************************
+ * Page source of spi_flash_write(), returning the pages of the write buffer
+ * passed as context.
+ */
+static const uint8_t * buffer_page_source( void * p_ctx, uint32_t offset, uint32_t length )
+{
+    (void)length;
+
+    return &((const uint8_t *)p_ctx)[offset];
 }
 
+/*******************************************************************************
+ * This function unprotects the 64KB sector holding the address unless it is
+ * already known to be unprotected.
+ */
+static spi_flash_status_t unprotect_sector( uint32_t address )
+{
+    uint8_t cmd_buffer[4];
+
+    if( is_sector_unprotected( address ) )
+        return SPI_FLASH_SUCCESS;
+
+    /* Send Write Enable command */
+    cmd_buffer[0] = WRITE_ENABLE_CMD;
+    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, 1, 0, 0 );
+
+    /* Unprotect sector */
+    cmd_buffer[0] = UNPROTECT_SECTOR_OPCODE;
+    cmd_buffer[1] = (address >> 16) & 0xFF;
+    cmd_buffer[2] = (address >> 8 ) & 0xFF;
+    cmd_buffer[3] = address & 0xFF;
+    SPI_TRANS_BLOCK( SPI_INSTANCE, cmd_buffer, sizeof(cmd_buffer), 0, 0 );
+
+    if(wait_ready())
+        return SPI_FLASH_UNSUCCESS;
+
+    set_sector_unprotected( address, 1 );
+    return SPI_FLASH_SUCCESS;
+}
+
+/*******************************************************************************
+ * These functions keep track of the sectors known to be unprotected.
+ */
+static void set_sector_unprotected( uint32_t address, uint8_t unprotected )
+{
+    uint32_t sector = address >> SECTOR_SHIFT;
+
+    if( sector < SPI_FLASH_NB_SECTORS )
+    {
+        if( unprotected )
+            unprotected_sectors[sector / 32u] |= (1u << (sector % 32u));
+        else
+            unprotected_sectors[sector / 32u] &= ~(1u << (sector % 32u));
+    }
+}
+
+static uint8_t is_sector_unprotected( uint32_t address )
+{
+    uint32_t sector = address >> SECTOR_SHIFT;
+
+    if( sector >= SPI_FLASH_NB_SECTORS )
+        return 0;
+
+    return (uint8_t)((unprotected_sectors[sector / 32u] >> (sector % 32u)) & 1u);
+}
 
 /******************************************************************************
  * This function waits for the SPI operation to complete
  ******************************************************************************/
 static uint8_t wait_ready( void )
 {
-    uint32_t count = 0;
-    uint8_t ready_bit;
+    return wait_ready_ms(SPI_FLASH_READY_TIMEOUT_MS);
+}
+
+static uint8_t wait_ready_ms( uint32_t timeout_ms )
+{
+    mrv_deadline_t deadline;
+    uint8_t ready_bit = READY_BIT_MASK;
     uint8_t command = READ_STATUS;
-#if 1
+    uint32_t nb_polls = 0;
+
+    MRV_deadline_set_ms(&deadline, timeout_ms);
     do {
         SPI_TRANS_BLOCK(SPI_INSTANCE, &command, 1, &ready_bit, 1);
         ready_bit = ready_bit & READY_BIT_MASK;
-        count++;
-    } while((ready_bit & READY_BIT_MASK) /*&& (count <= 0x7FFFFFFF)*/);
-#endif
+        if( ready_bit && wait_hook )
+            wait_hook( ++nb_polls );
+    } while((ready_bit & READY_BIT_MASK) && !MRV_deadline_expired(&deadline));
+
     return (ready_bit);
 }
 
 static uint8_t wait_ready_erase( void )
 {
-    uint32_t count = 0;
-    uint8_t ready_bit;
+    mrv_deadline_t deadline;
+    uint8_t ready_bit = 0;
     uint8_t command = 0x70 ; // FLAG_READ_STATUS;
-#if 1
+    uint32_t nb_polls = 0;
+
+    MRV_deadline_set_ms(&deadline, SPI_FLASH_ERASE_TIMEOUT_MS);
     do {
         SPI_TRANS_BLOCK(SPI_INSTANCE, &command, 1, &ready_bit, 1);
-        count++;
-    } while((ready_bit & 0x80) == 0);
-#endif
+        if( ((ready_bit & 0x80) == 0) && wait_hook )
+            wait_hook( ++nb_polls );
+    } while(((ready_bit & 0x80) == 0) && !MRV_deadline_expired(&deadline));
+
     return (ready_bit);
 }
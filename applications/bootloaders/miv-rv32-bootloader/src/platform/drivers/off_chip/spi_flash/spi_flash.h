@@ -60,6 +60,59 @@ typedef enum {
 */
 } spi_flash_control_hw_t;
 
+/*******************************************************************************
+ * Function called when a read started with spi_flash_read_async() is complete.
+ ******************************************************************************/
+typedef void (*spi_flash_read_handler_t)( void );
+
+/*******************************************************************************
+ * Function returning the data of a page programmed by spi_flash_program():
+ * length bytes, at offset bytes from the start of the data. It is called
+ * while the device programs the previous page, so it can produce the data
+ * (copy, decompress, receive...) without adding to the programming time. The
+ * returned buffer must remain valid until the next call. It returns null (0)
+ * to abort the programming.
+ ******************************************************************************/
+typedef const uint8_t * (*spi_flash_page_source_t)( void * p_ctx, uint32_t offset, uint32_t length );
+
+/*******************************************************************************
+ * Function called before the content of the flash is changed by a program or
+ * erase operation, with the address and size of the area changed. A chip
+ * erase is reported with address 0 and size 0xFFFFFFFF. It is used to keep
+ * copies of the flash content, such as a read cache, up to date.
+ ******************************************************************************/
+typedef void (*spi_flash_change_hook_t)( uint32_t address, uint32_t size );
+
+/*******************************************************************************
+ * Function called each time the device status is read busy while waiting for
+ * the end of a program or erase operation, with the number of busy status
+ * reads so far for this wait. It lets an RTOS task sleep between two reads
+ * of the status instead of keeping the processor busy.
+ ******************************************************************************/
+typedef void (*spi_flash_wait_hook_t)( uint32_t nb_polls );
+
+/*******************************************************************************
+ * Options of spi_flash_erase_range().
+ ******************************************************************************/
+#define SPI_FLASH_ERASE_SKIP_BLANK      0x01u   /* Do not erase blank blocks */
+
+/*******************************************************************************
+ * Erases performed by spi_flash_erase_range().
+ ******************************************************************************/
+typedef struct {
+    uint32_t sectors_erased;    /* 64KB sector erases */
+    uint32_t blocks_erased;     /* 4KB block erases */
+    uint32_t blocks_skipped;    /* 4KB blocks found blank and not erased */
+} spi_flash_erase_report_t;
+
+/*******************************************************************************
+ * Blocks compared and rewritten by spi_flash_update().
+ ******************************************************************************/
+typedef struct {
+    uint32_t blocks_unchanged;  /* 4KB blocks already holding the data */
+    uint32_t blocks_updated;    /* 4KB blocks erased and programmed */
+} spi_flash_update_report_t;
+
 struct device_Info{
     uint8_t manufacturer_id;
     uint8_t device_id;
@@ -217,6 +270,50 @@ spi_flash_read
     size_t size_in_bytes
 );
 
+/*******************************************************************************
+ * This function starts reading the content of Serial Flash into the buffer
+ * passed as parameter and returns without waiting for the data. The data is
+ * transferred by the CoreSPI interrupt, so the application must call
+ * SPI_isr( &g_flash_core_spi ) from the interrupt handler of the processor
+ * interrupt the CoreSPI SPIINT output is connected to.
+ * The rx_buffer must remain valid, and no other function of this driver must
+ * be called, until the read is complete.
+ *
+ * @param address       This is the address from which data will be read.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ *                      This address range is not the processors absolute range
+ * @param rx_buffer     This is a pointer to the buffer receiving the data.
+ * @param size_in_bytes This is the number of bytes to be read.
+ * @param handler       This is the function called from the interrupt handler
+ *                      once the read is complete. It can be null (0) if
+ *                      spi_flash_is_read_busy() is polled instead.
+ * @return              The return value indicates if the read was started.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_SUCCESS: describes the read is in progress
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the device did not
+ *                      become ready or a read is already in progress
+ */
+spi_flash_status_t
+spi_flash_read_async
+(
+    uint32_t address,
+    uint8_t * rx_buffer,
+    size_t size_in_bytes,
+    spi_flash_read_handler_t handler
+);
+
+/*******************************************************************************
+ * This function indicates whether a read started with spi_flash_read_async()
+ * is in progress.
+ *
+ * @return              1 while the read is in progress, 0 otherwise.
+ */
+uint8_t spi_flash_is_read_busy( void );
+
 /*******************************************************************************
  * This function writes the content of the buffer passed as parameter to
  * Serial Flash through SPI. The data is written from the memory location specified
@@ -267,4 +364,135 @@ spi_flash_write
     size_t size_in_bytes
 );
 
+/*******************************************************************************
+ * This function programs Serial Flash one page at a time, with the data
+ * returned by the source function passed as parameter. The area must have
+ * been erased.
+ * For each page, the sector is unprotected only if it is not already known to
+ * be unprotected, then the write enable and page program commands are sent
+ * and the device status is polled once, for the end of the program. The data
+ * of the next page is requested from the source while the device programs
+ * the current one. spi_flash_write() uses this function, unless
+ * SPI_FLASH_LEGACY_WRITE is defined: it then uses the previous write sequence,
+ * which unprotects the sector on each call and polls the device status
+ * several times per page, to compare the programming throughput.
+ *
+ * @param address       This is the address at which data will be written.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ * @param size_in_bytes This is the number of bytes to be written.
+ * @param source        This is the function returning the data of each page.
+ * @param p_ctx         This is the context passed to the source function.
+ * @return              The return value indicates if the write was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_WRITE_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_WRITE_ERROR: describes the device did not
+ *                      complete a page program in time
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the device did not
+ *                      become ready or the source aborted the programming
+ */
+spi_flash_status_t
+spi_flash_program
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    spi_flash_page_source_t source,
+    void * p_ctx
+);
+
+/*******************************************************************************
+ * This function erases the 4KB blocks covering a range of Serial Flash with
+ * the cheapest mix of 64KB sector and 4KB block erases.
+ * Sectors entirely inside the range are erased with one sector erase, unless
+ * erasing their non-blank blocks one by one is quicker, based on the typical
+ * erase times SPI_FLASH_4K_ERASE_MS and SPI_FLASH_64K_ERASE_MS. Blocks of
+ * partially covered sectors are erased one by one. The sectors are
+ * unprotected as needed.
+ * With the SPI_FLASH_ERASE_SKIP_BLANK option, each block is first read and is
+ * not erased if it only holds 0xFF bytes. Reading a block takes a few
+ * milliseconds, much less than erasing it, and stops at the first programmed
+ * byte.
+ *
+ * @param address       This is the start address of the range. It is rounded
+ *                      down to a 4KB boundary.
+ * @param size_in_bytes This is the size of the range. Its end is rounded up to
+ *                      a 4KB boundary.
+ * @param options       This is 0 or SPI_FLASH_ERASE_SKIP_BLANK.
+ * @param p_report      This is a pointer to a structure receiving the number
+ *                      of erases performed and of blocks skipped, or null (0).
+ * @return              The return value indicates if the erase was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ */
+spi_flash_status_t
+spi_flash_erase_range
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    uint8_t options,
+    spi_flash_erase_report_t * p_report
+);
+
+/*******************************************************************************
+ * This function writes data to Serial Flash, only erasing and programming the
+ * 4KB blocks whose content differs. Each block is read and compared with the
+ * data first, which takes a few milliseconds, while erasing and programming
+ * it takes tens of milliseconds and wears the device. Rewritten blocks are
+ * read back and checked.
+ * Whole blocks are written, so that no data outside of the range is erased.
+ *
+ * @param address       This is the address at which data will be written. It
+ *                      must be aligned on a 4KB boundary.
+ * @param p_data        This is a pointer to the data to write.
+ * @param size_in_bytes This is the number of bytes to write. It must be a
+ *                      multiple of 4KB.
+ * @param p_report      This is a pointer to a structure receiving the number
+ *                      of blocks left unchanged and rewritten, or null (0).
+ * @return              The return value indicates if the update was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_WRITE_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_WRITE_ERROR: describes a rewritten block
+ *                      does not hold the data
+ */
+spi_flash_status_t
+spi_flash_update
+(
+    uint32_t address,
+    const uint8_t * p_data,
+    size_t size_in_bytes,
+    spi_flash_update_report_t * p_report
+);
+
+/*******************************************************************************
+ * This function registers the function called before the content of the flash
+ * is changed by spi_flash_write(), spi_flash_program(), spi_flash_erase_range(),
+ * spi_flash_update() or an erase through spi_flash_control_hw(). Only one
+ * function is registered at a time.
+ *
+ * @param hook          This is the function to call, or null (0) to remove
+ *                      the registered function.
+ */
+void spi_flash_set_change_hook( spi_flash_change_hook_t hook );
+
+/*******************************************************************************
+ * This function registers the function called between two reads of the device
+ * status while the device is busy. Without it, the status is read again
+ * straight away. The waits are still bounded by SPI_FLASH_READY_TIMEOUT_MS
+ * and SPI_FLASH_ERASE_TIMEOUT_MS. Only one function is registered at a time.
+ *
+ * @param hook          This is the function to call, or null (0) to remove
+ *                      the registered function.
+ */
+void spi_flash_set_wait_hook( spi_flash_wait_hook_t hook );
+
 #endif
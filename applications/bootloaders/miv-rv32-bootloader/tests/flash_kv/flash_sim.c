@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_sim.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief File backed SPI flash simulator. See file "flash_sim.h" for
+ * description of the functions implemented in this file.
+ *
+ */
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "drivers/off_chip/spi_flash/spi_flash.h"
+#include "flash_sim.h"
+
+static uint8_t * g_flash;
+static uint32_t g_size;
+static int g_fd = -1;
+static long g_budget = -1;
+static long g_changed;
+static int g_failed;
+static uint32_t * g_erase_counts;
+static spi_flash_change_hook_t g_hook;
+
+/*------------------------------------------------------------------------------
+ * Number of bytes of an operation which complete before the power fails.
+ */
+static size_t allowed_bytes(size_t size)
+{
+    if (g_failed)
+    {
+        return 0u;
+    }
+
+    if ((g_budget >= 0) && ((long)size > g_budget))
+    {
+        size = (size_t)g_budget;
+        g_failed = 1;
+    }
+
+    if (g_budget >= 0)
+    {
+        g_budget -= (long)size;
+    }
+
+    g_changed += (long)size;
+
+    return size;
+}
+
+int flash_sim_open(const char * path, uint32_t size)
+{
+    struct stat st;
+    off_t old_size;
+
+    g_fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (g_fd < 0)
+    {
+        return -1;
+    }
+
+    if ((0 != fstat(g_fd, &st)) || (0 != ftruncate(g_fd, size)))
+    {
+        close(g_fd);
+        return -1;
+    }
+    old_size = st.st_size;
+
+    g_flash = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, g_fd, 0);
+    if (MAP_FAILED == g_flash)
+    {
+        close(g_fd);
+        return -1;
+    }
+
+    if (old_size < (off_t)size)
+    {
+        memset(&g_flash[old_size], 0xFF, size - (uint32_t)old_size);
+    }
+
+    g_size = size;
+    g_budget = -1;
+    g_changed = 0;
+    g_failed = 0;
+    g_hook = 0;
+    /* The erase counts are kept across power cycles of the same flash. */
+    if ((0 == old_size) || (0 == g_erase_counts))
+    {
+        free(g_erase_counts);
+        g_erase_counts = calloc(size / FLASH_SIM_BLOCK_SIZE, sizeof(uint32_t));
+    }
+
+    return 0;
+}
+
+void flash_sim_close(void)
+{
+    munmap(g_flash, g_size);
+    close(g_fd);
+    g_flash = 0;
+    g_fd = -1;
+}
+
+uint8_t * flash_sim_image(void)
+{
+    return g_flash;
+}
+
+void flash_sim_fail_after(long budget)
+{
+    g_budget = budget;
+    g_failed = 0;
+}
+
+int flash_sim_has_failed(void)
+{
+    return g_failed;
+}
+
+long flash_sim_bytes_changed(void)
+{
+    return g_changed;
+}
+
+uint32_t flash_sim_erase_count(uint32_t address)
+{
+    return g_erase_counts[address / FLASH_SIM_BLOCK_SIZE];
+}
+
+/*------------------------------------------------------------------------------
+ * spi_flash functions used by flash_kv and flash_cache.
+ */
+void spi_flash_set_change_hook(spi_flash_change_hook_t hook)
+{
+    g_hook = hook;
+}
+
+spi_flash_status_t
+spi_flash_read
+(
+    uint32_t address,
+    uint8_t * rx_buffer,
+    size_t size_in_bytes
+)
+{
+    if (((uint64_t)address + size_in_bytes) > g_size)
+    {
+        return SPI_FLASH_INVALID_ADDRESS;
+    }
+
+    memcpy(rx_buffer, &g_flash[address], size_in_bytes);
+
+    return SPI_FLASH_SUCCESS;
+}
+
+spi_flash_status_t
+spi_flash_write
+(
+    uint32_t address,
+    uint8_t * write_buffer,
+    size_t size_in_bytes
+)
+{
+    size_t count;
+    size_t idx;
+
+    if (((uint64_t)address + size_in_bytes) > g_size)
+    {
+        return SPI_FLASH_INVALID_ADDRESS;
+    }
+
+    if (0 != g_hook)
+    {
+        g_hook(address, (uint32_t)size_in_bytes);
+    }
+
+    count = allowed_bytes(size_in_bytes);
+    for (idx = 0u; idx < count; idx++)
+    {
+        g_flash[address + idx] &= write_buffer[idx];
+    }
+
+    return (count == size_in_bytes) ? SPI_FLASH_SUCCESS : SPI_FLASH_UNSUCCESS;
+}
+
+spi_flash_status_t
+spi_flash_erase_range
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    uint8_t options,
+    spi_flash_erase_report_t * p_report
+)
+{
+    uint32_t block;
+    uint32_t end;
+
+    if ((0u != (address % FLASH_SIM_BLOCK_SIZE)) ||
+        (((uint64_t)address + size_in_bytes) > g_size))
+    {
+        return SPI_FLASH_INVALID_ARGUMENTS;
+    }
+
+    end = address + (uint32_t)size_in_bytes;
+    for (block = address; block < end; block += FLASH_SIM_BLOCK_SIZE)
+    {
+        size_t count;
+        size_t idx;
+
+        if (0u != (options & SPI_FLASH_ERASE_SKIP_BLANK))
+        {
+            for (idx = 0u; idx < FLASH_SIM_BLOCK_SIZE; idx++)
+            {
+                if (0xFFu != g_flash[block + idx])
+                {
+                    break;
+                }
+            }
+
+            if (FLASH_SIM_BLOCK_SIZE == idx)
+            {
+                if (0 != p_report)
+                {
+                    p_report->blocks_skipped++;
+                }
+                continue;
+            }
+        }
+
+        if (0 != g_hook)
+        {
+            g_hook(block, FLASH_SIM_BLOCK_SIZE);
+        }
+
+        /* An interrupted erase leaves the end of the block programmed. */
+        count = allowed_bytes(FLASH_SIM_BLOCK_SIZE);
+        memset(&g_flash[block], 0xFF, count);
+        if (FLASH_SIM_BLOCK_SIZE != count)
+        {
+            return SPI_FLASH_UNSUCCESS;
+        }
+
+        g_erase_counts[block / FLASH_SIM_BLOCK_SIZE]++;
+        if (0 != p_report)
+        {
+            p_report->blocks_erased++;
+        }
+    }
+
+    return SPI_FLASH_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_sim.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief File backed SPI flash simulator implementing the spi_flash functions
+ * used by the flash_kv and flash_cache modules, for host testing.
+ *
+ * The flash content is kept in a file mapped in memory, so it persists across
+ * flash_sim_close() and flash_sim_open() like across a power cycle. Programming
+ * only clears bits and erasing sets a 4KB block to 0xFF, as on the device.
+ *
+ * A power failure is simulated with flash_sim_fail_after(): once the given
+ * number of bytes has been programmed or erased, the operation in progress
+ * stops part way and all the following ones fail.
+ *
+ */
+#ifndef FLASH_SIM_H
+#define FLASH_SIM_H
+
+#include <stdint.h>
+
+#define FLASH_SIM_BLOCK_SIZE            4096u
+
+/*
+ * Map a flash of the given size from a file, creating the file, blank, when
+ * it does not exist. Returns 0 on success.
+ */
+int flash_sim_open(const char * path, uint32_t size);
+
+void flash_sim_close(void);
+
+/*
+ * Flash content, to take or restore snapshots.
+ */
+uint8_t * flash_sim_image(void);
+
+/*
+ * Fail after budget more bytes are programmed or erased, or never when budget
+ * is negative.
+ */
+void flash_sim_fail_after(long budget);
+
+int flash_sim_has_failed(void);
+
+/*
+ * Bytes programmed or erased since the flash was opened.
+ */
+long flash_sim_bytes_changed(void);
+
+/*
+ * Number of times the 4KB block holding an address was erased since the flash
+ * file was created.
+ */
+uint32_t flash_sim_erase_count(uint32_t address);
+
+#endif  /* FLASH_SIM_H */
@@ -0,0 +1,558 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file test_flash_kv.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Host tests of the flash_kv key-value store, run against the file
+ * backed flash simulator.
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "flash_cache/flash_cache.h"
+#include "flash_kv/flash_kv.h"
+#include "flash_sim.h"
+
+#define FLASH_FILE          "flash_kv_test.bin"
+#define FLASH_SIZE          0x20000u
+#define KV_BASE             0x10000u
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1);                                                        \
+        }                                                                   \
+    } while (0)
+
+/*------------------------------------------------------------------------------
+ * Expected content of the store.
+ */
+#define MODEL_KEYS          40u
+
+typedef struct
+{
+    uint8_t present;
+    uint32_t length;
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+} model_value_t;
+
+static model_value_t g_model[MODEL_KEYS];
+static uint32_t g_seed = 1u;
+
+static uint32_t next_random(void)
+{
+    g_seed = (g_seed * 1103515245u) + 12345u;
+    return g_seed >> 8;
+}
+
+static void key_name(char * p_key, uint32_t idx)
+{
+    sprintf(p_key, "key.%02u", idx);
+}
+
+static flash_kv_status_t mount(uint32_t nb_sectors)
+{
+    flash_cache_init();
+    return flash_kv_init(KV_BASE, nb_sectors);
+}
+
+/* Close and reopen the flash file, as across a power cycle. */
+static flash_kv_status_t remount(uint32_t nb_sectors)
+{
+    flash_sim_close();
+    CHECK(0 == flash_sim_open(FLASH_FILE, FLASH_SIZE));
+    return mount(nb_sectors);
+}
+
+static void fresh_flash(void)
+{
+    unlink(FLASH_FILE);
+    CHECK(0 == flash_sim_open(FLASH_FILE, FLASH_SIZE));
+    memset(g_model, 0, sizeof(g_model));
+}
+
+static void model_set(uint32_t idx, const uint8_t * p_value, uint32_t length)
+{
+    char key[16];
+
+    key_name(key, idx);
+    CHECK(FLASH_KV_OK == flash_kv_set(key, p_value, length));
+    g_model[idx].present = 1u;
+    g_model[idx].length = length;
+    memcpy(g_model[idx].value, p_value, length);
+}
+
+static void model_delete(uint32_t idx)
+{
+    char key[16];
+
+    key_name(key, idx);
+    CHECK((g_model[idx].present ? FLASH_KV_OK : FLASH_KV_NOT_FOUND) ==
+          flash_kv_delete(key));
+    g_model[idx].present = 0u;
+}
+
+static int matches(uint32_t idx, const model_value_t * p_expected)
+{
+    char key[16];
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+    uint32_t length = 0u;
+    flash_kv_status_t status;
+
+    key_name(key, idx);
+    status = flash_kv_get(key, value, sizeof(value), &length);
+    if (!p_expected->present)
+    {
+        return FLASH_KV_NOT_FOUND == status;
+    }
+
+    return (FLASH_KV_OK == status) && (length == p_expected->length) &&
+           (0 == memcmp(value, p_expected->value, length));
+}
+
+static void check_model(void)
+{
+    flash_kv_stats_t stats;
+    uint32_t nb_keys = 0u;
+    uint32_t idx;
+
+    for (idx = 0u; idx < MODEL_KEYS; idx++)
+    {
+        CHECK(matches(idx, &g_model[idx]));
+        nb_keys += g_model[idx].present;
+    }
+
+    flash_kv_get_stats(&stats);
+    CHECK(nb_keys == stats.nb_keys);
+}
+
+static void random_value(uint8_t * p_value, uint32_t length)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < length; idx++)
+    {
+        p_value[idx] = (uint8_t)next_random();
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Set, get and delete.
+ */
+static void test_basic(void)
+{
+    char long_key[FLASH_KV_MAX_KEY_LENGTH + 2u];
+    uint8_t big[FLASH_KV_MAX_VALUE_LENGTH + 1u];
+    uint32_t value = 1234u;
+    uint32_t length = 0u;
+    char text[16];
+    long changed;
+
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(4u));
+
+    CHECK(FLASH_KV_NOT_FOUND == flash_kv_get("count", &value, sizeof(value), &length));
+    CHECK(FLASH_KV_NOT_FOUND == flash_kv_delete("count"));
+
+    CHECK(FLASH_KV_OK == flash_kv_set("count", &value, sizeof(value)));
+    value = 0u;
+    CHECK(FLASH_KV_OK == flash_kv_get("count", &value, sizeof(value), &length));
+    CHECK((1234u == value) && (sizeof(value) == length));
+
+    /* Invalid keys and values. */
+    memset(long_key, 'k', sizeof(long_key) - 1u);
+    long_key[sizeof(long_key) - 1u] = '\0';
+    memset(big, 0, sizeof(big));
+    CHECK(FLASH_KV_INVALID == flash_kv_set("", &value, sizeof(value)));
+    CHECK(FLASH_KV_INVALID == flash_kv_set(0, &value, sizeof(value)));
+    CHECK(FLASH_KV_INVALID == flash_kv_set(long_key, &value, sizeof(value)));
+    CHECK(FLASH_KV_INVALID == flash_kv_set("big", big, sizeof(big)));
+    long_key[FLASH_KV_MAX_KEY_LENGTH] = '\0';
+    CHECK(FLASH_KV_OK == flash_kv_set(long_key, big, FLASH_KV_MAX_VALUE_LENGTH));
+
+    /* Truncated read, empty value. */
+    CHECK(FLASH_KV_OK == flash_kv_set("name", "hello world", 11u));
+    memset(text, 0, sizeof(text));
+    CHECK(FLASH_KV_OK == flash_kv_get("name", text, 5u, &length));
+    CHECK((0 == strcmp(text, "hello")) && (11u == length));
+    CHECK(FLASH_KV_OK == flash_kv_set("empty", 0, 0u));
+    CHECK(FLASH_KV_OK == flash_kv_get("empty", 0, 0u, &length));
+    CHECK(0u == length);
+
+    /* Setting the same value again does not write. */
+    changed = flash_sim_bytes_changed();
+    CHECK(FLASH_KV_OK == flash_kv_set("name", "hello world", 11u));
+    CHECK(changed == flash_sim_bytes_changed());
+
+    CHECK(FLASH_KV_OK == flash_kv_delete("count"));
+    CHECK(FLASH_KV_NOT_FOUND == flash_kv_get("count", &value, sizeof(value), &length));
+
+    flash_sim_close();
+    printf("basic: pass\n");
+}
+
+/*------------------------------------------------------------------------------
+ * Values survive closing and reopening the flash file.
+ */
+static void test_persistence(void)
+{
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+    uint32_t idx;
+
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(4u));
+
+    for (idx = 0u; idx < MODEL_KEYS; idx++)
+    {
+        random_value(value, sizeof(value));
+        model_set(idx, value, 1u + (idx * 3u));
+    }
+    model_delete(3u);
+    model_delete(7u);
+    random_value(value, sizeof(value));
+    model_set(5u, value, 64u);
+
+    CHECK(FLASH_KV_OK == remount(4u));
+    check_model();
+
+    /* A blank or foreign area mounts as an empty store. */
+    memset(&flash_sim_image()[KV_BASE], 0x00, 4u * FLASH_SIM_BLOCK_SIZE);
+    CHECK(FLASH_KV_OK == remount(4u));
+    memset(g_model, 0, sizeof(g_model));
+    check_model();
+
+    flash_sim_close();
+    printf("persistence: pass\n");
+}
+
+/*------------------------------------------------------------------------------
+ * Many updates wrap the ring several times: values stay correct and the
+ * sectors are erased evenly, including when some keys never change.
+ */
+static void test_wear(void)
+{
+    const uint32_t nb_sectors = 8u;
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+    flash_kv_stats_t stats;
+    uint32_t min_erases = 0xFFFFFFFFu;
+    uint32_t max_erases = 0u;
+    uint32_t sector;
+    uint32_t idx;
+
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(nb_sectors));
+
+    /* Keys 0 to 3 are never updated. */
+    for (idx = 0u; idx < 4u; idx++)
+    {
+        random_value(value, 100u);
+        model_set(idx, value, 100u);
+    }
+
+    for (idx = 0u; idx < 20000u; idx++)
+    {
+        uint32_t key = 4u + (next_random() % (MODEL_KEYS - 4u));
+
+        if (0u == (next_random() % 16u))
+        {
+            model_delete(key);
+        }
+        else
+        {
+            uint32_t length = 1u + (next_random() % 128u);
+
+            random_value(value, length);
+            model_set(key, value, length);
+        }
+
+        if (0u == (idx % 4u))
+        {
+            (void)flash_kv_process();
+        }
+
+        if (0u == (idx % 1000u))
+        {
+            check_model();
+        }
+
+        if (0u == (idx % 5000u))
+        {
+            CHECK(FLASH_KV_OK == remount(nb_sectors));
+            check_model();
+        }
+    }
+
+    check_model();
+    flash_kv_get_stats(&stats);
+
+    CHECK(FLASH_KV_OK == remount(nb_sectors));
+    check_model();
+
+    for (sector = 0u; sector < nb_sectors; sector++)
+    {
+        uint32_t erases = flash_sim_erase_count(KV_BASE + (sector * FLASH_SIM_BLOCK_SIZE));
+
+        if (erases < min_erases)
+        {
+            min_erases = erases;
+        }
+        if (erases > max_erases)
+        {
+            max_erases = erases;
+        }
+    }
+
+    CHECK(stats.compactions > 0u);
+    CHECK((max_erases - min_erases) <= 1u);
+
+    flash_sim_close();
+    printf("wear: pass, %u compactions, %u to %u erases per sector\n",
+           stats.compactions, min_erases, max_erases);
+}
+
+/*------------------------------------------------------------------------------
+ * A full store refuses new values and keeps the existing ones.
+ */
+static void test_full(void)
+{
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+    flash_kv_status_t status;
+    char key[16];
+    uint32_t nb_set = 0u;
+    uint32_t idx;
+
+    /* Out of space. */
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(3u));
+
+    do
+    {
+        random_value(value, sizeof(value));
+        key_name(key, nb_set);
+        status = flash_kv_set(key, value, sizeof(value));
+        if (FLASH_KV_OK == status)
+        {
+            g_model[nb_set].present = 1u;
+            g_model[nb_set].length = sizeof(value);
+            memcpy(g_model[nb_set].value, value, sizeof(value));
+            nb_set++;
+        }
+    } while ((FLASH_KV_OK == status) && (nb_set < MODEL_KEYS));
+
+    CHECK(FLASH_KV_FULL == status);
+    check_model();
+
+    CHECK(FLASH_KV_OK == remount(3u));
+    check_model();
+
+    model_delete(0u);
+    model_delete(1u);
+    random_value(value, sizeof(value));
+    model_set(nb_set, value, sizeof(value));
+    check_model();
+    flash_sim_close();
+
+    /* Out of keys. */
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(8u));
+
+    for (idx = 0u; idx < FLASH_KV_MAX_KEYS; idx++)
+    {
+        sprintf(key, "k%u", idx);
+        CHECK(FLASH_KV_OK == flash_kv_set(key, &idx, sizeof(idx)));
+    }
+    CHECK(FLASH_KV_FULL == flash_kv_set("one.more", &idx, sizeof(idx)));
+    CHECK(FLASH_KV_OK == flash_kv_set("k0", &idx, sizeof(idx)));
+    CHECK(FLASH_KV_OK == flash_kv_delete("k1"));
+    CHECK(FLASH_KV_OK == flash_kv_set("one.more", &idx, sizeof(idx)));
+
+    flash_sim_close();
+    printf("full: pass\n");
+}
+
+/*------------------------------------------------------------------------------
+ * The power fails after each byte programmed or erased by a sequence of
+ * updates, deletes and compactions. After the restart, each key holds its
+ * value before or after the operation in progress, and the other keys hold
+ * the values written before.
+ */
+#define PF_KEYS             6u
+#define PF_SECTORS          4u
+#define PF_NB_OPS           96u
+
+typedef enum
+{
+    OP_SET,
+    OP_DELETE,
+    OP_PROCESS
+} op_type_t;
+
+typedef struct
+{
+    op_type_t type;
+    uint32_t key;
+    uint32_t length;
+    uint8_t value[FLASH_KV_MAX_VALUE_LENGTH];
+} op_t;
+
+static op_t g_ops[PF_NB_OPS];
+static model_value_t g_initial[MODEL_KEYS];
+
+static flash_kv_status_t run_op(const op_t * p_op)
+{
+    char key[16];
+
+    key_name(key, p_op->key);
+    switch (p_op->type)
+    {
+        case OP_SET:
+            return flash_kv_set(key, p_op->value, p_op->length);
+
+        case OP_DELETE:
+            return flash_kv_delete(key);
+
+        default:
+            (void)flash_kv_process();
+            return FLASH_KV_OK;
+    }
+}
+
+static void apply_op(model_value_t * p_value, const op_t * p_op)
+{
+    if (OP_SET == p_op->type)
+    {
+        p_value->present = 1u;
+        p_value->length = p_op->length;
+        memcpy(p_value->value, p_op->value, p_op->length);
+    }
+    else if (OP_DELETE == p_op->type)
+    {
+        p_value->present = 0u;
+    }
+}
+
+static void test_power_fail(void)
+{
+    static uint8_t snapshot[PF_SECTORS * FLASH_SIM_BLOCK_SIZE];
+    flash_kv_stats_t stats;
+    long total;
+    long budget;
+    uint32_t idx;
+
+    fresh_flash();
+    CHECK(FLASH_KV_OK == mount(PF_SECTORS));
+
+    for (idx = 0u; idx < PF_KEYS; idx++)
+    {
+        uint8_t value[32];
+
+        random_value(value, sizeof(value));
+        model_set(idx, value, sizeof(value));
+    }
+    memcpy(g_initial, g_model, sizeof(g_model));
+    memcpy(snapshot, &flash_sim_image()[KV_BASE], sizeof(snapshot));
+
+    for (idx = 0u; idx < PF_NB_OPS; idx++)
+    {
+        op_t * p_op = &g_ops[idx];
+        uint32_t choice = next_random() % 8u;
+
+        p_op->key = next_random() % PF_KEYS;
+        p_op->type = (0u == choice) ? OP_DELETE : ((1u == choice) ? OP_PROCESS : OP_SET);
+        p_op->length = 150u + (next_random() % 100u);
+        random_value(p_op->value, p_op->length);
+    }
+
+    /* Reference run, without failure. */
+    total = flash_sim_bytes_changed();
+    for (idx = 0u; idx < PF_NB_OPS; idx++)
+    {
+        CHECK(FLASH_KV_OK == run_op(&g_ops[idx]) ||
+              ((OP_DELETE == g_ops[idx].type) && !g_model[g_ops[idx].key].present));
+        apply_op(&g_model[g_ops[idx].key], &g_ops[idx]);
+    }
+    check_model();
+    flash_kv_get_stats(&stats);
+    CHECK(stats.compactions > 1u);
+    total = flash_sim_bytes_changed() - total;
+
+    for (budget = 0; budget <= total; budget++)
+    {
+        uint32_t failed_op = PF_NB_OPS;
+
+        memcpy(&flash_sim_image()[KV_BASE], snapshot, sizeof(snapshot));
+        memcpy(g_model, g_initial, sizeof(g_model));
+        CHECK(FLASH_KV_OK == mount(PF_SECTORS));
+
+        flash_sim_fail_after(budget);
+        for (idx = 0u; idx < PF_NB_OPS; idx++)
+        {
+            (void)run_op(&g_ops[idx]);
+            if (flash_sim_has_failed())
+            {
+                failed_op = idx;
+                break;
+            }
+            apply_op(&g_model[g_ops[idx].key], &g_ops[idx]);
+        }
+
+        /* Restart. */
+        flash_sim_fail_after(-1);
+        CHECK(FLASH_KV_OK == mount(PF_SECTORS));
+
+        for (idx = 0u; idx < PF_KEYS; idx++)
+        {
+            model_value_t after = g_model[idx];
+
+            if ((failed_op < PF_NB_OPS) && (idx == g_ops[failed_op].key))
+            {
+                apply_op(&after, &g_ops[failed_op]);
+            }
+
+            if (!matches(idx, &g_model[idx]) && !matches(idx, &after))
+            {
+                printf("power failure after %ld bytes, op %u: key %u lost\n",
+                       budget, failed_op, idx);
+                exit(1);
+            }
+        }
+
+        /* The store is still writable. */
+        for (idx = 0u; idx < PF_KEYS; idx++)
+        {
+            uint8_t value[200];
+
+            random_value(value, sizeof(value));
+            model_set(idx, value, sizeof(value));
+        }
+        CHECK(FLASH_KV_OK == mount(PF_SECTORS));
+        for (idx = 0u; idx < PF_KEYS; idx++)
+        {
+            CHECK(matches(idx, &g_model[idx]));
+        }
+    }
+
+    flash_sim_close();
+    printf("power failure: pass, %ld failure points\n", total + 1);
+}
+
+int main(void)
+{
+    test_basic();
+    test_persistence();
+    test_wear();
+    test_full();
+    test_power_fail();
+
+    unlink(FLASH_FILE);
+    printf("all tests passed\n");
+
+    return 0;
+}
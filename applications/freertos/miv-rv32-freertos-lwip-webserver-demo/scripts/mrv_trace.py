@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+#
+# SPDX-License-Identifier: MIT
+#
+# Converts the content of the MIV_RV32 HAL event trace buffer into a Chrome
+# trace JSON file which can be opened with chrome://tracing or
+# https://ui.perfetto.dev.
+#
+# Usage:
+#   python3 mrv_trace.py <uart_log.txt> [-o trace.json]
+#   python3 mrv_trace.py --bin <trace.bin> [-o trace.json]
+#
+# The UART log may contain any other text. Only the lines between
+# MRV_TRACE_BEGIN and MRV_TRACE_END, as printed by MRV_trace_dump(), are used;
+# when the log contains more than one dump, the last one is used.
+#
+# A binary file is a copy of the g_mrv_trace variable taken with the debugger:
+#   dump binary value trace.bin g_mrv_trace
+#
+# Event names are read from the MRV_TRACE_ID_xxx definitions of
+# miv_rv32_trace.h. Application events can be named by adding definitions to
+# another header and passing it with --ids.
+#
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "..", "src", "platform", "miv_rv32_hal",
+                              "miv_rv32_trace.h")
+
+MAGIC = 0x5456524D
+HEADER_FORMAT = "<IHHIIII"
+RECORD_FORMAT = "<IHHII"
+RING_NAMES = ("thread", "interrupt")
+
+TYPE_MASK = 0xC000
+TYPE_PHASE = {0x0000: "i", 0x4000: "B", 0x8000: "E"}
+
+BEGIN_RE = re.compile(r"MRV_TRACE_BEGIN\s+clk=(\d+)\s+size=(\d+)")
+RECORD_RE = re.compile(r"^\s*(\d+)\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{4})\s+"
+                       r"([0-9a-fA-F]{4})\s+([0-9a-fA-F]{8})\s+"
+                       r"([0-9a-fA-F]{8})\s*$")
+END_RE = re.compile(r"MRV_TRACE_END")
+DEFINE_RE = re.compile(r"#define\s+MRV_TRACE_ID_(\w+)\s+\(?\s*"
+                       r"(0x[0-9a-fA-F]+|\d+)[uU]?\s*\)?")
+
+
+def read_names(paths):
+    names = {}
+    for path in paths:
+        if not os.path.exists(path):
+            continue
+        with open(path, "r", errors="replace") as header:
+            for line in header:
+                match = DEFINE_RE.search(line)
+                if match:
+                    names[int(match.group(2), 0)] = match.group(1)
+    return names
+
+
+def parse_log(path):
+    """Return (clk_freq, [[record, ...] per ring]) from a UART log."""
+    dumps = []
+    current = None
+
+    with open(path, "r", errors="replace") as log:
+        for line in log:
+            match = BEGIN_RE.search(line)
+            if match:
+                current = {"clk": int(match.group(1)), "rings": {}}
+                continue
+
+            if current is None:
+                continue
+
+            if END_RE.search(line):
+                dumps.append(current)
+                current = None
+                continue
+
+            match = RECORD_RE.match(line)
+            if match:
+                ring = int(match.group(1))
+                record = tuple(int(match.group(n), 16) for n in range(2, 7))
+                current["rings"].setdefault(ring, []).append(record)
+
+    if not dumps:
+        sys.exit("error: no complete MRV_TRACE block found in " + path)
+
+    dump = dumps[-1]
+    nb_rings = max(dump["rings"].keys(), default=-1) + 1
+    return dump["clk"], [dump["rings"].get(ring, [])
+                         for ring in range(nb_rings)]
+
+
+def parse_bin(path):
+    """Return (clk_freq, [[record, ...] per ring]) from a memory dump."""
+    with open(path, "rb") as dump:
+        data = dump.read()
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if len(data) < header_size:
+        sys.exit("error: %s is too small to be a trace buffer" % path)
+
+    (magic, _version, nb_rings, ring_size, clk, _enabled,
+     _tag) = struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != MAGIC:
+        sys.exit("error: %s does not start with the trace buffer magic" % path)
+
+    heads = struct.unpack_from("<%dI" % nb_rings, data, header_size)
+    offset = header_size + 4 * nb_rings
+    record_size = struct.calcsize(RECORD_FORMAT)
+
+    rings = []
+    for ring in range(nb_rings):
+        head = heads[ring]
+        first = head - ring_size if head > ring_size else 0
+        records = []
+        for idx in range(first, head):
+            slot = offset + (ring * ring_size + idx % ring_size) * record_size
+            records.append(struct.unpack_from(RECORD_FORMAT, data, slot))
+        rings.append(records)
+
+    return clk, rings
+
+
+def unwrap(records):
+    """Extend the 32 bit cycle counts of one ring, in write order, to 64 bit.
+
+    Records reserved by a task which was then preempted can carry a slightly
+    older timestamp than the record before them, so small backwards steps are
+    not treated as a counter wrap.
+    """
+    result = []
+    previous = None
+    for record in records:
+        stamp = record[0]
+        if previous is None:
+            extended = stamp
+        else:
+            delta = (stamp - (previous & 0xFFFFFFFF)) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            extended = previous + delta
+        previous = extended
+        result.append((extended,) + tuple(record[1:]))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert MIV_RV32 HAL trace output to Chrome trace JSON.")
+    parser.add_argument("input", help="captured UART output, or memory dump "
+                        "when --bin is given")
+    parser.add_argument("--bin", action="store_true",
+                        help="the input is a binary copy of g_mrv_trace")
+    parser.add_argument("-o", "--output", default="trace.json",
+                        help="output file (default trace.json)")
+    parser.add_argument("--ids", action="append", default=[],
+                        help="additional header defining MRV_TRACE_ID_xxx "
+                        "event names")
+    parser.add_argument("--clk", type=int, default=0,
+                        help="override the processor clock frequency in Hz")
+    args = parser.parse_args()
+
+    if args.bin:
+        clk, rings = parse_bin(args.input)
+    else:
+        clk, rings = parse_log(args.input)
+    if args.clk:
+        clk = args.clk
+    if clk == 0:
+        sys.exit("error: unknown clock frequency, use --clk")
+
+    names = read_names([DEFAULT_HEADER] + args.ids)
+
+    rings = [unwrap(records) for records in rings]
+    starts = [records[0][0] for records in rings if records]
+    if not starts:
+        sys.exit("error: the trace does not contain any records")
+
+    # Each ring is unwrapped on its own, so align them on the earliest record
+    # assuming they were captured within one counter period of each other.
+    origin = min(starts)
+
+    events = []
+    for ring, records in enumerate(rings):
+        for stamp, event_id, tag, arg0, arg1 in records:
+            base_id = event_id & ~TYPE_MASK & 0xFFFF
+            name = names.get(base_id, "0x%04x" % base_id)
+            if ring < len(RING_NAMES):
+                thread = RING_NAMES[ring]
+            else:
+                thread = "ring %d" % ring
+            if tag != 0:
+                thread = "%s tag %d" % (thread, tag)
+
+            event = {"name": name,
+                     "cat": name.split("_")[0].lower(),
+                     "ph": TYPE_PHASE.get(event_id & TYPE_MASK, "i"),
+                     "ts": (stamp - origin) * 1e6 / clk,
+                     "pid": 0,
+                     "tid": thread,
+                     "args": {"arg0": "0x%08x" % arg0,
+                              "arg1": "0x%08x" % arg1}}
+            if event["ph"] == "i":
+                event["s"] = "t"
+            events.append(event)
+
+    events.sort(key=lambda event: event["ts"])
+
+    with open(args.output, "w") as output:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, output,
+                  indent=1)
+
+    print("%d events written to %s" % (len(events), args.output))
+
+
+if __name__ == "__main__":
+    main()
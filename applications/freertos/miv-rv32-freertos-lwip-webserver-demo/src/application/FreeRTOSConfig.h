@@ -117,6 +117,10 @@
 #define configGENERATE_RUN_TIME_STATS	0
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
 
+/* Index 1 of the task notifications signals the end of the flash service
+jobs, see flash_service/flash_service.h. */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES	2
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 			0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_service.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief FreeRTOS task owning the SPI flash. See file "flash_service.h" for
+ * description of the functions implemented in this file.
+ *
+ */
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "flash_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static QueueHandle_t g_job_queue = NULL;
+
+/*------------------------------------------------------------------------------
+ * spi_flash wait hook: keep reading the status for short waits, then sleep
+ * for a delay doubling from one tick up to FLASH_SERVICE_MAX_DELAY_MS.
+ */
+static void wait_backoff(uint32_t nb_polls)
+{
+    TickType_t delay = pdMS_TO_TICKS(FLASH_SERVICE_MAX_DELAY_MS);
+    uint32_t shift;
+
+    if (nb_polls <= FLASH_SERVICE_SPIN_POLLS)
+    {
+        return;
+    }
+
+    shift = nb_polls - FLASH_SERVICE_SPIN_POLLS - 1u;
+    if ((shift < 16u) && (((TickType_t)1u << shift) < delay))
+    {
+        delay = (TickType_t)1u << shift;
+    }
+
+    vTaskDelay((0u != delay) ? delay : 1u);
+}
+
+/*------------------------------------------------------------------------------
+ * Run a job.
+ */
+static spi_flash_status_t run_job(const flash_job_t * p_job)
+{
+    switch (p_job->type)
+    {
+        case FLASH_JOB_READ:
+            return spi_flash_read(p_job->address, p_job->p_buf, p_job->size);
+
+        case FLASH_JOB_PROGRAM:
+            return spi_flash_write(p_job->address, p_job->p_buf, p_job->size);
+
+        case FLASH_JOB_ERASE:
+            return spi_flash_erase_range(p_job->address, p_job->size, p_job->options, NULL);
+
+        default:
+            return SPI_FLASH_INVALID_ARGUMENTS;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Service task: run the jobs in the order they were queued.
+ */
+static void flash_service_task(void * pvParameters)
+{
+    flash_job_t * p_job;
+    TaskHandle_t task;
+
+    (void)pvParameters;
+
+    spi_flash_set_wait_hook(wait_backoff);
+
+    for (;;)
+    {
+        if (pdPASS != xQueueReceive(g_job_queue, &p_job, portMAX_DELAY))
+        {
+            continue;
+        }
+
+        /* The job may go out of scope as soon as it is marked done. */
+        task = p_job->task;
+        p_job->status = run_job(p_job);
+        p_job->done = 1u;
+
+        xTaskNotifyGiveIndexed(task, FLASH_SERVICE_NOTIFY_INDEX);
+    }
+}
+
+/***************************************************************************//**
+ * flash_service_init()
+ * See "flash_service.h" for details of how to use this function.
+ */
+BaseType_t flash_service_init(uint32_t spi_base, UBaseType_t priority)
+{
+    spi_flash_init(spi_base);
+
+    g_job_queue = xQueueCreate(FLASH_SERVICE_QUEUE_LENGTH, sizeof(flash_job_t *));
+    if (NULL == g_job_queue)
+    {
+        return pdFAIL;
+    }
+
+    if (pdPASS != xTaskCreate(flash_service_task,
+                              "FlashService",
+                              FLASH_SERVICE_STACK_SIZE,
+                              NULL,
+                              priority,
+                              NULL))
+    {
+        return pdFAIL;
+    }
+
+    return pdPASS;
+}
+
+/***************************************************************************//**
+ * flash_service_submit()
+ * See "flash_service.h" for details of how to use this function.
+ */
+BaseType_t flash_service_submit(flash_job_t * p_job, TickType_t timeout)
+{
+    p_job->task = xTaskGetCurrentTaskHandle();
+    p_job->status = SPI_FLASH_UNSUCCESS;
+    p_job->done = 0u;
+
+    return xQueueSend(g_job_queue, &p_job, timeout);
+}
+
+/***************************************************************************//**
+ * flash_service_wait()
+ * See "flash_service.h" for details of how to use this function.
+ */
+spi_flash_status_t flash_service_wait(flash_job_t * p_job, TickType_t timeout)
+{
+    TimeOut_t time_out;
+
+    vTaskSetTimeOutState(&time_out);
+
+    /* A notification may be for another job of the same task. */
+    while (0u == p_job->done)
+    {
+        if (pdTRUE == xTaskCheckForTimeOut(&time_out, &timeout))
+        {
+            return SPI_FLASH_UNSUCCESS;
+        }
+
+        (void)ulTaskNotifyTakeIndexed(FLASH_SERVICE_NOTIFY_INDEX, pdFALSE, timeout);
+    }
+
+    return p_job->status;
+}
+
+/*------------------------------------------------------------------------------
+ * Submit a job and wait for its end.
+ */
+static spi_flash_status_t run_and_wait(flash_job_t * p_job)
+{
+    if (pdPASS != flash_service_submit(p_job, portMAX_DELAY))
+    {
+        return SPI_FLASH_UNSUCCESS;
+    }
+
+    return flash_service_wait(p_job, portMAX_DELAY);
+}
+
+/***************************************************************************//**
+ * flash_service_read()
+ * See "flash_service.h" for details of how to use this function.
+ */
+spi_flash_status_t flash_service_read(uint32_t address, uint8_t * p_buf, uint32_t size)
+{
+    flash_job_t job;
+
+    job.type = FLASH_JOB_READ;
+    job.address = address;
+    job.p_buf = p_buf;
+    job.size = size;
+    job.options = 0u;
+
+    return run_and_wait(&job);
+}
+
+/***************************************************************************//**
+ * flash_service_program()
+ * See "flash_service.h" for details of how to use this function.
+ */
+spi_flash_status_t flash_service_program(uint32_t address, uint8_t * p_buf, uint32_t size)
+{
+    flash_job_t job;
+
+    job.type = FLASH_JOB_PROGRAM;
+    job.address = address;
+    job.p_buf = p_buf;
+    job.size = size;
+    job.options = 0u;
+
+    return run_and_wait(&job);
+}
+
+/***************************************************************************//**
+ * flash_service_erase()
+ * See "flash_service.h" for details of how to use this function.
+ */
+spi_flash_status_t flash_service_erase(uint32_t address, uint32_t size)
+{
+    flash_job_t job;
+
+    job.type = FLASH_JOB_ERASE;
+    job.address = address;
+    job.p_buf = NULL;
+    job.size = size;
+    job.options = SPI_FLASH_ERASE_SKIP_BLANK;
+
+    return run_and_wait(&job);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file flash_service.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief FreeRTOS task owning the SPI flash, serving read, program and erase
+ * jobs from a queue.
+ *
+ */
+
+/*=========================================================================*//**
+  Flash Service
+  =======================================
+  The spi_flash driver waits for the end of each program and erase operation
+  by reading the status of the device until it is ready. A 4KB erase takes
+  tens of milliseconds and a 64KB erase hundreds: a task calling the driver
+  keeps the processor busy all that time, and the tasks of lower or equal
+  priority, such as the lwIP and web server tasks, do not run.
+
+  The flash service task owns the SPI flash. Other tasks submit jobs to it
+  through a queue and are notified when their job is complete:
+    - the service task registers a spi_flash_set_wait_hook() function which
+      sleeps with vTaskDelay() between two reads of the device status. The
+      first FLASH_SERVICE_SPIN_POLLS reads are made straight away, so short
+      waits such as a page program are not lengthened. The delay then doubles
+      from one tick up to FLASH_SERVICE_MAX_DELAY_MS,
+    - the completion of a job is signalled to the task which submitted it
+      with a direct to task notification, at index FLASH_SERVICE_NOTIFY_INDEX
+      so the notifications used by the application are left alone.
+
+  While a job runs, the other tasks keep running whenever the device is busy.
+  Once the service is started, the spi_flash functions must only be called by
+  the service task.
+
+  --------------------------------
+  Example
+  --------------------------------
+      flash_service_init(FLASH_CORESPI_BASE_ADDR, FLASH_SERVICE_TASK_PRIORITY);
+
+      From a task, waiting for the job:
+
+      status = flash_service_erase(SETTINGS_ADDR, 0x1000u);
+
+      Or starting a job and waiting for it later:
+
+      static flash_job_t job;
+
+      job.type = FLASH_JOB_PROGRAM;
+      job.address = SETTINGS_ADDR;
+      job.p_buf = settings;
+      job.size = sizeof(settings);
+      flash_service_submit(&job, portMAX_DELAY);
+      ...
+      status = flash_service_wait(&job, portMAX_DELAY);
+
+ *//*=========================================================================*/
+#ifndef FLASH_SERVICE_H
+#define FLASH_SERVICE_H
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "drivers/off_chip/spi_flash/spi_flash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Number of jobs the queue holds, and stack size of the service task in words.
+ */
+#ifndef FLASH_SERVICE_QUEUE_LENGTH
+#define FLASH_SERVICE_QUEUE_LENGTH      8u
+#endif
+
+#ifndef FLASH_SERVICE_STACK_SIZE
+#define FLASH_SERVICE_STACK_SIZE        1024u
+#endif
+
+/*
+ * Busy status reads made before the service task starts sleeping, and longest
+ * sleep between two reads.
+ */
+#ifndef FLASH_SERVICE_SPIN_POLLS
+#define FLASH_SERVICE_SPIN_POLLS        64u
+#endif
+
+#ifndef FLASH_SERVICE_MAX_DELAY_MS
+#define FLASH_SERVICE_MAX_DELAY_MS      8u
+#endif
+
+/*
+ * Task notification index used to signal the end of the jobs. It must be
+ * lower than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ */
+#ifndef FLASH_SERVICE_NOTIFY_INDEX
+#define FLASH_SERVICE_NOTIFY_INDEX      1u
+#endif
+
+#if FLASH_SERVICE_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES
+#error FLASH_SERVICE_NOTIFY_INDEX must be lower than configTASK_NOTIFICATION_ARRAY_ENTRIES
+#endif
+
+/***************************************************************************//**
+  Job types.
+ */
+typedef enum
+{
+    FLASH_JOB_READ = 0,                 /* spi_flash_read()         */
+    FLASH_JOB_PROGRAM,                  /* spi_flash_write()        */
+    FLASH_JOB_ERASE                     /* spi_flash_erase_range()  */
+} flash_job_type_t;
+
+/***************************************************************************//**
+  Job. The job, and the buffer it points to, must remain valid until the job
+  is complete.
+ */
+typedef struct
+{
+    flash_job_type_t type;
+    uint32_t address;
+    uint8_t * p_buf;                    /* read: destination, program: data */
+    uint32_t size;
+    uint8_t options;                    /* erase: spi_flash_erase_range() options */
+
+    /* Set by the service. */
+    TaskHandle_t task;                  /* task notified at the end of the job */
+    volatile spi_flash_status_t status;
+    volatile uint8_t done;
+} flash_job_t;
+
+/***************************************************************************//**
+  The flash_service_init() function initializes the spi_flash driver and
+  creates the job queue and the service task. It is called before the
+  scheduler is started.
+
+  @param spi_base
+  Base address of the CoreSPI instance connected to the flash.
+
+  @param priority
+  Priority of the service task.
+
+  @return
+  This function returns pdPASS, or pdFAIL when the queue or the task cannot be
+  created.
+ */
+BaseType_t flash_service_init(uint32_t spi_base, UBaseType_t priority);
+
+/***************************************************************************//**
+  The flash_service_submit() function queues a job. The calling task is
+  notified when the job is complete.
+
+  @param p_job
+  Job, with its type, address, p_buf, size and options set.
+
+  @param timeout
+  Longest time to wait for room in the queue, in ticks.
+
+  @return
+  This function returns pdPASS, or errQUEUE_FULL when the job was not queued.
+ */
+BaseType_t flash_service_submit(flash_job_t * p_job, TickType_t timeout);
+
+/***************************************************************************//**
+  The flash_service_wait() function blocks the calling task until a job it
+  submitted is complete.
+
+  @param p_job
+  Job.
+
+  @param timeout
+  Longest time to wait, in ticks.
+
+  @return
+  This function returns the status of the job, or SPI_FLASH_UNSUCCESS when it
+  is not complete within the timeout. The job remains queued or in progress in
+  that case, and flash_service_wait() can be called again.
+ */
+spi_flash_status_t flash_service_wait(flash_job_t * p_job, TickType_t timeout);
+
+/***************************************************************************//**
+  The flash_service_read(), flash_service_program() and flash_service_erase()
+  functions submit a job and wait for its end.
+
+  @return
+  These functions return the status of the job.
+ */
+spi_flash_status_t flash_service_read(uint32_t address, uint8_t * p_buf, uint32_t size);
+
+spi_flash_status_t flash_service_program(uint32_t address, uint8_t * p_buf, uint32_t size);
+
+spi_flash_status_t flash_service_erase(uint32_t address, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FLASH_SERVICE_H */
@@ -30,6 +30,19 @@
 #include "fpga_design_config/fpga_design_config.h"
 #include "hal/hal.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#ifdef MIV_RV32_PROFILER
+#include "miv_rv32_hal/miv_rv32_profile.h"
+#endif
+#ifdef MIV_RV32_TRACE
+#include "miv_rv32_hal/miv_rv32_trace.h"
+#endif
+#ifdef FLASH_SERVICE
+#include "flash_service/flash_service.h"
+
+#ifndef FLASH_CORESPI_BASE_ADDR
+#error FLASH_SERVICE requires FLASH_CORESPI_BASE_ADDR, the CoreSPI instance connected to the SPI flash
+#endif
+#endif
 
 /* lwIP includes. */
 #include "lwip/dhcp.h"
@@ -43,6 +56,7 @@ UART_instance_t g_uart;
 /* Priorities used by the various different tasks. */
 #define HTTPD_TASK_PRIORITY         1
 #define LINK_STATUS_TASK_PRIORITY   1
+#define FLASH_SERVICE_TASK_PRIORITY 2
 
 /* Priorities for the demo application tasks. */
 #define mainCHECK_TASK_PRIORITY     (configMAX_PRIORITIES - 1)
@@ -82,6 +96,17 @@ xQueueHandle xPTPdOutQueue = NULL;
 /* lwIP MAC configuration. */
 static struct netif s_EMAC_if;
 
+#if defined(MIV_RV32_PROFILER) || defined(MIV_RV32_TRACE)
+/*
+ * Output function used by MRV_profile_dump() and MRV_trace_dump().
+ */
+static void
+prvUartWrite(const char *str)
+{
+    UART_polled_tx_string(&g_uart, (const uint8_t *)str);
+}
+#endif
+
 /*-----------------------------------------------------------*/
 
 void
@@ -141,8 +166,26 @@ main(void)
                 LINK_STATUS_TASK_PRIORITY,
                 NULL);
 
+#ifdef FLASH_SERVICE
+    /* Create the task serving the SPI flash jobs of the other tasks. */
+    if (pdPASS != flash_service_init(FLASH_CORESPI_BASE_ADDR, FLASH_SERVICE_TASK_PRIORITY))
+    {
+        UART_polled_tx_string(&g_uart,
+                              (const uint8_t *)"Flash service creation failed.\n\r");
+    }
+#endif
+
     HAL_enable_interrupts();
 
+#ifdef MIV_RV32_PROFILER
+    /* Samples are taken from vApplicationTickHook() once the scheduler runs. */
+    MRV_profile_start();
+#endif
+
+#ifdef MIV_RV32_TRACE
+    MRV_trace_start();
+#endif
+
     /* Start the kernel.  From here on, only tasks and interrupts will run. */
     vTaskStartScheduler();
 
@@ -212,6 +255,12 @@ vApplicationStackOverflowHook(TaskHandle_t pxTask, char *pcTaskName)
 void
 vApplicationTickHook(void)
 {
+#ifdef MIV_RV32_PROFILER
+    /* The tick hook runs inside the FreeRTOS trap handler with interrupts
+     * disabled, so mepc still holds the address of the interrupted code. */
+    MRV_profile_sample(read_csr(mepc));
+#endif
+
     /* The tests in the full demo expect some interaction with interrupts. */
 #if (mainCREATE_SIMPLE_BLINKY_DEMO_ONLY != 1)
     {
@@ -303,6 +352,18 @@ prvLinkStatusTask(void *pvParameters)
                     *(unsigned int *)(TSE_BASEADDR + RDRP_REG_OFFSET));
             UART_polled_tx_string(&g_uart, (const uint8_t *)buf);
 
+#ifdef MIV_RV32_PROFILER
+            /* Print the profile of the last status period and start again. */
+            MRV_profile_dump(prvUartWrite);
+            MRV_profile_start();
+#endif
+
+#ifdef MIV_RV32_TRACE
+            /* Print the most recent driver events and start again. */
+            MRV_trace_dump(prvUartWrite);
+            MRV_trace_start();
+#endif
+
             vTaskDelay(2000 / portTICK_RATE_MS);
         }
     }
@@ -58,6 +58,11 @@
  */
 #define COREUARTAPB0_BASE_ADDR          0x60000000UL
 #define CORESPI_BASE_ADDR               0x60001000UL
+/*
+ * CORESPI_BASE_ADDR is the bus of the ZL30364 clock synthesiser. Define
+ * FLASH_CORESPI_BASE_ADDR with the base address of the CoreSPI instance
+ * connected to a SPI flash to build the flash service (FLASH_SERVICE).
+ */
 #define COREGPIO_OUT_BASE_ADDR          0x60003000UL
 #define PF_CORE_SYSTEM_SERVICES         0x60004000UL
 
@@ -79,14 +79,23 @@
 /**
  * MEMCPY: override this if you have a faster implementation at hand than the
  * one included in your C library
+ *
+ * MRV_memcpy() copies a word at a time where the newlib-nano memcpy() copies
+ * a byte at a time.
  */
+#include "miv_rv32_hal/miv_rv32_string.h"
+
 #ifndef MEMCPY
-#define MEMCPY(dst,src,len)             memcpy(dst,src,len)
+#define MEMCPY(dst,src,len)             MRV_memcpy(dst,src,len)
 #endif
 
 /**
  * SMEMCPY: override this with care! Some compilers (e.g. gcc) can inline a
  * call to memcpy() if the length is known at compile time and is small.
+ *
+ * Kept on memcpy() so that gcc can still inline these small copies. The calls
+ * it does not inline go to MRV_memcpy() when MRV_STRING_REPLACE_LIBC is
+ * defined, see miv_rv32_string.h.
  */
 #ifndef SMEMCPY
 #define SMEMCPY(dst,src,len)            memcpy(dst,src,len)
@@ -43,6 +43,7 @@
 
 #include "fpga_design_config/fpga_design_config.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_pool.h"
 
 
 /* FreeRTOS headers */
@@ -87,20 +88,28 @@
 
 uint8_t *g_mac_tx_buffer = (uint8_t *)TSE_TX_BUF;
 uint8_t *g_mac_rx_buffer = (uint8_t *)TSE_RX_BUF;
+#define MAC_TX_BUFFER_MEM_SIZE              (TSE_RX_BUF - TSE_TX_BUF)
 /*CoreTSE instance*/
 tse_instance_t *g_tse = (tse_instance_t *)TSE_DESC;
 
 #elif defined(__arm__)
 __align(4) static uint8_t g_mac_tx_buffer[TSE_MAX_TX_BUF_SIZE];
 __align(4) static uint8_t g_mac_rx_buffer[TSE_MAX_RX_BUF_SIZE];
+#define MAC_TX_BUFFER_MEM_SIZE              sizeof(g_mac_tx_buffer)
 
 #elif defined(__ICCARM__)
 #pragma data_alignment = 4
 static uint8_t g_mac_tx_buffer[TSE_MAX_TX_BUF_SIZE];
 static uint8_t g_mac_rx_buffer[TSE_MAX_RX_BUF_SIZE];
+#define MAC_TX_BUFFER_MEM_SIZE              sizeof(g_mac_tx_buffer)
 #endif
 
-static volatile uint32_t g_mac_tx_buffer_used = RELEASE_BUFFER;
+/*
+ * Transmit packet buffers. A buffer is taken from the pool for each packet and
+ * released by the transmit complete interrupt, so that a new packet can be
+ * prepared while the previous ones are still being sent.
+ */
+static mrv_pool_t g_mac_tx_pool;
 static volatile uint32_t g_mac_rx_buffer_data_valid;
 
 static volatile uint32_t g_mac_rx_cnt = 0;
@@ -190,6 +199,7 @@ static void
 low_level_init(struct netif *netif)
 {
     const uint8_t *own_hw_adr;
+    uint32_t tx_buffer_count;
 
     /* We only have one network Interface */
     /* Initialize the Network interface */
@@ -217,8 +227,16 @@ low_level_init(struct netif *netif)
     /* Keep track of netif pointer for use by interrupt service routine. */
     g_p_mac_netif = netif;
 
+    /*--------------------- Initialize packet containers ---------------------*/
+    tx_buffer_count = MRV_pool_init(&g_mac_tx_pool,
+                                    g_mac_tx_buffer,
+                                    MAC_TX_BUFFER_MEM_SIZE,
+                                    TSE_MAX_TX_BUF_SIZE);
+    g_mac_rx_buffer_data_valid = RELEASE_BUFFER;
+
     /*--------------------- Create semaphores ---------------------*/
-    vSemaphoreCreateBinary(xTXSemaphore);
+    /* The semaphore counts the free transmit buffers. */
+    xTXSemaphore = xSemaphoreCreateCounting(tx_buffer_count, tx_buffer_count);
 
     if (xTXSemaphore == NULL)
     {
@@ -226,10 +244,6 @@ low_level_init(struct netif *netif)
             ; // could not create semaphore
     }
 
-    /*--------------------- Initialize packet containers ---------------------*/
-    g_mac_tx_buffer_used = RELEASE_BUFFER;
-    g_mac_rx_buffer_data_valid = RELEASE_BUFFER;
-
     /*-------------------------- Initialize the MAC --------------------------*/
     /*
      * The interrupt can cause a context switch, so ensure its priority is
@@ -321,6 +335,7 @@ low_level_output(struct netif *netif, struct pbuf *p)
     struct pbuf *q;
     uint16_t pckt_length = 0u;
     uint32_t pbuf_chain_end = 0u;
+    uint8_t *p_tx_buffer;
 
     uint8_t tx_status;
 
@@ -334,13 +349,16 @@ low_level_output(struct netif *netif, struct pbuf *p)
     // Block waiting for the semaphore to become available.
     if (xSemaphoreTake(xTXSemaphore, portMAX_DELAY) == pdTRUE)
     {
+        /* The semaphore guarantees that a buffer is available. */
+        p_tx_buffer = (uint8_t *)MRV_pool_alloc_isr_safe(&g_mac_tx_pool);
+
         /*--------------------------------------------------------------------------
          * Copy pbuf chain into single buffer.
          */
         q = p;
         do
         {
-            memcpy(&g_mac_tx_buffer[pckt_length], q->payload, q->len);
+            MEMCPY(&p_tx_buffer[pckt_length], q->payload, q->len);
             pckt_length += q->len;
             if (q->len == q->tot_len)
             {
@@ -359,7 +377,7 @@ low_level_output(struct netif *netif, struct pbuf *p)
         do
         {
             tx_status =
-                TSE_send_pkt(g_tse, g_mac_tx_buffer, pckt_length, (void *)&g_mac_tx_buffer_used);
+                TSE_send_pkt(g_tse, p_tx_buffer, pckt_length, (void *)p_tx_buffer);
         } while (TSE_SUCCESS != tx_status);
     }
 
@@ -378,6 +396,9 @@ packet_tx_complete_handler(void *caller_info)
     static int32_t xHigherPriorityTaskWoken;
     xHigherPriorityTaskWoken = pdFALSE;
 
+    /* caller_info is the buffer passed to TSE_send_pkt(). */
+    MRV_pool_free_isr_safe(&g_mac_tx_pool, caller_info);
+
     // Unblock the task by releasing the semaphore.
     xSemaphoreGiveFromISR(xTXSemaphore, &xHigherPriorityTaskWoken);
 }
@@ -493,7 +514,7 @@ low_level_input(struct netif *netif, uint8_t *p_rx_packet, uint32_t pckt_length)
                  * variable. */
                 /* read data into(q->payload, q->len); */
 
-                memcpy(q->payload, &g_mac_rx_buffer[length], q->len);
+                MEMCPY(q->payload, &g_mac_rx_buffer[length], q->len);
                 length += q->len;
             }
 
@@ -23,6 +23,14 @@
 #include "hal_assert.h"
 #endif
 
+#ifdef MIV_RV32_TRACE
+#include "miv_rv32_hal/miv_rv32_trace.h"
+#else
+#define MRV_TRACE(id, arg0, arg1)
+#define MRV_TRACE_BEGIN(id, arg0, arg1)
+#define MRV_TRACE_END(id, arg0, arg1)
+#endif
+
 /*--------------------------Private functions---------------------------------*/
 
 static cif_response_t set_mmc_clk_div(const mmc_instance_t *this_mmc);
@@ -244,6 +252,8 @@ mmc_transfer_status_t MMC_single_block_write(const mmc_instance_t *this_mmc,
    * Ensure that the write FIFO is empty and load the block of data into the
    * FIFO, one byte at a time through the Write Data Register.
    */
+  MRV_TRACE_BEGIN(MRV_TRACE_ID_MMC_WRITE, dst_addr, 0u);
+
   MMC_init_fifo(this_mmc);
 
   do {
@@ -293,6 +303,8 @@ mmc_transfer_status_t MMC_single_block_write(const mmc_instance_t *this_mmc,
   /* Clear interrupts in the BISR & ISR*/
   HAL_set_32bit_reg(this_mmc->base_addr, ICR, CLEAR_ALL_32);
 
+  MRV_TRACE_END(MRV_TRACE_ID_MMC_WRITE, dst_addr, ret_status);
+
   return (ret_status);
 }
 
@@ -403,6 +415,8 @@ mmc_transfer_status_t MMC_single_block_read(const mmc_instance_t *this_mmc,
   /*
    * Ensure that the Read FIFO is empty.
    */
+  MRV_TRACE_BEGIN(MRV_TRACE_ID_MMC_READ, src_addr, 0u);
+
   MMC_init_fifo(this_mmc);
 
   do {
@@ -466,6 +480,8 @@ mmc_transfer_status_t MMC_single_block_read(const mmc_instance_t *this_mmc,
   /* Clear interrupts in the BISR & ISR*/
   HAL_set_32bit_reg(this_mmc->base_addr, ICR, CLEAR_ALL_32);
 
+  MRV_TRACE_END(MRV_TRACE_ID_MMC_READ, src_addr, ret_status);
+
   return (ret_status);
 }
 
@@ -843,6 +859,8 @@ void MMC_isr(mmc_instance_t *this_mmc) {
   isr_flags = HAL_get_32bit_reg(this_mmc->base_addr, ISR);
   HAL_set_32bit_reg(this_mmc->base_addr, ICR, CLEAR_ALL_32);
 
+  MRV_TRACE(MRV_TRACE_ID_MMC_ISR, isr_flags, this_mmc->status.int_state);
+
   if (ISR_BISR_MBSIR_ERR & isr_flags) {
     /* FIFO timeout error */
     if (((MBISR_MWBFIFOTOERR_MASK << 16) | (BISR_SWBFIFOTOERR_MASK << 8)) &
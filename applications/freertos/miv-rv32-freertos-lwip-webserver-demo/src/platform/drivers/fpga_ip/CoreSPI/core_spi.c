@@ -19,6 +19,14 @@
 #include "corespi_regs.h"
 #include <string.h>
 
+#ifdef MIV_RV32_TRACE
+#include "miv_rv32_hal/miv_rv32_trace.h"
+#else
+#define MRV_TRACE(id, arg0, arg1)
+#define MRV_TRACE_BEGIN(id, arg0, arg1)
+#define MRV_TRACE_END(id, arg0, arg1)
+#endif
+
 /*******************************************************************************
  * Null parameters with appropriate type definitions
  */
@@ -29,6 +37,7 @@
 #define NULL_BLOCK_HANDLER     ( ( spi_block_rx_handler_t ) 0u )
 #define NULL_SLAVE_TX_UPDATE_HANDLER ( ( spi_slave_frame_tx_handler_t ) 0u )
 #define NULL_SLAVE_CMD_HANDLER  NULL_BLOCK_HANDLER
+#define NULL_XFER_DONE_HANDLER ( ( spi_xfer_done_handler_t ) 0u )
 
 #define SPI_ALL_INTS (0xFFu) /* For clearing all active interrupts */
 
@@ -54,6 +63,11 @@ enum {
 static void fill_slave_tx_fifo( spi_instance_t * this_spi );
 static void read_slave_rx_fifo( spi_instance_t * this_spi );
 static void recover_from_rx_overflow( const spi_instance_t * this_spi );
+static void wait_xfer_idle( const spi_instance_t * this_spi );
+static uint8_t start_master_xfer( spi_instance_t * this_spi, const spi_segment_t * segments, uint32_t nb_segments );
+static void fill_master_tx_fifo( spi_instance_t * this_spi );
+static void read_master_rx_fifo( spi_instance_t * this_spi );
+static void service_master_xfer( spi_instance_t * this_spi );
 
 /*******************************************************************************
  * SPI_init()
@@ -267,6 +281,9 @@ uint32_t SPI_transfer_frame
 
     if( NULL_INSTANCE != this_spi )
     {
+        /* A transfer started with an async function is left to complete. */
+        wait_xfer_idle( this_spi );
+
         /* This function is only intended to be used with an SPI master. */
         if( DISABLE != HAL_get_8bit_reg_field(this_spi->base_addr, CTRL1_MASTER ) )
         {
@@ -313,8 +330,13 @@ void SPI_transfer_block
 
     HAL_ASSERT( NULL_INSTANCE != this_spi );
 
+    MRV_TRACE_BEGIN( MRV_TRACE_ID_SPI_XFER, cmd_byte_size, rx_byte_size );
+
     if( NULL_INSTANCE != this_spi )
     {
+        /* A transfer started with an async function is left to complete. */
+        wait_xfer_idle( this_spi );
+
         /* This function is only intended to be used with an SPI master. */
         if( ( DISABLE != HAL_get_8bit_reg_field(this_spi->base_addr, CTRL1_MASTER ) ) &&
             /* Check for empty transfer as well */
@@ -491,6 +513,135 @@ void SPI_transfer_block
             }
         }
     }
+
+    MRV_TRACE_END( MRV_TRACE_ID_SPI_XFER, cmd_byte_size, rx_byte_size );
+}
+
+/***************************************************************************//**
+ * SPI_transfer_block_async()
+ * See "core_spi.h" for details of how to use this function.
+ */
+uint8_t SPI_transfer_block_async
+(
+    spi_instance_t * this_spi,
+    const uint8_t * cmd_buffer,
+    uint32_t cmd_byte_size,
+    uint8_t * rx_buffer,
+    uint32_t rx_byte_size,
+    spi_xfer_done_handler_t done_handler
+)
+{
+    uint8_t started = 0u;
+
+    HAL_ASSERT( NULL_INSTANCE != this_spi );
+
+    if( ( NULL_INSTANCE != this_spi ) && ( 0u == this_spi->xfer_busy ) )
+    {
+        /* The command is sent, then 0s to clock in the response */
+        this_spi->xfer_block_segs[0].tx_buffer = cmd_buffer;
+        this_spi->xfer_block_segs[0].rx_buffer = NULL_BUFF;
+        this_spi->xfer_block_segs[0].size = cmd_byte_size;
+        this_spi->xfer_block_segs[1].tx_buffer = NULL_BUFF;
+        this_spi->xfer_block_segs[1].rx_buffer = rx_buffer;
+        this_spi->xfer_block_segs[1].size = rx_byte_size;
+
+        started = SPI_transfer_segments_async( this_spi, this_spi->xfer_block_segs, 2u, done_handler );
+    }
+
+    return started;
+}
+
+/***************************************************************************//**
+ * SPI_transfer_segments()
+ * See "core_spi.h" for details of how to use this function.
+ */
+uint8_t SPI_transfer_segments
+(
+    spi_instance_t * this_spi,
+    const spi_segment_t * segments,
+    uint32_t nb_segments
+)
+{
+    uint8_t done = 0u;
+
+    HAL_ASSERT( NULL_INSTANCE != this_spi );
+
+    if( NULL_INSTANCE != this_spi )
+    {
+        /* A transfer started with an async function is left to complete. */
+        wait_xfer_idle( this_spi );
+
+        if( SUCCESS == start_master_xfer( this_spi, segments, nb_segments ) )
+        {
+            /* FIFO is all loaded up so enable Core SPI to start transfer */
+            HAL_set_8bit_reg_field( this_spi->base_addr, CTRL1_ENABLE, ENABLE );
+
+            /*
+             * Send a frame every time a frame has been received, so that no Rx
+             * overflow can happen in case of an interrupt occurring during this
+             * function.
+             */
+            while( this_spi->xfer_rx_idx < this_spi->xfer_size )
+            {
+                read_master_rx_fifo( this_spi );
+                fill_master_tx_fifo( this_spi );
+            }
+
+            this_spi->xfer_busy = 0u;
+            done = 1u;
+        }
+    }
+
+    return done;
+}
+
+/***************************************************************************//**
+ * SPI_transfer_segments_async()
+ * See "core_spi.h" for details of how to use this function.
+ */
+uint8_t SPI_transfer_segments_async
+(
+    spi_instance_t * this_spi,
+    const spi_segment_t * segments,
+    uint32_t nb_segments,
+    spi_xfer_done_handler_t done_handler
+)
+{
+    uint8_t started = 0u;
+
+    HAL_ASSERT( NULL_INSTANCE != this_spi );
+
+    if( NULL_INSTANCE != this_spi )
+    {
+        if( SUCCESS == start_master_xfer( this_spi, segments, nb_segments ) )
+        {
+            this_spi->xfer_done_handler = done_handler;
+
+            /* The rest of the transfer is driven by the receive data interrupt */
+            HAL_set_8bit_reg_field( this_spi->base_addr, INTCLR_RXDATA, ENABLE );
+            HAL_set_8bit_reg_field( this_spi->base_addr, CTRL2_INTRXDATA, ENABLE );
+
+            /* FIFO is all loaded up so enable Core SPI to start transfer */
+            HAL_set_8bit_reg_field( this_spi->base_addr, CTRL1_ENABLE, ENABLE );
+            started = 1u;
+        }
+    }
+
+    return started;
+}
+
+/***************************************************************************//**
+ * SPI_is_transfer_busy()
+ * See "core_spi.h" for details of how to use this function.
+ */
+uint8_t SPI_is_transfer_busy
+(
+    const spi_instance_t * this_spi
+)
+{
+    HAL_ASSERT( NULL_INSTANCE != this_spi );
+
+    return this_spi->xfer_busy;
 }
 
 /***************************************************************************//**
@@ -517,6 +668,9 @@ void SPI_transfer_block_store_all_resp
 
     if( NULL_INSTANCE != this_spi )
     {
+        /* A transfer started with an async function is left to complete. */
+        wait_xfer_idle( this_spi );
+
         /* This function is only intended to be used with an SPI master. */
         if( ( DISABLE != HAL_get_8bit_reg_field(this_spi->base_addr, CTRL1_MASTER ) ) &&
             /* Check for empty transfer as well */
@@ -1037,8 +1191,16 @@ void SPI_isr
     HAL_ASSERT( NULL_INSTANCE != this_spi );
     if( NULL_INSTANCE != this_spi )
     {
+        MRV_TRACE_BEGIN( MRV_TRACE_ID_SPI_ISR, HAL_get_8bit_reg( this_spi->base_addr, INTRAW ), 0u );
+
+        /* Handle master interrupt driven block transfer. */
+        if( ( 0u != this_spi->xfer_busy ) &&
+            ( ENABLE == HAL_get_8bit_reg_field( this_spi->base_addr, INTMASK_RXDATA ) ) )
+        {
+            service_master_xfer( this_spi );
+        }
         /* Handle receive. */
-        if( ENABLE == HAL_get_8bit_reg_field( this_spi->base_addr, INTMASK_RXDATA ) )
+        else if( ENABLE == HAL_get_8bit_reg_field( this_spi->base_addr, INTMASK_RXDATA ) )
         {
             /*
              * Service receive data according to transfer mode in operation.
@@ -1243,6 +1405,8 @@ void SPI_isr
 
             HAL_set_8bit_reg_field( this_spi->base_addr, INTCLR_SSEND, ENABLE );
         }
+
+        MRV_TRACE_END( MRV_TRACE_ID_SPI_ISR, 0u, 0u );
     }
 }
 
@@ -1342,4 +1506,201 @@ static void recover_from_rx_overflow
     HAL_set_8bit_reg_field( this_spi->base_addr, CTRL1_ENABLE, ENABLE );
 }
 
+/***************************************************************************//**
+ * This function waits for the end of a transfer started with
+ * SPI_transfer_block_async() or SPI_transfer_segments_async(), completed by
+ * SPI_isr(), before a polled transfer resets the FIFOs.
+ */
+static void wait_xfer_idle
+(
+    const spi_instance_t * this_spi
+)
+{
+    while( 0u != this_spi->xfer_busy )
+    {
+        ;
+    }
+}
+
+/***************************************************************************//**
+ * This function prepares a master segment transfer and loads the TX FIFO,
+ * leaving the CoreSPI disabled. It fails if a transfer is in progress, if the
+ * CoreSPI is not a master or if the transfer is empty.
+ */
+static uint8_t start_master_xfer
+(
+    spi_instance_t * this_spi,
+    const spi_segment_t * segments,
+    uint32_t nb_segments
+)
+{
+    uint32_t transfer_size = 0u;
+    uint32_t seg_idx;
+
+    if( ( 0u != this_spi->xfer_busy ) ||
+        /* This function is only intended to be used with an SPI master. */
+        ( DISABLE == HAL_get_8bit_reg_field( this_spi->base_addr, CTRL1_MASTER ) ) )
+    {
+        return FAILURE;
+    }
+
+    for( seg_idx = 0u; seg_idx < nb_segments; ++seg_idx )
+    {
+        transfer_size += segments[seg_idx].size;
+    }
+
+    /* Check for empty transfer as well */
+    if( 0u == transfer_size )
+    {
+        return FAILURE;
+    }
+
+    this_spi->xfer_segs = segments;
+    this_spi->xfer_nb_segs = nb_segments;
+    this_spi->xfer_size = transfer_size;
+    this_spi->xfer_tx_idx = 0u;
+    this_spi->xfer_tx_seg = 0u;
+    this_spi->xfer_tx_off = 0u;
+    this_spi->xfer_rx_idx = 0u;
+    this_spi->xfer_rx_seg = 0u;
+    this_spi->xfer_rx_off = 0u;
+    this_spi->xfer_done_handler = NULL_XFER_DONE_HANDLER;
+    this_spi->xfer_busy = 1u;
+
+    /* Flush the receive and transmit FIFOs */
+    HAL_set_8bit_reg( this_spi->base_addr, CMD, (uint32_t)( CMD_TXFIFORST_MASK | CMD_RXFIFORST_MASK ) );
+
+    /* Recover from receiver overflow because of previous slave */
+    if( ENABLE == HAL_get_8bit_reg_field( this_spi->base_addr, STATUS_RXOVFLOW ) )
+    {
+        recover_from_rx_overflow( this_spi );
+    }
+
+    /* Disable the Core SPI for a little bit, while we load the TX FIFO */
+    HAL_set_8bit_reg_field( this_spi->base_addr, CTRL1_ENABLE, DISABLE );
+
+    fill_master_tx_fifo( this_spi );
+
+    return SUCCESS;
+}
+
+/***************************************************************************//**
+ * This function writes the next frames of a master segment transfer to the TX
+ * FIFO, keeping no more than fifo_depth frames in flight so that the RX FIFO
+ * can not overflow. The last frame is written to TXLAST to trigger the slave
+ * deselect in case the SPS option is in place.
+ */
+static void fill_master_tx_fifo
+(
+    spi_instance_t * this_spi
+)
+{
+    const spi_segment_t * segment;
+    uint32_t tx_frame;
+
+    while( ( this_spi->xfer_tx_idx < this_spi->xfer_size ) &&
+           ( ( this_spi->xfer_tx_idx - this_spi->xfer_rx_idx ) < this_spi->fifo_depth ) )
+    {
+        /* Move on to the next segment holding frames. */
+        segment = &this_spi->xfer_segs[this_spi->xfer_tx_seg];
+        while( this_spi->xfer_tx_off >= segment->size )
+        {
+            ++this_spi->xfer_tx_seg;
+            this_spi->xfer_tx_off = 0u;
+            ++segment;
+        }
+
+        if( NULL_BUFF != segment->tx_buffer )
+        {
+            tx_frame = (uint32_t)segment->tx_buffer[this_spi->xfer_tx_off];
+        }
+        else
+        {
+            /* Push out 0s to get data back from slave */
+            tx_frame = 0u;
+        }
+
+        ++this_spi->xfer_tx_off;
+        ++this_spi->xfer_tx_idx;
+        if( this_spi->xfer_tx_idx == this_spi->xfer_size ) /* Last frame is special... */
+        {
+            HAL_set_32bit_reg( this_spi->base_addr, TXLAST, tx_frame );
+        }
+        else
+        {
+            HAL_set_32bit_reg( this_spi->base_addr, TXDATA, tx_frame );
+        }
+    }
+}
 
+/***************************************************************************//**
+ * This function empties the RX FIFO during a master segment transfer, storing
+ * each frame in the receive buffer of its segment or discarding it if the
+ * segment has none.
+ */
+static void read_master_rx_fifo
+(
+    spi_instance_t * this_spi
+)
+{
+    const spi_segment_t * segment;
+    uint32_t rx_frame;
+
+    while( ( this_spi->xfer_rx_idx < this_spi->xfer_size ) &&
+           ( 0u == HAL_get_8bit_reg_field( this_spi->base_addr, STATUS_RXEMPTY ) ) )
+    {
+        rx_frame = HAL_get_32bit_reg( this_spi->base_addr, RXDATA );
+
+        segment = &this_spi->xfer_segs[this_spi->xfer_rx_seg];
+        while( this_spi->xfer_rx_off >= segment->size )
+        {
+            ++this_spi->xfer_rx_seg;
+            this_spi->xfer_rx_off = 0u;
+            ++segment;
+        }
+
+        if( NULL_BUFF != segment->rx_buffer )
+        {
+            segment->rx_buffer[this_spi->xfer_rx_off] = (uint8_t)rx_frame;
+        }
+
+        ++this_spi->xfer_rx_off;
+        ++this_spi->xfer_rx_idx;
+    }
+}
+
+/***************************************************************************//**
+ * This function services the receive data interrupt during a master interrupt
+ * driven transfer. It empties the RX FIFO, sends one frame for each frame
+ * received and completes the transfer once the last frame has been received.
+ */
+static void service_master_xfer
+(
+    spi_instance_t * this_spi
+)
+{
+    spi_xfer_done_handler_t done_handler;
+
+    /*
+     * Clear the interrupt before emptying the RX FIFO so that a frame received
+     * while we are emptying it raises the interrupt again.
+     */
+    HAL_set_8bit_reg_field( this_spi->base_addr, INTCLR_RXDATA, ENABLE );
+
+    read_master_rx_fifo( this_spi );
+    fill_master_tx_fifo( this_spi );
+
+    if( this_spi->xfer_rx_idx == this_spi->xfer_size )
+    {
+        HAL_set_8bit_reg_field( this_spi->base_addr, CTRL2_INTRXDATA, DISABLE );
+        HAL_set_8bit_reg_field( this_spi->base_addr, INTCLR_RXDATA, ENABLE );
+
+        /* The handler may start the next transfer. */
+        done_handler = this_spi->xfer_done_handler;
+        this_spi->xfer_busy = 0u;
+        if( NULL_XFER_DONE_HANDLER != done_handler )
+        {
+            done_handler( this_spi );
+        }
+    }
+}
@@ -18,6 +18,14 @@
 #include "hal/hal.h"
 #include "hal/hal_assert.h"
 
+#ifdef MIV_RV32_TRACE
+#include "miv_rv32_hal/miv_rv32_trace.h"
+#else
+#define MRV_TRACE(id, arg0, arg1)
+#define MRV_TRACE_BEGIN(id, arg0, arg1)
+#define MRV_TRACE_END(id, arg0, arg1)
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1082,6 +1090,8 @@ TSE_send_pkt(tse_instance_t *this_tse,
     /* TxPktSent Interrupt Enable. */
     HAL_set_32bit_reg_field(this_tse->base_addr, DMAINTRMASK_TXPKT_SENT, 0x1);
 
+    MRV_TRACE(MRV_TRACE_ID_TSE_TX_QUEUE, tx_length, status);
+
     return status;
 }
 
@@ -1099,6 +1109,8 @@ TSE_isr(tse_instance_t *this_tse)
 
     dma_irq = HAL_get_32bit_reg(this_tse->base_addr, DMAINTR);
 
+    MRV_TRACE_BEGIN(MRV_TRACE_ID_TSE_ISR, dma_irq, 0u);
+
     /* Transmit packet sent interrupt */
     packet_sent = dma_irq & TSE_TXPKTSENT_IRQ_MASK;
 
@@ -1211,6 +1223,8 @@ TSE_isr(tse_instance_t *this_tse)
             HAL_set_32bit_reg(this_tse->base_addr, CAR2, car2);
         }
     }
+
+    MRV_TRACE_END(MRV_TRACE_ID_TSE_ISR, dma_irq, 0u);
 }
 
 #ifndef CORE_TSE_IP_V3
@@ -1613,6 +1627,8 @@ rxpkt_handler(tse_instance_t *this_tse)
             p_rx_packet = (uint8_t *)cdesc->pkt_start_addr;
             pckt_length = (cdesc->pkt_size & DMA_DESC_PKT_SIZE_MASK) - 4u;
 
+            MRV_TRACE(MRV_TRACE_ID_TSE_RX_PKT, pckt_length, rxcnt);
+
             if (NULL_POINTER != this_tse->pckt_rx_callback)
             {
                 this_tse->pckt_rx_callback(p_rx_packet, pckt_length, cdesc->caller_info);
@@ -1642,6 +1658,8 @@ txpkt_handler(tse_instance_t *this_tse)
     {
         ++this_tse->nb_available_tx_desc;
 
+        MRV_TRACE(MRV_TRACE_ID_TSE_TX_DONE, index, this_tse->nb_available_tx_desc);
+
         /* Call packet Tx completion handler if it exists. */
         if (NULL_POINTER != this_tse->tx_complete_handler)
         {
@@ -0,0 +1,498 @@
+ /******************************************************************************
+ *
+ * (c) Copyright 2013 Microsemi SoC Products Group.  All rights reserved.
+ *
+ * Company: Microsemi Corporation
+ *
+ * File: spi_flash.h
+ *
+ * Note:
+ *
+ * This is a non DMA version of the flash driver for the CoreSPI 4.2.xx
+ * based on the driver for MSS SPI based driver from MPM 6.
+ *
+ * The SPI_FLASH_GET_STATUS command now returns the 2 bytes of the status
+ * via the pointer parameter and the PI_FLASH_GET_PROTECT command has been
+ * added.
+ *
+ * SVN $Revision: 8241 $
+ * SVN $Date: 2016-02-15 11:21:27 +0000 (Mon, 15 Feb 2016) $
+ *
+ *******************************************************************************/
+
+#ifndef __AT25DF641_SPI_FLASH_H_
+#define __AT25DF641_SPI_FLASH_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Possible return values from functions on SPI FLASH.
+ ******************************************************************************/
+typedef enum {
+    SPI_FLASH_SUCCESS = 0,
+    SPI_FLASH_PROTECTION_ERROR,
+    SPI_FLASH_WRITE_ERROR,
+    SPI_FLASH_INVALID_ARGUMENTS,
+    SPI_FLASH_INVALID_ADDRESS,
+    SPI_FLASH_UNSUCCESS
+} spi_flash_status_t;
+
+/*******************************************************************************
+ * Possible HW Control commands on SPI FLASH.
+ ******************************************************************************/
+typedef enum {
+    SPI_FLASH_SECTOR_UNPROTECT = 0,
+    SPI_FLASH_SECTOR_PROTECT,
+    SPI_FLASH_GLOBAL_UNPROTECT,
+    SPI_FLASH_GLOBAL_PROTECT,
+    SPI_FLASH_GET_STATUS,
+    SPI_FLASH_4KBLOCK_ERASE,
+    SPI_FLASH_32KBLOCK_ERASE,
+    SPI_FLASH_64KBLOCK_ERASE,
+    SPI_FLASH_CHIP_ERASE,
+    SPI_FLASH_READ_DEVICE_ID,
+    SPI_FLASH_RESET,
+    SPI_FLASH_GET_PROTECT
+/*
+    SPI_FLASH_SECTOR_LOCKDOWN,
+    SPI_FLASH_FREEZE_SECTOR_LOCKDOWN
+*/
+} spi_flash_control_hw_t;
+
+/*******************************************************************************
+ * Function called when a read started with spi_flash_read_async() is complete.
+ ******************************************************************************/
+typedef void (*spi_flash_read_handler_t)( void );
+
+/*******************************************************************************
+ * Function returning the data of a page programmed by spi_flash_program():
+ * length bytes, at offset bytes from the start of the data. It is called
+ * while the device programs the previous page, so it can produce the data
+ * (copy, decompress, receive...) without adding to the programming time. The
+ * returned buffer must remain valid until the next call. It returns null (0)
+ * to abort the programming.
+ ******************************************************************************/
+typedef const uint8_t * (*spi_flash_page_source_t)( void * p_ctx, uint32_t offset, uint32_t length );
+
+/*******************************************************************************
+ * Function called before the content of the flash is changed by a program or
+ * erase operation, with the address and size of the area changed. A chip
+ * erase is reported with address 0 and size 0xFFFFFFFF. It is used to keep
+ * copies of the flash content, such as a read cache, up to date.
+ ******************************************************************************/
+typedef void (*spi_flash_change_hook_t)( uint32_t address, uint32_t size );
+
+/*******************************************************************************
+ * Function called each time the device status is read busy while waiting for
+ * the end of a program or erase operation, with the number of busy status
+ * reads so far for this wait. It lets an RTOS task sleep between two reads
+ * of the status instead of keeping the processor busy.
+ ******************************************************************************/
+typedef void (*spi_flash_wait_hook_t)( uint32_t nb_polls );
+
+/*******************************************************************************
+ * Options of spi_flash_erase_range().
+ ******************************************************************************/
+#define SPI_FLASH_ERASE_SKIP_BLANK      0x01u   /* Do not erase blank blocks */
+
+/*******************************************************************************
+ * Erases performed by spi_flash_erase_range().
+ ******************************************************************************/
+typedef struct {
+    uint32_t sectors_erased;    /* 64KB sector erases */
+    uint32_t blocks_erased;     /* 4KB block erases */
+    uint32_t blocks_skipped;    /* 4KB blocks found blank and not erased */
+} spi_flash_erase_report_t;
+
+/*******************************************************************************
+ * Blocks compared and rewritten by spi_flash_update().
+ ******************************************************************************/
+typedef struct {
+    uint32_t blocks_unchanged;  /* 4KB blocks already holding the data */
+    uint32_t blocks_updated;    /* 4KB blocks erased and programmed */
+} spi_flash_update_report_t;
+
+struct device_Info{
+    uint8_t manufacturer_id;
+    uint8_t device_id;
+    uint8_t mem_cap;
+};
+
+/*******************************************************************************
+ * This function initialzes the SPI peripheral for data transfer
+ ******************************************************************************/
+spi_flash_status_t
+spi_flash_init
+(
+    uint32_t base_addr
+);
+
+/******************************************************************************
+ * This function performs the various operations on the serial Flash
+ * based on the command passed as first parameter.
+ * The operation of the each command is explained below.
+ *
+ * @param operation
+ *        The operations supported are as per the enum spi_flash_control_hw_t
+ *        defined above. The functionality is as follows:
+ *
+ *        1. SPI_FLASH_SECTOR_UNPROTECT: Every 64KBytes are represented
+ *           in sectors. There is a corresponding bits set for protection
+ *           of that sector. To do modify operations like write and erase
+ *           we need to call this operation to unprotect the block.
+ *           The second parameter 'param1' for this function is the block
+ *           address to unprotect.
+ *
+ *        2. SPI_FLASH_SECTOR_PROTECT :  Every 64KBytes are represented
+ *           in sectors. There is a corresponding bits set for protection
+ *           of that sector. To protect from the modify operations like
+ *           write and erase we need to call this operation
+ *           to protect the block. The second parameter 'param1' for this
+ *           function is the block address to protect.
+ *
+ *        3. SPI_FLASH_GLOBAL_UNPROTECT: This command is used to unprotect
+ *           the entire flash for modify operations.
+ *
+ *        4. SPI_FLASH_GLOBAL_PROTECT: This command is used to protect/lock
+ *           the entire flash from modify operations.
+ *
+ *        5. SPI_FLASH_GET_STATUS: This function used to get the SPI Flash
+ *           status register content for more details of the status bits
+ *           refer to the data sheet for the AT25DF641. The second parameter
+ *           is ignored and the third parameter points to an unsigned 16 bit
+ *           value to store the status in. The first status byte is in b0-7
+ *           and the second status byte in b8-15.
+ *
+ *        6. SPI_FLASH_4KBLOCK_ERASE: This command is used to erase the block
+ *           starting at 4KB boundary. The starting address of the 4K Block is
+ *           passed in the second parameter param1 of this API.
+ *
+ *        7. SPI_FLASH_32KBLOCK_ERASE: This command is used to erase the block
+ *           starting at 32KB boundary. The starting address of the 32K Block
+ *           is passed in the second parameter param1 of this API.
+ *
+ *        8. SPI_FLASH_64KBLOCK_ERASE: This command is used to erase the block
+ *           starting at 64KB boundary. The starting address of the 64K Block
+ *           is passed in the second parameter peram1 of this API.
+ *
+ *        9. SPI_FLASH_CHIP_ERASE This command is used to erase the entire flash chip.
+ *
+ *        10. SPI_FLASH_READ_DEVICE_ID: This command is used to read the
+ *            device properties. The values are filled in the third parameter
+ *            'ptrParam' of this API,
+ *
+ *        11. SPI_FLASH_RESET: In some cases it may be necessary to prematurely terminate
+ *            a program or erase cycle early rather than wait the hundreds of microseconds or
+ *            milliseconds necessary for the program or erase operation to complete normally.
+ *            The Reset command allows a program or erase operation in progress to be ended
+ *            abruptly and returns the device to an idle state.
+ *
+ *        12. SPI_FLASH_GET_PROTECT: Read the sector protection register for the sector in.
+ *            question. Should be 0x00 if unprotected and 0xFF if protected. The second
+ *            parameter is an address within the 64K sector we are examining. The third
+ *            parameter is a pointer to an unsigned 8 bit location to store the protection
+ *            register value in.
+ *
+ * @param param1        The param1 usage is explained in the above description according
+ *                      to command in use.
+ * @param ptrParam      The ptrParam usage is explained in the above description according
+ *                      to command in use.
+ * @return              The return value indicates if the write was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_PROTECTION_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_INVALID_ADDRESS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_SUCCESS: describes the SPI Flash operation is
+ *                      correct and complete
+ *
+ *                      SPI_FLASH_PROTECTION_ERROR: The sector is under protected and
+ *                      not allowing the operation.
+ *                      We need to do the unprotect and do the operation
+ *
+ *                      SPI_FLASH_INVALID_ARGUMENTS: describes that function has received
+ *                      Invalid arguments
+ *
+ *                      SPI_FLASH_INVALID_ADDRESS: describes that function has received
+ *                      Invalid address
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the SPI Flash operation is
+ *                      incomplete
+ */
+
+spi_flash_status_t
+spi_flash_control_hw
+(
+    spi_flash_control_hw_t operation,
+    uint32_t peram1,
+    void *   ptrPeram
+);
+
+/*******************************************************************************
+ * This function reads the content from the serial Flash.
+ * The data is read from the memory location specified by the first parameter.
+ * This address is ranges from 0 to SPI Flash Size. This address range is not
+ * the processors absolute range.
+ *
+ * @param start_addr    This is the address at which data willbe read.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ *                      This address range is not the processors absolute range.
+ * @param p_data        This is a pointer to the buffer for holding the read data.
+ * @param nb_bytes      This is the number of bytes to be read from SPI Flash.
+ * @return              The return value indicates if the write was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_PROTECTION_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_INVALID_ADDRESS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_SUCCESS: describes the SPI Flash operation is
+ *                      correct and complete
+ *
+ *                      SPI_FLASH_INVALID_ARGUMENTS: describes that function has received
+ *                      Invalid arguments
+ *
+ *                      SPI_FLASH_INVALID_ADDRESS: describes that function has received
+ *                      Invalid address
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the SPI Flash operation is
+ *                      incomplete
+ */
+spi_flash_status_t
+spi_flash_read
+(
+    uint32_t address,
+    uint8_t * rx_buffer,
+    size_t size_in_bytes
+);
+
+/*******************************************************************************
+ * This function starts reading the content of Serial Flash into the buffer
+ * passed as parameter and returns without waiting for the data. The data is
+ * transferred by the CoreSPI interrupt, so the application must call
+ * SPI_isr( &g_flash_core_spi ) from the interrupt handler of the processor
+ * interrupt the CoreSPI SPIINT output is connected to.
+ * The rx_buffer must remain valid, and no other function of this driver must
+ * be called, until the read is complete.
+ *
+ * @param address       This is the address from which data will be read.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ *                      This address range is not the processors absolute range
+ * @param rx_buffer     This is a pointer to the buffer receiving the data.
+ * @param size_in_bytes This is the number of bytes to be read.
+ * @param handler       This is the function called from the interrupt handler
+ *                      once the read is complete. It can be null (0) if
+ *                      spi_flash_is_read_busy() is polled instead.
+ * @return              The return value indicates if the read was started.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_SUCCESS: describes the read is in progress
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the device did not
+ *                      become ready or a read is already in progress
+ */
+spi_flash_status_t
+spi_flash_read_async
+(
+    uint32_t address,
+    uint8_t * rx_buffer,
+    size_t size_in_bytes,
+    spi_flash_read_handler_t handler
+);
+
+/*******************************************************************************
+ * This function indicates whether a read started with spi_flash_read_async()
+ * is in progress.
+ *
+ * @return              1 while the read is in progress, 0 otherwise.
+ */
+uint8_t spi_flash_is_read_busy( void );
+
+/*******************************************************************************
+ * This function writes the content of the buffer passed as parameter to
+ * Serial Flash through SPI. The data is written from the memory location specified
+ * by the first parameter.
+ * This address is ranges from 0 to SPI Flash Size. This address range is not
+ * the processors absolute range
+ *
+ * @param start_addr    This is the address at which data will be written.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ *                      This address range is not the processors absolute range
+ * @param p_data        This is a pointer to the buffer holding the data to be
+ *                      written into Serial Flash.
+ * @param nb_bytes      This is the number of bytes to be written into Serial Flash.
+ * @return              The return value indicates if the write was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_PROTECTION_ERROR,
+ *                      SPI_FLASH_WRITE_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_INVALID_ADDRESS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_SUCCESS: describes the SPI Flash operation is
+ *                      correct and complete
+ *
+ *                      SPI_FLASH_PROTECTION_ERROR: The sector is under protected and
+ *                      not allowing the operation.
+ *                      We need to do the unprotect and do the operation
+ *
+ *                      SPI_FLASH_WRITE_ERROR: describes the SPI Flash write operation is
+ *                      failed
+ *
+ *                      SPI_FLASH_INVALID_ARGUMENTS: describes that function has received
+ *                      Invalid arguments
+ *
+ *                      SPI_FLASH_INVALID_ADDRESS: describes that function has received
+ *                      Invalid address. Address range should be between 0 to 8 MB
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the SPI Flash operation is
+ *                      incomplete
+ */
+
+spi_flash_status_t
+spi_flash_write
+(
+    uint32_t address,
+    uint8_t * write_buffer,
+    size_t size_in_bytes
+);
+
+/*******************************************************************************
+ * This function programs Serial Flash one page at a time, with the data
+ * returned by the source function passed as parameter. The area must have
+ * been erased.
+ * For each page, the sector is unprotected only if it is not already known to
+ * be unprotected, then the write enable and page program commands are sent
+ * and the device status is polled once, for the end of the program. The data
+ * of the next page is requested from the source while the device programs
+ * the current one. spi_flash_write() uses this function, unless
+ * SPI_FLASH_LEGACY_WRITE is defined: it then uses the previous write sequence,
+ * which unprotects the sector on each call and polls the device status
+ * several times per page, to compare the programming throughput.
+ *
+ * @param address       This is the address at which data will be written.
+ *                      This address is ranges from 0 to SPI Flash Size.
+ * @param size_in_bytes This is the number of bytes to be written.
+ * @param source        This is the function returning the data of each page.
+ * @param p_ctx         This is the context passed to the source function.
+ * @return              The return value indicates if the write was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_WRITE_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_WRITE_ERROR: describes the device did not
+ *                      complete a page program in time
+ *
+ *                      SPI_FLASH_UNSUCCESS: describes the device did not
+ *                      become ready or the source aborted the programming
+ */
+spi_flash_status_t
+spi_flash_program
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    spi_flash_page_source_t source,
+    void * p_ctx
+);
+
+/*******************************************************************************
+ * This function erases the 4KB blocks covering a range of Serial Flash with
+ * the cheapest mix of 64KB sector and 4KB block erases.
+ * Sectors entirely inside the range are erased with one sector erase, unless
+ * erasing their non-blank blocks one by one is quicker, based on the typical
+ * erase times SPI_FLASH_4K_ERASE_MS and SPI_FLASH_64K_ERASE_MS. Blocks of
+ * partially covered sectors are erased one by one. The sectors are
+ * unprotected as needed.
+ * With the SPI_FLASH_ERASE_SKIP_BLANK option, each block is first read and is
+ * not erased if it only holds 0xFF bytes. Reading a block takes a few
+ * milliseconds, much less than erasing it, and stops at the first programmed
+ * byte.
+ *
+ * @param address       This is the start address of the range. It is rounded
+ *                      down to a 4KB boundary.
+ * @param size_in_bytes This is the size of the range. Its end is rounded up to
+ *                      a 4KB boundary.
+ * @param options       This is 0 or SPI_FLASH_ERASE_SKIP_BLANK.
+ * @param p_report      This is a pointer to a structure receiving the number
+ *                      of erases performed and of blocks skipped, or null (0).
+ * @return              The return value indicates if the erase was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ */
+spi_flash_status_t
+spi_flash_erase_range
+(
+    uint32_t address,
+    size_t size_in_bytes,
+    uint8_t options,
+    spi_flash_erase_report_t * p_report
+);
+
+/*******************************************************************************
+ * This function writes data to Serial Flash, only erasing and programming the
+ * 4KB blocks whose content differs. Each block is read and compared with the
+ * data first, which takes a few milliseconds, while erasing and programming
+ * it takes tens of milliseconds and wears the device. Rewritten blocks are
+ * read back and checked.
+ * Whole blocks are written, so that no data outside of the range is erased.
+ *
+ * @param address       This is the address at which data will be written. It
+ *                      must be aligned on a 4KB boundary.
+ * @param p_data        This is a pointer to the data to write.
+ * @param size_in_bytes This is the number of bytes to write. It must be a
+ *                      multiple of 4KB.
+ * @param p_report      This is a pointer to a structure receiving the number
+ *                      of blocks left unchanged and rewritten, or null (0).
+ * @return              The return value indicates if the update was successful.
+ *                      Possible values are:
+ *                      SPI_FLASH_SUCCESS,
+ *                      SPI_FLASH_WRITE_ERROR,
+ *                      SPI_FLASH_INVALID_ARGUMENTS,
+ *                      SPI_FLASH_UNSUCCESS
+ *
+ *                      SPI_FLASH_WRITE_ERROR: describes a rewritten block
+ *                      does not hold the data
+ */
+spi_flash_status_t
+spi_flash_update
+(
+    uint32_t address,
+    const uint8_t * p_data,
+    size_t size_in_bytes,
+    spi_flash_update_report_t * p_report
+);
+
+/*******************************************************************************
+ * This function registers the function called before the content of the flash
+ * is changed by spi_flash_write(), spi_flash_program(), spi_flash_erase_range(),
+ * spi_flash_update() or an erase through spi_flash_control_hw(). Only one
+ * function is registered at a time.
+ *
+ * @param hook          This is the function to call, or null (0) to remove
+ *                      the registered function.
+ */
+void spi_flash_set_change_hook( spi_flash_change_hook_t hook );
+
+/*******************************************************************************
+ * This function registers the function called between two reads of the device
+ * status while the device is busy. Without it, the status is read again
+ * straight away. The waits are still bounded by SPI_FLASH_READY_TIMEOUT_MS
+ * and SPI_FLASH_ERASE_TIMEOUT_MS. Only one function is registered at a time.
+ *
+ * @param hook          This is the function to call, or null (0) to remove
+ *                      the registered function.
+ */
+void spi_flash_set_wait_hook( spi_flash_wait_hook_t hook );
+
+#endif
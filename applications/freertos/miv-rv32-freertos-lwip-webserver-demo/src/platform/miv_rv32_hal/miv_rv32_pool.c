@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_pool.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Fixed-block memory pool allocator for Mi-V soft processors. See file
+ * "miv_rv32_pool.h" for description of the functions implemented in this file.
+ *
+ */
+#include "miv_rv32_hal.h"
+#include "miv_rv32_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * MRV_pool_init()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+uint32_t MRV_pool_init
+(
+    mrv_pool_t * p_pool,
+    void * p_mem,
+    uint32_t mem_size,
+    uint32_t block_size
+)
+{
+    block_size = MRV_POOL_BLOCK_SIZE(block_size);
+
+    ASSERT(0u == ((uintptr_t)p_mem & (MRV_POOL_ALIGN - 1u)));
+    ASSERT(block_size >= sizeof(void *));
+
+    p_pool->p_free = 0;
+    p_pool->p_start = (uint8_t *)p_mem;
+    p_pool->p_next_unused = p_pool->p_start;
+    p_pool->block_size = block_size;
+    p_pool->nb_blocks = mem_size / block_size;
+    p_pool->p_end = p_pool->p_start + (p_pool->nb_blocks * block_size);
+    p_pool->nb_used = 0u;
+    p_pool->high_water = 0u;
+    p_pool->nb_failed = 0u;
+
+    return p_pool->nb_blocks;
+}
+
+/***************************************************************************//**
+ * MRV_pool_alloc()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void * MRV_pool_alloc(mrv_pool_t * p_pool)
+{
+    void * p_block = p_pool->p_free;
+
+    if (0 != p_block)
+    {
+        /* Unlink the first free block. */
+        p_pool->p_free = *(void **)p_block;
+    }
+    else if (p_pool->p_next_unused < p_pool->p_end)
+    {
+        /* Carve a block which has never been used. */
+        p_block = p_pool->p_next_unused;
+        p_pool->p_next_unused += p_pool->block_size;
+    }
+    else
+    {
+        p_pool->nb_failed++;
+        return 0;
+    }
+
+    p_pool->nb_used++;
+    if (p_pool->nb_used > p_pool->high_water)
+    {
+        p_pool->high_water = p_pool->nb_used;
+    }
+
+    return p_block;
+}
+
+/***************************************************************************//**
+ * MRV_pool_free()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void MRV_pool_free(mrv_pool_t * p_pool, void * p_block)
+{
+    if (0 == p_block)
+    {
+        return;
+    }
+
+    ASSERT(((uint8_t *)p_block >= p_pool->p_start) &&
+           ((uint8_t *)p_block < p_pool->p_next_unused));
+    ASSERT(0u != p_pool->nb_used);
+
+    *(void **)p_block = p_pool->p_free;
+    p_pool->p_free = p_block;
+    p_pool->nb_used--;
+}
+
+/***************************************************************************//**
+ * MRV_pool_alloc_isr_safe()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void * MRV_pool_alloc_isr_safe(mrv_pool_t * p_pool)
+{
+    void * p_block;
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    p_block = MRV_pool_alloc(p_pool);
+    write_csr(mstatus, mstatus);
+
+    return p_block;
+}
+
+/***************************************************************************//**
+ * MRV_pool_free_isr_safe()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void MRV_pool_free_isr_safe(mrv_pool_t * p_pool, void * p_block)
+{
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    MRV_pool_free(p_pool, p_block);
+    write_csr(mstatus, mstatus);
+}
+
+/***************************************************************************//**
+ * MRV_pool_get_stats()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void MRV_pool_get_stats(mrv_pool_t * p_pool, mrv_pool_stats_t * p_stats)
+{
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    p_stats->block_size = p_pool->block_size;
+    p_stats->nb_blocks = p_pool->nb_blocks;
+    p_stats->nb_used = p_pool->nb_used;
+    p_stats->high_water = p_pool->high_water;
+    p_stats->nb_failed = p_pool->nb_failed;
+    write_csr(mstatus, mstatus);
+}
+
+/***************************************************************************//**
+ * MRV_pool_reset_high_water()
+ * See "miv_rv32_pool.h" for details of how to use this function.
+ */
+void MRV_pool_reset_high_water(mrv_pool_t * p_pool)
+{
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    p_pool->high_water = p_pool->nb_used;
+    p_pool->nb_failed = 0u;
+    write_csr(mstatus, mstatus);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_pool.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Fixed-block memory pool allocator for Mi-V soft processors.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Fixed-Block Pool Allocator
+  =======================================
+  A pool manages a contiguous memory area divided into blocks of the same size.
+  Allocating and releasing a block takes a constant number of instructions
+  whatever the state of the pool: free blocks are kept in a singly linked list
+  threaded through their first word, and blocks which were never used are
+  carved from the end of the area on demand. There is no fragmentation, so a
+  pool sized for the worst case never fails over a long uptime, unlike the C
+  library malloc() built on _sbrk().
+
+  Typical uses are packet buffers, MMC blocks and cryptographic scratch areas
+  which must be obtained from interrupt handlers or at a predictable cost.
+
+  --------------------------------
+  Declaring a pool
+  --------------------------------
+  A pool and its memory are declared at compile time with MRV_POOL_DEFINE() and
+  can be used straight away, no initialization call is needed:
+
+      MRV_POOL_DEFINE(g_mmc_block_pool, 512u, 4u);
+
+      uint32_t * p_block = MRV_pool_alloc(&g_mmc_block_pool);
+      ...
+      MRV_pool_free(&g_mmc_block_pool, p_block);
+
+  A pool can also be placed over a memory area which is not known to the
+  linker, such as a buffer memory reachable by a DMA master, using
+  MRV_pool_init().
+
+  Block sizes are rounded up to a multiple of MRV_POOL_ALIGN bytes and the
+  blocks are aligned to MRV_POOL_ALIGN bytes.
+
+  --------------------------------
+  Concurrency
+  --------------------------------
+  MRV_pool_alloc() and MRV_pool_free() do not protect the pool. They must only
+  be used when all the users of a pool run in the same context (for example a
+  single task, or interrupt handlers only).
+
+  MRV_pool_alloc_isr_safe() and MRV_pool_free_isr_safe() run the same
+  operation with interrupts disabled, in the same way as the HAL critical
+  section HAL_disable_interrupts()/HAL_restore_interrupts(). They can be
+  called from any context, for example a buffer allocated by a task and
+  released by the interrupt handler signalling the end of a DMA transfer.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_POOL_H
+#define MIV_RV32_POOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MRV_POOL_ALIGN
+#define MRV_POOL_ALIGN                  4u
+#endif
+
+/***************************************************************************//**
+  Size of a block, in bytes, once rounded up to the pool alignment.
+ */
+#define MRV_POOL_BLOCK_SIZE(size) \
+    ((((uint32_t)(size)) + (MRV_POOL_ALIGN - 1u)) & ~(MRV_POOL_ALIGN - 1u))
+
+/***************************************************************************//**
+  The mrv_pool_t structure holds the state of a pool. The application must not
+  access its members directly, use MRV_pool_get_stats() instead.
+ */
+typedef struct
+{
+    void *    p_free;
+    uint8_t * p_next_unused;
+    uint8_t * p_start;
+    uint8_t * p_end;
+    uint32_t  block_size;
+    uint32_t  nb_blocks;
+    uint32_t  nb_used;
+    uint32_t  high_water;
+    uint32_t  nb_failed;
+} mrv_pool_t;
+
+/***************************************************************************//**
+  The mrv_pool_stats_t structure is filled by MRV_pool_get_stats().
+
+    - block_size:   size of a block in bytes, after rounding
+    - nb_blocks:    total number of blocks in the pool
+    - nb_used:      number of blocks currently allocated
+    - high_water:   highest number of blocks allocated at the same time
+    - nb_failed:    number of allocation requests which could not be served
+ */
+typedef struct
+{
+    uint32_t block_size;
+    uint32_t nb_blocks;
+    uint32_t nb_used;
+    uint32_t high_water;
+    uint32_t nb_failed;
+} mrv_pool_stats_t;
+
+/***************************************************************************//**
+  The MRV_POOL_DEFINE() macro declares a pool named name holding nb_blocks
+  blocks of block_size bytes, together with the memory for the blocks. The pool
+  is ready to use without calling MRV_pool_init(). Prefix the macro with
+  static to limit the scope of the pool to one file.
+ */
+#define MRV_POOL_DEFINE(name, block_size, nb_blocks) \
+    uint32_t name##_mem[(MRV_POOL_BLOCK_SIZE(block_size) * (nb_blocks)) / \
+                        sizeof(uint32_t)] \
+        __attribute__((aligned(MRV_POOL_ALIGN))); \
+    mrv_pool_t name = \
+    { \
+        0, \
+        (uint8_t *)name##_mem, \
+        (uint8_t *)name##_mem, \
+        (uint8_t *)name##_mem + \
+            (MRV_POOL_BLOCK_SIZE(block_size) * (nb_blocks)), \
+        MRV_POOL_BLOCK_SIZE(block_size), \
+        (nb_blocks), \
+        0u, \
+        0u, \
+        0u \
+    }
+
+/***************************************************************************//**
+  The MRV_pool_init() function places a pool over the memory area passed as
+  parameter. Any block previously allocated from the pool is forgotten.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @param p_mem
+  Start of the memory area. It must be aligned to MRV_POOL_ALIGN bytes.
+
+  @param mem_size
+  Size of the memory area in bytes.
+
+  @param block_size
+  Size of each block in bytes. It is rounded up to a multiple of
+  MRV_POOL_ALIGN.
+
+  @return
+  This function returns the number of blocks available in the pool.
+ */
+uint32_t MRV_pool_init
+(
+    mrv_pool_t * p_pool,
+    void * p_mem,
+    uint32_t mem_size,
+    uint32_t block_size
+);
+
+/***************************************************************************//**
+  The MRV_pool_alloc() function takes one block from a pool. The content of the
+  block is not initialized.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @return
+  This function returns a pointer to the block, or 0 when all the blocks of the
+  pool are in use.
+ */
+void * MRV_pool_alloc(mrv_pool_t * p_pool);
+
+/***************************************************************************//**
+  The MRV_pool_free() function returns a block to the pool it was allocated
+  from.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @param p_block
+  Pointer to the block, as returned by MRV_pool_alloc(). Passing 0 has no
+  effect.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_pool_free(mrv_pool_t * p_pool, void * p_block);
+
+/***************************************************************************//**
+  The MRV_pool_alloc_isr_safe() function is the same as MRV_pool_alloc() but
+  can be called from any task or interrupt context.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @return
+  This function returns a pointer to the block, or 0 when all the blocks of the
+  pool are in use.
+ */
+void * MRV_pool_alloc_isr_safe(mrv_pool_t * p_pool);
+
+/***************************************************************************//**
+  The MRV_pool_free_isr_safe() function is the same as MRV_pool_free() but can
+  be called from any task or interrupt context.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @param p_block
+  Pointer to the block. Passing 0 has no effect.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_pool_free_isr_safe(mrv_pool_t * p_pool, void * p_block);
+
+/***************************************************************************//**
+  The MRV_pool_get_stats() function reads the usage statistics of a pool.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @param p_stats
+  Pointer to the structure receiving the statistics.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_pool_get_stats(mrv_pool_t * p_pool, mrv_pool_stats_t * p_stats);
+
+/***************************************************************************//**
+  The MRV_pool_reset_high_water() function sets the high-water mark of a pool
+  to the number of blocks currently in use and clears the count of failed
+  allocations.
+
+  @param p_pool
+  Pointer to the pool.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_pool_reset_high_water(mrv_pool_t * p_pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_POOL_H */
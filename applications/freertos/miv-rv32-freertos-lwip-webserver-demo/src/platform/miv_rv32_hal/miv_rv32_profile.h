@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_profile.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Statistical PC-sampling profiler for Mi-V soft processors.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 PC-Sampling Profiler
+  =======================================
+  The profiler periodically records the program counter of the interrupted code
+  (the mepc CSR) into a fixed-size table of address/count pairs. After a
+  measurement run, the table is printed as text through an application supplied
+  output function (typically a UART) and symbolized on the host against the ELF
+  file using the mrv_profile.py script provided in the scripts folder of the
+  project.
+
+  No trace probe is required. The profiler does not use dynamic memory and the
+  sampling function is bounded in time, so it is safe to call from any
+  interrupt handler.
+
+  --------------------------------
+  Sampling source
+  --------------------------------
+  When the MIV_RV32_PROFILER macro is defined in the project settings, the HAL
+  machine timer interrupt handler, handle_m_timer_interrupt(), takes one sample
+  on each system tick before calling SysTick_Handler(). The sampling rate is
+  therefore the rate passed to MRV_systick_config(). A tick rate in the range
+  of 1 to 10 kHz gives a useful resolution.
+
+  When the machine timer is owned by an operating system (for example FreeRTOS)
+  or a dedicated timer such as CoreTimer is preferred, call MRV_profile_sample()
+  from that timer's interrupt handler (for FreeRTOS, from
+  vApplicationTickHook()) with the value of the mepc CSR:
+
+      MRV_profile_sample(read_csr(mepc));
+
+  The mepc CSR holds the address of the interrupted instruction for as long as
+  the interrupt handler runs with interrupts disabled, which is the case for
+  the HAL trap handler and the FreeRTOS RISC-V port.
+
+  --------------------------------
+  Configuration
+  --------------------------------
+  | Macro Name              | Default | Description                            |
+  |-------------------------|---------|----------------------------------------|
+  | MIV_RV32_PROFILER       |  undef  | Sample from handle_m_timer_interrupt() |
+  | MRV_PROFILE_TABLE_SIZE  |   512   | Number of address/count entries. Must  |
+  |                         |         | be a power of two.                     |
+  | MRV_PROFILE_PC_SHIFT    |    0    | Right shift applied to the PC before   |
+  |                         |         | it is counted. Larger values merge     |
+  |                         |         | neighbouring instructions into one bin.|
+  | MRV_PROFILE_MAX_PROBE   |    8    | Maximum number of table slots searched |
+  |                         |         | for a free or matching entry.          |
+
+  Samples which can not be placed in the table because MRV_PROFILE_MAX_PROBE
+  slots are already used by other addresses are counted as dropped.
+
+  --------------------------------
+  Output format
+  --------------------------------
+  MRV_profile_dump() emits the following lines:
+
+      MRV_PROFILE_BEGIN samples=<n> dropped=<n> shift=<n>
+      0x<address> <count>
+      ...
+      MRV_PROFILE_END
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_PROFILE_H
+#define MIV_RV32_PROFILE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MRV_PROFILE_TABLE_SIZE
+#define MRV_PROFILE_TABLE_SIZE          512u
+#endif
+
+#ifndef MRV_PROFILE_PC_SHIFT
+#define MRV_PROFILE_PC_SHIFT            0u
+#endif
+
+#ifndef MRV_PROFILE_MAX_PROBE
+#define MRV_PROFILE_MAX_PROBE           8u
+#endif
+
+#if ((MRV_PROFILE_TABLE_SIZE & (MRV_PROFILE_TABLE_SIZE - 1u)) != 0u)
+#error "MRV_PROFILE_TABLE_SIZE must be a power of two"
+#endif
+
+/***************************************************************************//**
+  The mrv_profile_write_t type is the prototype of the function used by
+  MRV_profile_dump() to output the profile. It receives a NULL terminated
+  string. For example, a wrapper around UART_polled_tx_string().
+ */
+typedef void (*mrv_profile_write_t)(const char * str);
+
+/***************************************************************************//**
+  The MRV_profile_start() function clears the sample table and enables
+  sampling.
+
+  @param
+  This function does not take any parameters.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_profile_start(void);
+
+/***************************************************************************//**
+  The MRV_profile_stop() function disables sampling. The samples taken so far
+  are kept until the next call to MRV_profile_start().
+
+  @param
+  This function does not take any parameters.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_profile_stop(void);
+
+/***************************************************************************//**
+  The MRV_profile_sample() function records one sample. It is intended to be
+  called from a timer interrupt handler with the value of the mepc CSR. Samples
+  are ignored while the profiler is stopped.
+
+  @param pc
+  The address of the interrupted instruction.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_profile_sample(uintptr_t pc);
+
+/***************************************************************************//**
+  The MRV_profile_dump() function outputs the address/count pairs recorded
+  since the last call to MRV_profile_start(). Sampling is suspended while the
+  table is being output and resumed afterwards if it was running.
+
+  @param write_fn
+  Function used to output each line of text.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_profile_dump(mrv_profile_write_t write_fn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_PROFILE_H */
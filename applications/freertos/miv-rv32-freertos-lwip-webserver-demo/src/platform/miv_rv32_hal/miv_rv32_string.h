@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_string.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Word-optimized memory copy, fill and compare functions for Mi-V soft
+ * processors.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Memory Functions
+  =======================================
+  The memcpy(), memset() and memcmp() functions of the newlib-nano C library
+  delivered with SoftConsole are built for size and handle one byte per loop
+  iteration. Copying an Ethernet frame or a flash page with them costs several
+  instructions per byte.
+
+  The functions in this file move data one 32 bit word at a time:
+    - when the source and destination are both word aligned, or can be
+      aligned by handling a few bytes first, the data is moved by blocks of
+      eight words, then word by word, then the last bytes one by one,
+    - when the source and destination alignments differ, MRV_memcpy() still
+      reads and writes whole aligned words, building each destination word
+      from two consecutive source words with shifts,
+    - buffers shorter than MRV_STRING_SMALL_SIZE bytes are handled byte by
+      byte, which is faster than aligning them.
+
+  A misaligned copy reads the whole aligned words containing the first and
+  last bytes of the source buffer, so up to three bytes before and after the
+  buffer are read. They are never written.
+
+  --------------------------------
+  Replacing the C library functions
+  --------------------------------
+  Drivers and middleware can call MRV_memcpy(), MRV_memset() and MRV_memcmp()
+  directly; the lwIP stack uses MRV_memcpy() through the MEMCPY macro of
+  lwipopts.h. SMEMCPY is left as memcpy(), so that the compiler can inline the
+  small copies, and reaches MRV_memcpy() only through the alias described
+  below.
+
+  When MRV_STRING_REPLACE_LIBC is defined in the compiler settings, the file
+  miv_rv32_string.c also defines memcpy(), memset() and memcmp() as aliases
+  of these functions. The object files of the project are linked before the
+  C library, so the linker uses these definitions for every call in the
+  application, including the calls generated by the compiler for structure
+  copies, and does not pull in the C library versions.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_STRING_H
+#define MIV_RV32_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Buffers shorter than MRV_STRING_SMALL_SIZE bytes are processed byte by byte.
+ */
+#ifndef MRV_STRING_SMALL_SIZE
+#define MRV_STRING_SMALL_SIZE           12u
+#endif
+
+/***************************************************************************//**
+  The MRV_memcpy() function copies a buffer. The buffers must not overlap.
+
+  @param p_dest
+  Destination buffer.
+
+  @param p_src
+  Source buffer.
+
+  @param n
+  Number of bytes to copy.
+
+  @return
+  This function returns p_dest.
+ */
+void * MRV_memcpy(void * p_dest, const void * p_src, size_t n);
+
+/***************************************************************************//**
+  The MRV_memset() function fills a buffer with a byte value.
+
+  @param p_dest
+  Buffer to fill.
+
+  @param value
+  Fill value, converted to an unsigned char.
+
+  @param n
+  Number of bytes to fill.
+
+  @return
+  This function returns p_dest.
+ */
+void * MRV_memset(void * p_dest, int value, size_t n);
+
+/***************************************************************************//**
+  The MRV_memcmp() function compares two buffers. The word path is used when
+  both buffers have the same alignment.
+
+  @param p_buf1
+  First buffer.
+
+  @param p_buf2
+  Second buffer.
+
+  @param n
+  Number of bytes to compare.
+
+  @return
+  This function returns 0 when the buffers are equal. Otherwise it returns a
+  negative or positive value when the first differing byte, taken as an
+  unsigned char, is lower or higher in p_buf1 than in p_buf2.
+ */
+int MRV_memcmp(const void * p_buf1, const void * p_buf2, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_STRING_H */
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_time.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief High resolution timebase, delays and deadlines for Mi-V soft
+ * processors.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Timebase and Delays
+  =======================================
+  The functions in this file measure time with the mcycle/mcycleh CSRs, which
+  count processor clock cycles. Reading them is a local CSR access taking a
+  couple of instructions, where MRV_read_mtime() goes through the bus to the
+  memory-mapped MTIME register, whose resolution is only SYS_CLK_FREQ divided
+  by MTIME_PRESCALER. The timebase does not depend on the machine timer
+  interrupt and can be used before MRV_systick_config() is called, or with
+  interrupts disabled.
+
+  Conversions between ticks and time units are based on the SYS_CLK_FREQ
+  value of the fpga_design_config.h file, so that value must match the clock
+  actually driving the processor. Conversions to ticks round up, so a delay
+  or timeout is never shorter than requested.
+
+  --------------------------------
+  Delays
+  --------------------------------
+  MRV_delay_cycles(), MRV_delay_us() and MRV_delay_ms() busy-wait for the
+  requested time. Interrupts remain enabled; time spent in interrupt handlers
+  counts towards the delay.
+
+  --------------------------------
+  Deadlines
+  --------------------------------
+  A deadline records the time at which an operation must have completed. It
+  lets a driver bound a polling loop in real time instead of by a number of
+  iterations, whose duration depends on the clock frequency, the bus and the
+  compiler optimizations:
+
+      mrv_deadline_t deadline;
+
+      MRV_deadline_set_ms(&deadline, 10u);
+      while (device_busy())
+      {
+          if (MRV_deadline_expired(&deadline))
+          {
+              return TIMEOUT;
+          }
+      }
+
+  The 64 bit cycle count does not wrap during the lifetime of a device, so
+  deadlines of any length can be compared safely.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_TIME_H
+#define MIV_RV32_TIME_H
+
+#include <stdint.h>
+#include "miv_rv32_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Number of timebase ticks per second.
+ */
+#define MRV_TIME_TICKS_PER_SEC          ((uint32_t)SYS_CLK_FREQ)
+
+/***************************************************************************//**
+  The mrv_deadline_t structure holds the timebase value at which a deadline
+  expires. It is set with MRV_deadline_set_ticks(), MRV_deadline_set_us() or
+  MRV_deadline_set_ms().
+ */
+typedef struct
+{
+    uint64_t expiry;
+} mrv_deadline_t;
+
+/***************************************************************************//**
+  The MRV_time_now() function returns the 64 bit timebase value. The high
+  word is read again until it is stable so the value is consistent when the
+  low word wraps between the two reads.
+
+  @return
+  Number of processor clock cycles since reset.
+ */
+static inline uint64_t MRV_time_now(void)
+{
+    uint32_t hi;
+    uint32_t lo;
+
+    do {
+        hi = read_csr(mcycleh);
+        lo = read_csr(mcycle);
+    } while (hi != read_csr(mcycleh));
+
+    return (((uint64_t)hi) << 32u) | lo;
+}
+
+/***************************************************************************//**
+  The MRV_time_now32() function returns the low 32 bits of the timebase. It is
+  the cheapest way to measure intervals shorter than 2^32 cycles, using an
+  unsigned subtraction: (MRV_time_now32() - start).
+
+  @return
+  Low 32 bits of the number of processor clock cycles since reset.
+ */
+static inline uint32_t MRV_time_now32(void)
+{
+    return read_csr(mcycle);
+}
+
+/***************************************************************************//**
+  The MRV_time_us_to_ticks() and MRV_time_ms_to_ticks() functions convert a
+  duration to timebase ticks, rounding up. The division is resolved at
+  compile time when the duration is a constant.
+ */
+static inline uint64_t MRV_time_us_to_ticks(uint32_t us)
+{
+    return (((uint64_t)us * MRV_TIME_TICKS_PER_SEC) + 999999u) / 1000000u;
+}
+
+static inline uint64_t MRV_time_ms_to_ticks(uint32_t ms)
+{
+    return (((uint64_t)ms * MRV_TIME_TICKS_PER_SEC) + 999u) / 1000u;
+}
+
+/***************************************************************************//**
+  The MRV_time_ticks_to_us() and MRV_time_ticks_to_ms() functions convert a
+  number of timebase ticks to a duration, rounding down.
+ */
+static inline uint64_t MRV_time_ticks_to_us(uint64_t ticks)
+{
+    return (ticks * 1000000u) / MRV_TIME_TICKS_PER_SEC;
+}
+
+static inline uint64_t MRV_time_ticks_to_ms(uint64_t ticks)
+{
+    return (ticks * 1000u) / MRV_TIME_TICKS_PER_SEC;
+}
+
+/***************************************************************************//**
+  The MRV_delay_cycles() function busy-waits for the number of processor
+  clock cycles passed as parameter.
+
+  @param cycles
+  Number of cycles to wait for.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_delay_cycles(uint32_t cycles);
+
+/***************************************************************************//**
+  The MRV_delay_us() function busy-waits for the number of microseconds passed
+  as parameter.
+
+  @param us
+  Number of microseconds to wait for.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_delay_us(uint32_t us);
+
+/***************************************************************************//**
+  The MRV_delay_ms() function busy-waits for the number of milliseconds passed
+  as parameter.
+
+  @param ms
+  Number of milliseconds to wait for.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_delay_ms(uint32_t ms);
+
+/***************************************************************************//**
+  The MRV_deadline_set_ticks(), MRV_deadline_set_us() and MRV_deadline_set_ms()
+  functions set a deadline expiring after the duration passed as parameter,
+  counted from the time of the call.
+
+  @param p_deadline
+  Pointer to the deadline.
+
+  @param ticks / us / ms
+  Time until the deadline expires.
+
+  @return
+  These functions do not return any value.
+ */
+static inline void MRV_deadline_set_ticks(mrv_deadline_t * p_deadline,
+                                          uint64_t ticks)
+{
+    p_deadline->expiry = MRV_time_now() + ticks;
+}
+
+static inline void MRV_deadline_set_us(mrv_deadline_t * p_deadline,
+                                       uint32_t us)
+{
+    MRV_deadline_set_ticks(p_deadline, MRV_time_us_to_ticks(us));
+}
+
+static inline void MRV_deadline_set_ms(mrv_deadline_t * p_deadline,
+                                       uint32_t ms)
+{
+    MRV_deadline_set_ticks(p_deadline, MRV_time_ms_to_ticks(ms));
+}
+
+/***************************************************************************//**
+  The MRV_deadline_expired() function checks whether a deadline has passed.
+
+  @param p_deadline
+  Pointer to the deadline.
+
+  @return
+  This function returns 1 when the deadline has passed, 0 otherwise.
+ */
+static inline uint8_t MRV_deadline_expired(const mrv_deadline_t * p_deadline)
+{
+    return (MRV_time_now() >= p_deadline->expiry) ? 1u : 0u;
+}
+
+/***************************************************************************//**
+  The MRV_deadline_remaining_us() function returns the time left before a
+  deadline expires.
+
+  @param p_deadline
+  Pointer to the deadline.
+
+  @return
+  Number of microseconds before the deadline expires, 0 once it has passed,
+  saturated to 0xFFFFFFFF.
+ */
+uint32_t MRV_deadline_remaining_us(const mrv_deadline_t * p_deadline);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_TIME_H */
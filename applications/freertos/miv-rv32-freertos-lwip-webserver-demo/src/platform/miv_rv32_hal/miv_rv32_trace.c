@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_trace.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Binary event trace buffer for Mi-V soft processors. See file
+ * "miv_rv32_trace.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_hal.h"
+#include "miv_rv32_trace.h"
+#include "miv_rv32_fmt.h"
+
+#ifdef MIV_RV32_TRACE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_LINE_SIZE                 64u
+
+mrv_trace_buffer_t g_mrv_trace =
+{
+    MRV_TRACE_MAGIC,
+    MRV_TRACE_VERSION,
+    MRV_TRACE_NB_RINGS,
+    MRV_TRACE_RING_SIZE,
+    SYS_CLK_FREQ,
+    0u,
+    0u,
+    {0u, 0u},
+    {{{0u, 0u, 0u, 0u, 0u}}}
+};
+
+/***************************************************************************//**
+ * MRV_trace_start()
+ * See "miv_rv32_trace.h" for details of how to use this function.
+ */
+void MRV_trace_start(void)
+{
+    uint32_t ring;
+
+    g_mrv_trace.enabled = 0u;
+
+    for (ring = 0u; ring < MRV_TRACE_NB_RINGS; ring++)
+    {
+        g_mrv_trace.head[ring] = 0u;
+    }
+
+    g_mrv_trace.enabled = 1u;
+}
+
+/***************************************************************************//**
+ * MRV_trace_stop()
+ * See "miv_rv32_trace.h" for details of how to use this function.
+ */
+void MRV_trace_stop(void)
+{
+    g_mrv_trace.enabled = 0u;
+}
+
+/***************************************************************************//**
+ * MRV_trace_set_tag()
+ * See "miv_rv32_trace.h" for details of how to use this function.
+ */
+void MRV_trace_set_tag(uint16_t tag)
+{
+    g_mrv_trace.tag = tag;
+}
+
+/***************************************************************************//**
+ * MRV_trace_dump()
+ * See "miv_rv32_trace.h" for details of how to use this function.
+ */
+void MRV_trace_dump(mrv_trace_write_t write_fn)
+{
+    char line[TRACE_LINE_SIZE];
+    uint32_t was_enabled = g_mrv_trace.enabled;
+    uint32_t ring;
+
+    if (0 == write_fn)
+    {
+        return;
+    }
+
+    g_mrv_trace.enabled = 0u;
+
+    (void)MRV_snprintf(line, sizeof(line), "MRV_TRACE_BEGIN clk=%u size=%u\r\n",
+                       g_mrv_trace.clk_freq, (uint32_t)MRV_TRACE_RING_SIZE);
+    write_fn(line);
+
+    for (ring = 0u; ring < MRV_TRACE_NB_RINGS; ring++)
+    {
+        uint32_t head = g_mrv_trace.head[ring];
+        uint32_t idx = 0u;
+
+        if (head > MRV_TRACE_RING_SIZE)
+        {
+            idx = head - MRV_TRACE_RING_SIZE;
+        }
+
+        for (; idx != head; idx++)
+        {
+            const mrv_trace_record_t * p_record =
+                &g_mrv_trace.ring[ring][idx & (MRV_TRACE_RING_SIZE - 1u)];
+
+            (void)MRV_snprintf(line, sizeof(line),
+                               "%u %08x %04x %04x %08x %08x\r\n",
+                               ring, p_record->timestamp,
+                               (uint32_t)p_record->id, (uint32_t)p_record->tag,
+                               p_record->arg0, p_record->arg1);
+            write_fn(line);
+        }
+    }
+
+    write_fn("MRV_TRACE_END\r\n");
+
+    g_mrv_trace.enabled = was_enabled;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_TRACE */
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_trace.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Binary event trace buffer for Mi-V soft processors.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Event Trace Buffer
+  =======================================
+  The trace buffer records time-stamped events into RAM at a cost of a few
+  instructions per event, so that the timing of drivers and application code
+  can be observed without the overhead of printing to a UART. Each event is a
+  16 byte record holding the low 32 bits of the mcycle CSR, a 16 bit event ID,
+  a 16 bit tag and two 32 bit arguments.
+
+  The trace buffer is made of two rings, each with a single kind of producer:
+    - The interrupt ring receives the events written while interrupts are
+      disabled (interrupt handlers and critical sections). Such code can not be
+      preempted, so the ring is updated with plain loads and stores.
+    - The thread ring receives the events written while interrupts are enabled.
+      A slot is reserved with an atomic add when the A extension is available,
+      or with interrupts masked for the duration of the index update otherwise.
+
+  The choice of the ring is made at run time by reading mstatus.MIE, so the
+  same MRV_TRACE() macro can be used from any context. When a ring is full the
+  oldest records are overwritten; the buffer always holds the most recent
+  history of the system.
+
+  --------------------------------
+  Event IDs
+  --------------------------------
+  Bits 13:0 of an event ID identify the event. Bits 15:14 give the event type
+  used by the host decoder to build a timeline:
+    - MRV_TRACE()       an instant event
+    - MRV_TRACE_BEGIN() the start of a duration
+    - MRV_TRACE_END()   the end of the duration started by the matching begin
+
+  IDs 0x0000 to 0x00FF are free for application use. The ranges from 0x0100
+  are used by the driver trace points listed below.
+
+  --------------------------------
+  Configuration
+  --------------------------------
+  | Macro Name              | Default | Description                            |
+  |-------------------------|---------|----------------------------------------|
+  | MIV_RV32_TRACE          |  undef  | Enable the trace buffer and the driver |
+  |                         |         | trace points. When undefined all the   |
+  |                         |         | MRV_TRACE macros expand to nothing.    |
+  | MRV_TRACE_RING_SIZE     |   128   | Number of records in each ring. Must   |
+  |                         |         | be a power of two.                     |
+
+  --------------------------------
+  Reading the trace
+  --------------------------------
+  MRV_trace_dump() prints the records as hexadecimal text through an
+  application supplied output function:
+
+      MRV_TRACE_BEGIN clk=<hz> size=<n>
+      <ring> <timestamp> <id> <tag> <arg0> <arg1>
+      ...
+      MRV_TRACE_END
+
+  Alternatively the buffer can be copied from memory with the debugger, while
+  the processor is halted, without any support from the application:
+
+      dump binary value trace.bin g_mrv_trace
+
+  Both forms are converted to Chrome trace JSON (chrome://tracing or
+  https://ui.perfetto.dev) by the mrv_trace.py script provided in the scripts
+  folder of the project. The script reads the event names from this file.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_TRACE_H
+#define MIV_RV32_TRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  Event types
+ */
+#define MRV_TRACE_TYPE_INSTANT          0x0000u
+#define MRV_TRACE_TYPE_BEGIN            0x4000u
+#define MRV_TRACE_TYPE_END              0x8000u
+#define MRV_TRACE_TYPE_MASK             0xC000u
+
+/*-------------------------------------------------------------------------*//**
+  Driver event IDs
+ */
+#define MRV_TRACE_ID_TSE_ISR            0x0100u
+#define MRV_TRACE_ID_TSE_TX_QUEUE       0x0101u
+#define MRV_TRACE_ID_TSE_TX_DONE        0x0102u
+#define MRV_TRACE_ID_TSE_RX_PKT         0x0103u
+#define MRV_TRACE_ID_SPI_XFER           0x0200u
+#define MRV_TRACE_ID_SPI_ISR            0x0201u
+#define MRV_TRACE_ID_MMC_READ           0x0300u
+#define MRV_TRACE_ID_MMC_WRITE          0x0301u
+#define MRV_TRACE_ID_MMC_ISR            0x0302u
+
+#ifdef MIV_RV32_TRACE
+
+#include "miv_rv32_regs.h"
+
+#ifndef MRV_TRACE_RING_SIZE
+#define MRV_TRACE_RING_SIZE             128u
+#endif
+
+#if ((MRV_TRACE_RING_SIZE & (MRV_TRACE_RING_SIZE - 1u)) != 0u)
+#error "MRV_TRACE_RING_SIZE must be a power of two"
+#endif
+
+#define MRV_TRACE_MAGIC                 0x5456524Du     /* "MRVT" */
+#define MRV_TRACE_VERSION               1u
+
+#define MRV_TRACE_RING_THREAD           0u
+#define MRV_TRACE_RING_IRQ              1u
+#define MRV_TRACE_NB_RINGS              2u
+
+/***************************************************************************//**
+  One trace record. The layout is shared with the host decoder.
+ */
+typedef struct
+{
+    uint32_t timestamp;
+    uint16_t id;
+    uint16_t tag;
+    uint32_t arg0;
+    uint32_t arg1;
+} mrv_trace_record_t;
+
+/***************************************************************************//**
+  The trace buffer. The head of each ring counts the records written to the
+  ring since the last call to MRV_trace_start(). The layout is shared with the
+  host decoder.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t nb_rings;
+    uint32_t ring_size;
+    uint32_t clk_freq;
+    volatile uint32_t enabled;
+    volatile uint32_t tag;
+    volatile uint32_t head[MRV_TRACE_NB_RINGS];
+    mrv_trace_record_t ring[MRV_TRACE_NB_RINGS][MRV_TRACE_RING_SIZE];
+} mrv_trace_buffer_t;
+
+extern mrv_trace_buffer_t g_mrv_trace;
+
+/***************************************************************************//**
+  The mrv_trace_write_t type is the prototype of the function used by
+  MRV_trace_dump() to output the trace. It receives a NULL terminated string.
+  For example, a wrapper around UART_polled_tx_string().
+ */
+typedef void (*mrv_trace_write_t)(const char * str);
+
+/***************************************************************************//**
+  The MRV_trace_event() function writes one record into the trace buffer. It
+  can be called from any context. Use the MRV_TRACE(), MRV_TRACE_BEGIN() and
+  MRV_TRACE_END() macros rather than calling this function directly so that
+  the calls are removed when MIV_RV32_TRACE is not defined.
+
+  @param id
+  The event ID, including the event type.
+
+  @param arg0
+  First event argument.
+
+  @param arg1
+  Second event argument.
+
+  @return
+  This function does not return any value.
+ */
+static inline void MRV_trace_event(uint32_t id, uint32_t arg0, uint32_t arg1)
+{
+    mrv_trace_record_t * p_record;
+    uint32_t ring;
+    uint32_t idx;
+    uint32_t tag = 0u;
+
+    if (0u == g_mrv_trace.enabled)
+    {
+        return;
+    }
+
+    if (0u == (read_csr(mstatus) & MSTATUS_MIE))
+    {
+        ring = MRV_TRACE_RING_IRQ;
+        idx = g_mrv_trace.head[MRV_TRACE_RING_IRQ]++;
+    }
+    else
+    {
+        ring = MRV_TRACE_RING_THREAD;
+        tag = g_mrv_trace.tag;
+#ifdef __riscv_atomic
+        idx = __atomic_fetch_add(&g_mrv_trace.head[MRV_TRACE_RING_THREAD], 1u,
+                                 __ATOMIC_RELAXED);
+#else
+        clear_csr(mstatus, MSTATUS_MIE);
+        idx = g_mrv_trace.head[MRV_TRACE_RING_THREAD]++;
+        set_csr(mstatus, MSTATUS_MIE);
+#endif
+    }
+
+    p_record = &g_mrv_trace.ring[ring][idx & (MRV_TRACE_RING_SIZE - 1u)];
+    p_record->timestamp = (uint32_t)read_csr(mcycle);
+    p_record->id = (uint16_t)id;
+    p_record->tag = (uint16_t)tag;
+    p_record->arg0 = arg0;
+    p_record->arg1 = arg1;
+}
+
+/***************************************************************************//**
+  The MRV_trace_start() function clears the trace buffer and enables tracing.
+
+  @param
+  This function does not take any parameters.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_trace_start(void);
+
+/***************************************************************************//**
+  The MRV_trace_stop() function disables tracing. The records written so far
+  are kept until the next call to MRV_trace_start().
+
+  @param
+  This function does not take any parameters.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_trace_stop(void);
+
+/***************************************************************************//**
+  The MRV_trace_set_tag() function sets the tag stored in the records written
+  from the thread ring, for example the number of the running task when called
+  from an RTOS task switch hook. The records of the interrupt ring are always
+  tagged 0.
+
+  @param tag
+  The new tag value.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_trace_set_tag(uint16_t tag);
+
+/***************************************************************************//**
+  The MRV_trace_dump() function outputs the records held in the trace buffer.
+  Tracing is suspended while the records are being output and resumed
+  afterwards if it was enabled.
+
+  @param write_fn
+  Function used to output each line of text.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_trace_dump(mrv_trace_write_t write_fn);
+
+/*
+ * The arguments are only evaluated while tracing is enabled, so a trace point
+ * can pass a register read without touching the hardware when tracing is
+ * stopped.
+ */
+#define MRV_TRACE(id, arg0, arg1) \
+    do { \
+        if (0u != g_mrv_trace.enabled) \
+        { \
+            MRV_trace_event((uint32_t)(id), (uint32_t)(arg0), (uint32_t)(arg1)); \
+        } \
+    } while (0)
+
+#define MRV_TRACE_BEGIN(id, arg0, arg1) \
+    MRV_TRACE((uint32_t)(id) | MRV_TRACE_TYPE_BEGIN, (arg0), (arg1))
+
+#define MRV_TRACE_END(id, arg0, arg1) \
+    MRV_TRACE((uint32_t)(id) | MRV_TRACE_TYPE_END, (arg0), (arg1))
+
+#else   /* MIV_RV32_TRACE */
+
+#define MRV_TRACE(id, arg0, arg1)
+#define MRV_TRACE_BEGIN(id, arg0, arg1)
+#define MRV_TRACE_END(id, arg0, arg1)
+
+#endif  /* MIV_RV32_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_TRACE_H */
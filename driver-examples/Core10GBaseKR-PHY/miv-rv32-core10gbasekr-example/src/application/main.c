@@ -9,9 +9,10 @@
  *
  */
 
-#include <stdio.h>
 #include "hal/hal.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_fmt.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
 #include "drivers/fpga_ip/Core10GBaseKR_PHY/core10gbasekr_phy.h"
 #include "PF_XCVR_C10GB/pf_xcvr_c10gb.h"
@@ -72,7 +73,7 @@ void packet_generator_config(void);
 /**
  * Display packet data performance on the UART terminal
  */
-void packet_data_performance(UART_instance_t *uart, char *msg);
+void packet_data_performance(UART_instance_t *uart);
 #endif /** C10GBKR_10GMAC_PACKET_GEN_EXAMPLE */
 
 /**
@@ -87,34 +88,29 @@ void packet_data_performance(UART_instance_t *uart, char *msg);
 /**
  * function prototypes
  */
-void lt_performances_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg);
+void lt_performances_display(UART_instance_t *uart, phy10gkr_instance_t *phy);
 
 /**
  * print auto-negotiation state to uart
  */
-void lt_fail_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg);
+void lt_fail_display(UART_instance_t *uart, phy10gkr_instance_t *phy);
 
 /**
  * print receiver calibration errors to uart
  */
 void calibration_error_display(pf_xcvr_c10gb_instance_t *xcvr,
                                UART_instance_t *uart,
-                               phy10gkr_instance_t *phy,
-                               char *perf_msg);
+                               phy10gkr_instance_t *phy);
 
 #ifdef C10GBKR_AN_STATE_DISPLAY
 /**
  * print auto-negotiation state to uart
  */
-void an_state_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg);
+void an_state_display(UART_instance_t *uart, phy10gkr_instance_t *phy);
 #endif /** C10GBKR_AN_STATE_DISPLAY */
 
 #endif /** C10GBKR_PERFORMANCE_MESSAGES */
 
-#if defined(C10GBKR_PERFORMANCE_MESSAGES) || defined(C10GBKR_10GMAC_PACKET_GEN_EXAMPLE)
-char msg[256];
-#endif
-
 /**
  * Mtime definition
  */
@@ -136,6 +132,18 @@ char msg[256];
  */
 UART_instance_t g_uart;
 
+/**
+ * Formatted output to a UART through MRV_fmt(), without an intermediate
+ * buffer and without the C library printf functions.
+ */
+static void
+uart_sink(void *p_ctx, const char *p_buf, uint32_t length)
+{
+    UART_send((UART_instance_t *)p_ctx, (const uint8_t *)p_buf, length);
+}
+
+#define uart_printf(uart, ...) MRV_fmt(uart_sink, (uart), __VA_ARGS__)
+
 /**
  * Core10GBaseKR_PHY instance data.
  */
@@ -157,28 +165,12 @@ PHY10GKR_get_current_time_ms(void)
     return (uint32_t)CURRENT_MTIME_MS;
 }
 
-/**
- * Application delay in milli-seconds using MTIME
- */
-static void
-delay_ms(uint32_t timeout_ms)
-{
-    uint64_t end_time = 0;
-    uint64_t start_time = CURRENT_MTIME_MS;
-
-    while (end_time < timeout_ms)
-    {
-        end_time = CURRENT_MTIME_MS - start_time;
-    }
-}
-
 /**
  * Display IP and driver versions
  */
 static void
 display_versions(phy10gkr_instance_t phy, UART_instance_t uart)
 {
-    char version_msg[20];
     uint32_t ip_version_major;
     uint32_t ip_version_minor;
     uint32_t ip_version_sub;
@@ -194,16 +186,14 @@ display_versions(phy10gkr_instance_t phy, UART_instance_t uart)
                                 &driver_version_patch);
 
     UART_polled_tx_string(&g_uart, "IP Version: ");
-    sprintf(version_msg, "%d.%d.%d\n\r\0", ip_version_major, ip_version_minor, ip_version_sub);
-    UART_polled_tx_string(&g_uart, version_msg);
+    uart_printf(&g_uart, "%d.%d.%d\n\r", ip_version_major, ip_version_minor, ip_version_sub);
 
     UART_polled_tx_string(&g_uart, "Driver Version: ");
-    sprintf(version_msg,
-            "%d.%d.%03d\n\r\0",
-            driver_version_major,
-            driver_version_minor,
-            driver_version_patch);
-    UART_polled_tx_string(&g_uart, version_msg);
+    uart_printf(&g_uart,
+                "%d.%d.%03d\n\r",
+                driver_version_major,
+                driver_version_minor,
+                driver_version_patch);
 }
 
 /**
@@ -219,7 +209,7 @@ main(void)
 
     /** Application variables */
     uint32_t good_link_cnt = 0;
-    uint32_t an_start_time = 0;
+    mrv_deadline_t an_display_deadline;
 
     UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, BAUD_VALUE_115200, (DATA_8_BITS | NO_PARITY));
 
@@ -254,7 +244,7 @@ main(void)
                 UART_polled_tx_string(&g_uart, "\n\rFEC is not configured in IP\n\r\0");
             }
             UART_polled_tx_string(&g_uart, "\n\rStarting Auto-Negotiation!!\n\r\0");
-            an_start_time = CURRENT_MTIME_MS;
+            MRV_deadline_set_ms(&an_display_deadline, AN_PROGRESS_DISPLAY_TIMEOUT);
             while (1)
             {
                 phy_status = PHY10GKR_10gbasekr_sm(&g_phy);
@@ -264,11 +254,12 @@ main(void)
                     switch (phy_status)
                     {
                         case AN_IN_PROGRESS:
-                            if ((CURRENT_MTIME_MS - an_start_time) >= AN_PROGRESS_DISPLAY_TIMEOUT)
+                            if (MRV_deadline_expired(&an_display_deadline))
                             {
                                 UART_polled_tx_string(&g_uart,
                                                       "\n\rAuto-negotiation in progress\n\r\0");
-                                an_start_time = CURRENT_MTIME_MS;
+                                MRV_deadline_set_ms(&an_display_deadline,
+                                                    AN_PROGRESS_DISPLAY_TIMEOUT);
                             }
                             break;
 
@@ -279,7 +270,7 @@ main(void)
                         case LT_FAILURE:
                             UART_polled_tx_string(&g_uart, "\n\rLT Training Failure!!\n\r\0");
 #ifdef C10GBKR_PERFORMANCE_MESSAGES
-                            lt_fail_display(&g_uart, &g_phy, msg);
+                            lt_fail_display(&g_uart, &g_phy);
 #endif /** C10GBKR_PERFORMANCE_MESSAGES */
                             break;
 
@@ -306,7 +297,7 @@ main(void)
                         }
                     }
 #ifdef C10GBKR_PERFORMANCE_MESSAGES
-                    lt_performances_display(&g_uart, &g_phy, msg);
+                    lt_performances_display(&g_uart, &g_phy);
 #endif /** C10GBKR_PERFORMANCE_MESSAGES */
                     break;
                 }
@@ -315,7 +306,7 @@ main(void)
 #ifdef C10GBKR_10GMAC_PACKET_GEN_EXAMPLE
             core10gmac_config();
             /** Allow the MAC to initialize before sending data */
-            delay_ms(4000);
+            MRV_delay_ms(4000u);
             packet_generator_config();
 #else
             /** Note: traffic may be sent through the link now. Embedded software
@@ -326,7 +317,7 @@ main(void)
 
             while (1)
             {
-                delay_ms(1000);
+                MRV_delay_ms(1000u);
 
                 phy_status = PHY10GKR_10gbasekr_sm(&g_phy);
                 if (phy_status != LINK_ESTABLISHED)
@@ -341,7 +332,7 @@ main(void)
                         UART_polled_tx_string(&g_uart, "\n\rLink: Good!!\n\r\0");
                         good_link_cnt = 0;
 #ifdef C10GBKR_10GMAC_PACKET_GEN_EXAMPLE
-                        packet_data_performance(&g_uart, msg);
+                        packet_data_performance(&g_uart);
 #endif /** C10GBKR_10GMAC_PACKET_GEN_EXAMPLE */
                     }
                     else
@@ -421,7 +412,7 @@ packet_generator_config(void)
 }
 
 void
-packet_data_performance(UART_instance_t *uart, char *msg)
+packet_data_performance(UART_instance_t *uart)
 {
     uint32_t good_packets[2];
     uint32_t bad_packets[2];
@@ -436,23 +427,17 @@ packet_data_performance(UART_instance_t *uart, char *msg)
 
     UART_polled_tx_string(uart, "\n\rPacket testing:\n\r\0");
 
-    sprintf(msg, "\tTotal packets (msb): %u\n\r\0", (uint32_t)total_packets[0]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tTotal packets (msb): %u\n\r", (uint32_t)total_packets[0]);
 
-    sprintf(msg, "\tTotal packets (lsb): %u\n\r\0", (uint32_t)total_packets[1]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tTotal packets (lsb): %u\n\r", (uint32_t)total_packets[1]);
 
-    sprintf(msg, "\tGood packets (msb): %u\n\r\0", (uint32_t)good_packets[0]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tGood packets (msb): %u\n\r", (uint32_t)good_packets[0]);
 
-    sprintf(msg, "\tGood packets (lsb): %u\n\r\0", (uint32_t)good_packets[1]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tGood packets (lsb): %u\n\r", (uint32_t)good_packets[1]);
 
-    sprintf(msg, "\tBad packets (msb): %u\n\r\0", (uint32_t)bad_packets[0]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tBad packets (msb): %u\n\r", (uint32_t)bad_packets[0]);
 
-    sprintf(msg, "\tBad packets (lsb): %u\n\r\0", (uint32_t)bad_packets[1]);
-    UART_polled_tx_string(uart, (const uint8_t *)msg);
+    uart_printf(uart, "\tBad packets (lsb): %u\n\r", (uint32_t)bad_packets[1]);
 }
 #endif /** C10GBKR_10GMAC_PACKET_GEN_EXAMPLE */
 
@@ -460,135 +445,122 @@ packet_data_performance(UART_instance_t *uart, char *msg)
 void
 calibration_error_display(pf_xcvr_c10gb_instance_t *xcvr,
                           UART_instance_t *uart,
-                          phy10gkr_instance_t *phy,
-                          char *perf_msg)
+                          phy10gkr_instance_t *phy)
 {
-    sprintf(perf_msg, "\n\n\rRx Cal Error:\n\r\0");
-    UART_polled_tx_string(&g_uart, (const uint8_t *)perf_msg);
+    uart_printf(&g_uart, "\n\n\rRx Cal Error:\n\r");
 
     if ((DATA_CLCK_UNLOCKED == xcvr->status.cdr_flock) ||
         (DATA_CLCK_UNLOCKED == xcvr->status.cdr_lock))
     {
-        sprintf(perf_msg, "\tCDR Fail\n\r\0");
-        UART_polled_tx_string(&g_uart, (const uint8_t *)perf_msg);
+        uart_printf(&g_uart, "\tCDR Fail\n\r");
     }
 
     if (CTLE_CAL_COMPLETE != xcvr->status.ctle_cal)
     {
-        sprintf(perf_msg, "\tCTLE Fail\n\r\0");
-        UART_polled_tx_string(&g_uart, (const uint8_t *)perf_msg);
+        uart_printf(&g_uart, "\tCTLE Fail\n\r");
     }
 }
 
 void
-lt_fail_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg)
+lt_fail_display(UART_instance_t *uart, phy10gkr_instance_t *phy)
 {
-    sprintf(perf_msg, "tx equ count: %d\n\r\0", phy->lt.tx_equ_cnt);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    uart_printf(uart, "tx equ count: %d\n\r", phy->lt.tx_equ_cnt);
 
-    sprintf(perf_msg, "tx equ count: %d\n\r\0", phy->lt.rx_cal_cnt);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    uart_printf(uart, "tx equ count: %d\n\r", phy->lt.rx_cal_cnt);
 }
 
 void
-lt_iteration_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg)
+lt_iteration_display(UART_instance_t *uart, phy10gkr_instance_t *phy)
 {
     /** Iteration counters */
     UART_polled_tx_string(&g_uart, "Training Counters:\n\r\0");
-    sprintf(perf_msg, "\tTotal: %d\n\r\0", g_phy.lt.complete_cnt + g_phy.lt.fail_cnt);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
-    sprintf(perf_msg, "\tFails: %d\n\r\0", g_phy.lt.fail_cnt);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
-    sprintf(perf_msg, "\tCompletions: %d\n\r\0", g_phy.lt.complete_cnt);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    uart_printf(uart, "\tTotal: %d\n\r", g_phy.lt.complete_cnt + g_phy.lt.fail_cnt);
+    uart_printf(uart, "\tFails: %d\n\r", g_phy.lt.fail_cnt);
+    uart_printf(uart, "\tCompletions: %d\n\r", g_phy.lt.complete_cnt);
 }
 
 void
-lt_performances_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg)
+lt_performances_display(UART_instance_t *uart, phy10gkr_instance_t *phy)
 {
-    sprintf(perf_msg, "\n\n\rTraining Complete\n\n\r\0");
-    UART_polled_tx_string(&g_uart, (const uint8_t *)perf_msg);
+    uart_printf(&g_uart, "\n\n\rTraining Complete\n\n\r");
 
-    lt_iteration_display(uart, phy, perf_msg);
+    lt_iteration_display(uart, phy);
 
     /** Complete time */
-    sprintf(perf_msg, "\n\rCompletion Time: %d ms\n\r\0", phy->lt.timer.end);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    uart_printf(uart, "\n\rCompletion Time: %d ms\n\r", phy->lt.timer.end);
 
     /** Tx tap settings */
-    sprintf(perf_msg, "\n\rTx Tap Settings\n\r\0");
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
-
-    sprintf(perf_msg,
-            "\tC(0) Tap: %d \n\r\0",
-            HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_MAIN_TAP));
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
-
-    sprintf(perf_msg,
-            "\tC(1) Tap: %d \n\r\0",
-            (int)HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_POST_TAP) -
-                C10GBKR_LT_POST_TAP_MAX_LIMIT);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
-
-    sprintf(perf_msg,
-            "\tC(-1) Tap: %d \n\r\0",
-            (int)HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_PRE_TAP) -
-                C10GBKR_LT_PRE_TAP_MAX_LIMIT);
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    uart_printf(uart, "\n\rTx Tap Settings\n\r");
+
+    uart_printf(uart,
+                "\tC(0) Tap: %d \n\r",
+                HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_MAIN_TAP));
+
+    uart_printf(uart,
+                "\tC(1) Tap: %d \n\r",
+                (int)HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_POST_TAP) -
+                    C10GBKR_LT_POST_TAP_MAX_LIMIT);
+
+    uart_printf(uart,
+                "\tC(-1) Tap: %d \n\r",
+                (int)HAL_get_32bit_reg_field(g_phy.lt_base_addr, C10GB_LT_TX_NEW_PRE_TAP) -
+                    C10GBKR_LT_PRE_TAP_MAX_LIMIT);
 }
 
 #ifdef C10GBKR_AN_STATE_DISPLAY
 void
-an_state_display(UART_instance_t *uart, phy10gkr_instance_t *phy, char *perf_msg)
+an_state_display(UART_instance_t *uart, phy10gkr_instance_t *phy)
 {
+    const char *p_state = "";
+
     switch (phy->an.status)
     {
         case ST_AUTO_NEG_ENABLE:
-            sprintf(perf_msg, "ST_AUTO_NEG_ENABLE\n\r\0");
+            p_state = "ST_AUTO_NEG_ENABLE\n\r";
             break;
 
         case ST_TRANSMIT_DISABLE:
-            sprintf(perf_msg, "ST_TRANSMIT_DISABLE\n\r\0");
+            p_state = "ST_TRANSMIT_DISABLE\n\r";
             break;
 
         case ST_ABILITY_DETECT:
-            sprintf(perf_msg, "ST_ABILITY_DETECT\n\r\0");
+            p_state = "ST_ABILITY_DETECT\n\r";
             break;
 
         case ST_ACKNOWLEDGE_DETECT:
-            sprintf(perf_msg, "ST_ACKNOWLEDGE_DETECT\n\r\0");
+            p_state = "ST_ACKNOWLEDGE_DETECT\n\r";
             break;
 
         case ST_COMPLETE_ACKNOWLEDEGE:
-            sprintf(perf_msg, "ST_COMPLETE_ACKNOWLEDEGE\n\r\0");
+            p_state = "ST_COMPLETE_ACKNOWLEDEGE\n\r";
             break;
 
         case ST_AN_GOOD_CHECK:
-            sprintf(perf_msg, "ST_AN_GOOD_CHECK\n\r\0");
+            p_state = "ST_AN_GOOD_CHECK\n\r";
             break;
 
         case ST_AN_GOOD:
-            sprintf(perf_msg, "ST_AN_GOOD\n\r\0");
+            p_state = "ST_AN_GOOD\n\r";
             break;
 
         case ST_NEXT_PAGE_WAIT:
-            sprintf(perf_msg, "ST_NEXT_PAGE_WAIT\n\r\0");
+            p_state = "ST_NEXT_PAGE_WAIT\n\r";
             break;
 
         case ST_NEXT_PAGE_WAIT_TX_IDLE:
-            sprintf(perf_msg, "ST_NEXT_PAGE_WAIT_TX_IDLE\n\r\0");
+            p_state = "ST_NEXT_PAGE_WAIT_TX_IDLE\n\r";
             break;
 
         case ST_LINK_STATUS_CHECK:
-            sprintf(perf_msg, "ST_LINK_STATUS_CHECK\n\r\0");
+            p_state = "ST_LINK_STATUS_CHECK\n\r";
             break;
 
         case ST_PARALLEL_DETECTION_FAULT:
-            sprintf(perf_msg, "ST_PARALLEL_DETECTION_FAULT\n\r\0");
+            p_state = "ST_PARALLEL_DETECTION_FAULT\n\r";
             break;
     }
 
-    UART_polled_tx_string(uart, (const uint8_t *)perf_msg);
+    UART_polled_tx_string(uart, (const uint8_t *)p_state);
 }
 #endif /** C10GBKR_AN_STATE_DISPLAY */
 
@@ -16,26 +16,25 @@
 #include <string.h>
 #include "hal/hal.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
 #include "drivers/fpga_ip/CoreMMC/core_mmc.h"
 
 #define NUMBER_OF_SECTORS_TO_WRITE (MAX_NO_OF_BLOCKS)
 
-#define INTERRUPT_EVERY_10MS       (100u)
 #define SECTOR_SIZE_BYTES          (512u)
 #define SECTOR_SIZE_WORDS          (SECTOR_SIZE_BYTES / sizeof(uint32_t))
 /* This value is determined by the FIFO_DEPTH CoreMMC verilog parameter*/
 #define FIFO_DEPTH_BYTES           (4096u)
 #define MAX_NO_OF_BLOCKS           (FIFO_DEPTH_BYTES / SECTOR_SIZE_BYTES)
 #define SECTOR_1                   (0x1u)
-#define TIMEOUT_10_SECS            (1000u)
+#define TIMEOUT_10_SECS            (10000u)
 #define INCREASE_BY_2              (8u)
 #define SUCCESS                    (0u)
 #define FAILURE                    (1u)
 
 static uint32_t g_write_data_buffer[NUMBER_OF_SECTORS_TO_WRITE * SECTOR_SIZE_WORDS] = {0u};
 static uint32_t g_read_data_buffer[NUMBER_OF_SECTORS_TO_WRITE * SECTOR_SIZE_WORDS] = {0u};
-static uint32_t ten_ms_sys_tick = 0;
 
 static const uint8_t multiblock_message[] = "\r\n\nCoreMMC multi-block write and read-back test:"
                                             "\r\nWriting and reading back ";
@@ -62,16 +61,13 @@ MSYS_EI0_IRQHandler(void)
     MMC_isr(&g_emmc);
 }
 
-void
-SysTick_Handler(void)
-{
-    ten_ms_sys_tick++;
-}
-
+/* Millisecond tick for the CoreMMC timeouts, taken from the cycle counter.
+ * The driver compares ticks by unsigned subtraction, so the 32-bit wrap of
+ * this value is harmless. */
 static uint32_t
 get_clock_ticks(void)
 {
-    return (ten_ms_sys_tick);
+    return ((uint32_t)MRV_time_ticks_to_ms(MRV_time_now()));
 }
 
 static void
@@ -262,8 +258,6 @@ main(void)
     uint32_t sector = 1u;
 
     MRV_enable_interrupts();
-    MRV_systick_config(SYS_CLK_FREQ / INTERRUPT_EVERY_10MS);
-    MRV_enable_local_irq(MRV32_TIMER_IRQn);
     MRV_enable_local_irq(MRV32_MSYS_EIE0_IRQn);
 
     UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, BAUD_VALUE_115200, (DATA_8_BITS | NO_PARITY));
@@ -16,6 +16,7 @@
 #include "drivers/fpga_ip/CoreTSE/coretse_regs.h"
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_defer.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -46,6 +47,7 @@ static volatile uint32_t g_mac_tx_buffer_used = RELEASE_BUFFER;
 static volatile uint32_t g_mac_rx_buffer_data_valid = RELEASE_BUFFER;
 
 static volatile uint32_t g_packet_received_length = 0;
+static uint8_t g_packet_received_count = 0;
 
 const static uint8_t mac_address[6] = {0xC0, 0xB1, 0x3C, 0x61, 0x60, 0x60};
 
@@ -101,6 +103,24 @@ External_IRQHandler(void)
     TSE_isr(g_tse);
 }
 
+/*
+ * The software interrupt executes the work posted by the CoreTSE interrupt
+ * handler callbacks, with interrupts enabled.
+ */
+void
+Software_IRQHandler(void)
+{
+    MRV_defer_run();
+}
+
+static void display_link_status(tse_instance_t *this_tse);
+
+static void
+tx_complete_work(void *p_arg)
+{
+    print("\tPacket Tx success");
+}
+
 static void
 packet_tx_complete_handler(void *caller_info)
 {
@@ -110,13 +130,44 @@ packet_tx_complete_handler(void *caller_info)
      * g_mac_tx_buffer_used.
      */
     *((uint32_t *)caller_info) = 0;
-    print("\tPacket Tx success");
+    MRV_defer_post(tx_complete_work, 0);
+}
+
+static void
+rx_packet_work(void *p_arg)
+{
+    uint8_t rx_size_msg[20] = {0};
+
+    g_packet_received_count++;
+
+    sprintf(rx_size_msg, "\n\r Rx packet size = %-3d", (int)g_packet_received_length);
+    print((uint8_t *)rx_size_msg);
+
+    TSE_send_pkt(g_tse, g_mac_rx_buffer, sizeof(tx_buffer_content), RELEASE_BUFFER);
+
+    g_packet_received_length = 0;
+
+    TSE_receive_pkt(g_tse, g_mac_rx_buffer, 0);
+    if (g_packet_received_count >= 40)
+    {
+        g_packet_received_count = 0;
+
+        display_link_status(g_tse);
+
+        print((uint8_t *)g_show_menu_msg);
+    }
 }
 
 static void
 mac_rx_callback(uint8_t *p_rx_packet, uint32_t packet_length, void *caller_info)
 {
+    /*
+     * Only record the length here. Printing the message and sending the
+     * answer take much longer than the interrupt handler should, so this is
+     * left to the deferred work queue.
+     */
     g_packet_received_length = packet_length;
+    MRV_defer_post(rx_packet_work, 0);
 }
 
 static void
@@ -182,7 +233,6 @@ int
 main(void)
 {
     uint16_t packet_length = 0u;
-    uint8_t packet_received_count = 0;
 
     size_t rx_size = 0;
     uint8_t rx_buff[1] = {0};
@@ -229,6 +279,12 @@ main(void)
         rx_size = UART_get_rx(&g_uart, rx_buff, sizeof(rx_buff));
         if (rx_size > 0)
         {
+            /*
+             * The deferred packet work calls the CoreTSE driver too: keep it
+             * from preempting the menu and the reinitialisation below.
+             */
+            MRV_defer_hold();
+
             switch (rx_buff[0])
             {
                 default:
@@ -311,28 +367,8 @@ main(void)
             g_tse_config.speed_duplex_select = g_ethernet_speed_choice;
             g_tse_config.framefilter = g_ethernet_filter_choice;
             initialise_coretse();
-        }
-        if (g_packet_received_length != 0)
-        {
-            uint8_t rx_size_msg[20] = {0};
-            packet_received_count++;
-
-            sprintf(rx_size_msg, "\n\r Rx packet size = %-3d", (int)g_packet_received_length);
-            print((uint8_t *)rx_size_msg);
-
-            TSE_send_pkt(g_tse, g_mac_rx_buffer, sizeof(tx_buffer_content), RELEASE_BUFFER);
-
-            g_packet_received_length = 0;
 
-            TSE_receive_pkt(g_tse, g_mac_rx_buffer, 0);
-            if (packet_received_count >= 40)
-            {
-                packet_received_count = 0;
-
-                display_link_status(g_tse);
-
-                print((uint8_t *)g_show_menu_msg);
-            }
+            MRV_defer_release();
         }
     }
     return 0u;
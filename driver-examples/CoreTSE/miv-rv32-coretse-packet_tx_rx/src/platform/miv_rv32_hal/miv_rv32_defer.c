@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_defer.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Deferred work queue for Mi-V soft processors. See file
+ * "miv_rv32_defer.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_hal.h"
+#include "miv_rv32_defer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    volatile mrv_defer_fn_t fn;
+    void * volatile p_arg;
+} defer_item_t;
+
+/*------------------------------------------------------------------------------
+ * head is the number of slots reserved by MRV_defer_post() and tail the number
+ * of slots released by MRV_defer_run(). A slot is reserved before it is
+ * written, so a reserved slot whose fn member is still 0 belongs to a post
+ * which was interrupted and has not completed yet.
+ */
+static struct
+{
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t running;
+    volatile uint32_t held;
+    volatile uint32_t nb_posted;
+    volatile uint32_t nb_executed;
+    volatile uint32_t nb_dropped;
+    volatile uint32_t high_water;
+    defer_item_t item[MRV_DEFER_QUEUE_SIZE];
+} g_defer;
+
+/*------------------------------------------------------------------------------
+ * Reserve the next slot of the queue. Returns 0 and counts the drop when the
+ * queue is full, 1 otherwise.
+ */
+static uint8_t reserve_slot(uint32_t * p_idx)
+{
+    uint32_t idx;
+
+#if defined(__riscv_atomic)
+    idx = __atomic_load_n(&g_defer.head, __ATOMIC_RELAXED);
+    do {
+        if ((idx - g_defer.tail) >= MRV_DEFER_QUEUE_SIZE)
+        {
+            __atomic_fetch_add(&g_defer.nb_dropped, 1u, __ATOMIC_RELAXED);
+            return 0u;
+        }
+    } while (!__atomic_compare_exchange_n(&g_defer.head, &idx, idx + 1u, 1,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+    __atomic_fetch_add(&g_defer.nb_posted, 1u, __ATOMIC_RELAXED);
+#else
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    idx = g_defer.head;
+    if ((idx - g_defer.tail) >= MRV_DEFER_QUEUE_SIZE)
+    {
+        g_defer.nb_dropped++;
+        write_csr(mstatus, mstatus);
+        return 0u;
+    }
+    g_defer.head = idx + 1u;
+    g_defer.nb_posted++;
+    write_csr(mstatus, mstatus);
+#endif
+
+    /* Statistic only, a concurrent post may overwrite it with a close value. */
+    if ((idx + 1u - g_defer.tail) > g_defer.high_water)
+    {
+        g_defer.high_water = idx + 1u - g_defer.tail;
+    }
+
+    *p_idx = idx;
+    return 1u;
+}
+
+/***************************************************************************//**
+ * MRV_defer_post()
+ * See "miv_rv32_defer.h" for details of how to use this function.
+ */
+uint8_t MRV_defer_post(mrv_defer_fn_t fn, void * p_arg)
+{
+    defer_item_t * p_item;
+    uint32_t idx;
+
+    ASSERT(0 != fn);
+
+    if (0u == reserve_slot(&idx))
+    {
+        return 0u;
+    }
+
+    /* Publish the work item by writing its function last. */
+    p_item = &g_defer.item[idx & (MRV_DEFER_QUEUE_SIZE - 1u)];
+    p_item->p_arg = p_arg;
+    __asm__ volatile ("" ::: "memory");
+    p_item->fn = fn;
+
+    /*
+     * A running MRV_defer_run() checks the queue again, with interrupts
+     * disabled, before returning, so there is no need to interrupt it.
+     */
+    if (0u == g_defer.running)
+    {
+        MRV_raise_soft_irq();
+    }
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * MRV_defer_run()
+ * See "miv_rv32_defer.h" for details of how to use this function.
+ */
+void MRV_defer_run(void)
+{
+    uint32_t mstatus = read_csr(mstatus);
+    uintptr_t mepc = read_csr(mepc);
+
+    clear_csr(mstatus, MSTATUS_MIE);
+
+    /*
+     * The software interrupt is only cleared once Software_IRQHandler()
+     * returns: clear it now so that it is not taken again as soon as the
+     * work items run with interrupts enabled. A post made while they run is
+     * picked up by the loop below.
+     */
+    MRV_clear_soft_irq();
+
+    if ((0u != g_defer.running) || (0u != g_defer.held))
+    {
+        write_csr(mstatus, mstatus);
+        return;
+    }
+    g_defer.running = 1u;
+
+    for (;;)
+    {
+        uint32_t idx = g_defer.tail;
+        defer_item_t * p_item = &g_defer.item[idx & (MRV_DEFER_QUEUE_SIZE - 1u)];
+        mrv_defer_fn_t fn;
+        void * p_arg;
+
+        /*
+         * Stop on an empty queue, or on a slot whose post was interrupted: the
+         * post raises the software interrupt again once it completes.
+         */
+        if ((idx == g_defer.head) || (0 == p_item->fn))
+        {
+            break;
+        }
+
+        fn = p_item->fn;
+        p_arg = p_item->p_arg;
+        p_item->fn = 0;
+        g_defer.tail = idx + 1u;
+
+        set_csr(mstatus, MSTATUS_MIE);
+        fn(p_arg);
+        clear_csr(mstatus, MSTATUS_MIE);
+
+        g_defer.nb_executed++;
+    }
+
+    g_defer.running = 0u;
+
+    /* An interrupt taken while a work item ran overwrote mepc. */
+    write_csr(mepc, mepc);
+    write_csr(mstatus, mstatus);
+}
+
+/***************************************************************************//**
+ * MRV_defer_hold()
+ * See "miv_rv32_defer.h" for details of how to use this function.
+ */
+void MRV_defer_hold(void)
+{
+    g_defer.held++;
+    __asm__ volatile ("" ::: "memory");
+}
+
+/***************************************************************************//**
+ * MRV_defer_release()
+ * See "miv_rv32_defer.h" for details of how to use this function.
+ */
+void MRV_defer_release(void)
+{
+    ASSERT(0u != g_defer.held);
+
+    __asm__ volatile ("" ::: "memory");
+    g_defer.held--;
+
+    /*
+     * A post made while the queue was held raised the software interrupt,
+     * which returned without running it. A post made from now on raises it
+     * again.
+     */
+    if ((0u == g_defer.held) && (g_defer.head != g_defer.tail))
+    {
+        MRV_raise_soft_irq();
+    }
+}
+
+/***************************************************************************//**
+ * MRV_defer_get_stats()
+ * See "miv_rv32_defer.h" for details of how to use this function.
+ */
+void MRV_defer_get_stats(mrv_defer_stats_t * p_stats)
+{
+    uint32_t mstatus = read_csr(mstatus);
+
+    MRV_disable_interrupts();
+    p_stats->nb_posted = g_defer.nb_posted;
+    p_stats->nb_executed = g_defer.nb_executed;
+    p_stats->nb_dropped = g_defer.nb_dropped;
+    p_stats->high_water = g_defer.high_water;
+    write_csr(mstatus, mstatus);
+}
+
+#ifdef __cplusplus
+}
+#endif
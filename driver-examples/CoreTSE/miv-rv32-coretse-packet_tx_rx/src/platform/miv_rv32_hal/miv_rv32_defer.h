@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_defer.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Deferred work queue for Mi-V soft processors, executed from the
+ * machine software interrupt.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Deferred Work Queue
+  =======================================
+  Interrupt handlers often have to do more than acknowledge their peripheral:
+  copy or check a received Ethernet frame, compute a CRC over an MMC block,
+  print a status message. While this work runs in the handler, the global
+  interrupt enable is clear and every other interrupt source waits.
+
+  The deferred work queue lets a handler post a function and an argument and
+  return straight away. The posted work items are executed in order from the
+  machine software interrupt, with the global interrupt enable set, so any
+  hardware interrupt can preempt them. This gives a bare-metal application the
+  usual split between a short "top half" in the interrupt handler and a
+  "bottom half" running at a lower priority, without needing an RTOS.
+
+  --------------------------------
+  Using the queue
+  --------------------------------
+  The application routes the machine software interrupt to the queue:
+
+      void Software_IRQHandler(void)
+      {
+          MRV_defer_run();
+      }
+
+  and posts work from any interrupt handler or from the main loop:
+
+      static void process_rx_packet(void * p_arg)
+      {
+          ...
+      }
+
+      static void mac_rx_callback(uint8_t * p_rx_packet, ...)
+      {
+          MRV_defer_post(process_rx_packet, p_rx_packet);
+      }
+
+  MRV_defer_post() raises the software interrupt with MRV_raise_soft_irq(),
+  which also enables it in the mie CSR, so no other initialization is needed.
+  The work items run as soon as the handler which posted them returns and no
+  other interrupt is pending.
+
+  MRV_defer_run() clears the software interrupt before running the work
+  items, so the software interrupt must not be used for anything else.
+
+  --------------------------------
+  Concurrency
+  --------------------------------
+  MRV_defer_post() can be called from any context, including handlers nested
+  with the PLIC priority-nested dispatch. A slot is reserved with an atomic
+  compare-and-swap on processors implementing the RISC-V A extension, and
+  with the global interrupt enable cleared for a few instructions otherwise.
+  The work item is then written outside of any critical section.
+
+  The work items are executed one at a time: they never preempt each other,
+  and a work item posted while another one is running is executed after it.
+  A work item must not wait for an event signalled by another work item.
+
+  The work items run in interrupt context and preempt the main loop. When the
+  main loop calls driver functions also called by the work items, for example
+  to reinitialize a peripheral, it surrounds them with MRV_defer_hold() and
+  MRV_defer_release(): the work items posted in between are kept in the queue
+  and executed on release.
+
+  The queue holds MRV_DEFER_QUEUE_SIZE work items, 16 by default. This can be
+  changed by defining MRV_DEFER_QUEUE_SIZE, which must be a power of two, in
+  the compiler settings. A post made while the queue is full is dropped and
+  counted; MRV_defer_get_stats() reports this count together with the highest
+  number of pending work items seen, which helps sizing the queue.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_DEFER_H
+#define MIV_RV32_DEFER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MRV_DEFER_QUEUE_SIZE
+#define MRV_DEFER_QUEUE_SIZE            16u
+#endif
+
+#if (MRV_DEFER_QUEUE_SIZE & (MRV_DEFER_QUEUE_SIZE - 1u)) != 0u
+#error "MRV_DEFER_QUEUE_SIZE must be a power of two"
+#endif
+
+/***************************************************************************//**
+  The mrv_defer_fn_t type is the prototype of a work item function. The p_arg
+  parameter is the value passed to MRV_defer_post().
+ */
+typedef void (*mrv_defer_fn_t)(void * p_arg);
+
+/***************************************************************************//**
+  The mrv_defer_stats_t structure is filled by MRV_defer_get_stats().
+
+    - nb_posted:    number of work items accepted by MRV_defer_post()
+    - nb_executed:  number of work items executed by MRV_defer_run()
+    - nb_dropped:   number of work items rejected because the queue was full
+    - high_water:   highest number of work items pending at the same time
+ */
+typedef struct
+{
+    uint32_t nb_posted;
+    uint32_t nb_executed;
+    uint32_t nb_dropped;
+    uint32_t high_water;
+} mrv_defer_stats_t;
+
+/***************************************************************************//**
+  The MRV_defer_post() function adds a work item at the end of the queue and
+  raises the machine software interrupt to have it executed.
+
+  @param fn
+  Function to execute. It must not be 0.
+
+  @param p_arg
+  Value passed to the function when it is executed.
+
+  @return
+  This function returns 1 when the work item was queued, or 0 when the queue
+  was full and the work item was dropped.
+ */
+uint8_t MRV_defer_post(mrv_defer_fn_t fn, void * p_arg);
+
+/***************************************************************************//**
+  The MRV_defer_run() function executes the pending work items, in the order
+  in which they were posted, until the queue is empty. The global interrupt
+  enable is set while each work item runs and the original state of the
+  mstatus and mepc CSRs is restored on return.
+
+  It is meant to be called from Software_IRQHandler(). It clears the software
+  interrupt first, so the work items are not interrupted by the software
+  interrupt that started them. A call made while the queue is held returns
+  immediately: MRV_defer_release() raises the software interrupt again.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_defer_run(void);
+
+/***************************************************************************//**
+  The MRV_defer_hold() function stops the execution of the work items until
+  the matching call to MRV_defer_release(). Work items can still be posted
+  meanwhile. The calls can be nested, and are made from the main loop, not
+  from interrupt handlers.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_defer_hold(void);
+
+/***************************************************************************//**
+  The MRV_defer_release() function ends a MRV_defer_hold() call. When no other
+  hold remains, the work items posted meanwhile are executed.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_defer_release(void);
+
+/***************************************************************************//**
+  The MRV_defer_get_stats() function reads the statistics of the deferred
+  work queue.
+
+  @param p_stats
+  Pointer to the structure receiving the statistics.
+
+  @return
+  This function does not return any value.
+ */
+void MRV_defer_get_stats(mrv_defer_stats_t * p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_DEFER_H */
@@ -0,0 +1,652 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * CoreUARTapb Benchmark Example project
+ *
+ * This project measures the throughput and the processor cost of the three
+ * ways of using the CoreUARTapb driver: polled with UART_send(), interrupt
+ * driven with UART_fill_tx_fifo() and UART_get_rx() called from the
+ * application interrupt handlers, and through the transmit and receive rings
+ * of the driver. It also finds, for each mode, the processing load under
+ * which received characters start being lost. The results are printed over
+ * the same UART.
+ *
+ * Please refer README.md in the root folder of this project for more details.
+ */
+
+#include <stdint.h>
+#include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_fmt.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
+#include "fpga_design_config/fpga_design_config.h"
+#include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
+
+/******************************************************************************
+ * Benchmark parameters.
+ *****************************************************************************/
+/* Baud rate of the console, used for the reports and the receive tests. */
+#define CONSOLE_BAUD_RATE               115200u
+
+/* Number of characters sent by each transmit test. */
+#define TX_TEST_SIZE                    1024u
+
+/* Number of characters received by each receive test. */
+#define RX_TEST_SIZE                    2048u
+
+/*
+ * The received characters are processed in frames of RX_FRAME_SIZE
+ * characters, each frame taking the load time of the test.
+ */
+#define RX_FRAME_SIZE                   16u
+
+/* A receive test gives up when no character arrives for this time. */
+#define RX_TIMEOUT_MS                   2000u
+
+/* Ring sizes, must be powers of two. */
+#define TX_RING_SIZE                    256u
+#define RX_RING_SIZE                    512u
+
+/* Number of idle loop iterations timed to calibrate the idle loop. */
+#define IDLE_CALIBRATION_COUNT          100000u
+
+/* Baud rates of the transmit tests. */
+static const uint32_t g_baud_rates[] =
+{
+    9600u, 57600u, 115200u, 230400u, 460800u, 921600u
+};
+
+#define NB_BAUD_RATES   (sizeof(g_baud_rates) / sizeof(g_baud_rates[0]))
+
+/* Processing time per received frame of the receive tests, in us. */
+static const uint32_t g_rx_loads_us[] =
+{
+    0u, 25u, 50u, 100u, 200u, 400u, 800u, 1600u, 3200u
+};
+
+#define NB_RX_LOADS     (sizeof(g_rx_loads_us) / sizeof(g_rx_loads_us[0]))
+
+/******************************************************************************
+ * Modes under test.
+ *****************************************************************************/
+typedef enum
+{
+    MODE_POLLED = 0,
+    MODE_IRQ,
+    MODE_RING,
+    NB_MODES
+} uart_mode_t;
+
+static const char * const g_mode_names[NB_MODES] = {"polled", "IRQ", "ring"};
+
+/******************************************************************************
+ * Result of a transmit test.
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t bytes_per_sec;
+    uint32_t cpu_permille;
+    uint32_t cycles_per_byte;
+} tx_result_t;
+
+/******************************************************************************
+ * CoreUARTapb instance data.
+ *****************************************************************************/
+UART_instance_t g_uart;
+
+static uint8_t g_tx_ring[TX_RING_SIZE];
+static uint8_t g_rx_ring[RX_RING_SIZE];
+static uint8_t g_tx_data[TX_TEST_SIZE];
+
+static volatile uart_mode_t g_mode = MODE_POLLED;
+
+/* Transmit state of the IRQ mode, and end of transmission flag. */
+static const uint8_t * volatile g_tx_ptr;
+static volatile uint32_t g_tx_remaining;
+static volatile uint8_t g_tx_done;
+
+/* Receive state of the IRQ mode. */
+static volatile uint32_t g_rx_count;
+static volatile uint32_t g_rx_frame_pos;
+static volatile uint32_t g_rx_load_cycles;
+static volatile uint8_t g_rx_errors;
+
+/* Processor clock cycles per idle loop iteration, times 256. */
+static uint32_t g_idle_cycles_x256;
+
+static uint8_t g_never = 0u;
+
+/*==============================================================================
+ * Messages displayed over the UART.
+ */
+static const char g_greeting_msg[] =
+"\r\n\r\n\t\t **** CoreUARTapb Throughput and Latency Benchmark ****\r\n\r\n";
+
+static const char g_baud_msg[] =
+"\r\nTransmit: the terminal shows invalid characters while the baud rates\r\n\
+other than the console baud rate are measured.\r\n";
+
+static const char g_rx_msg[] =
+"\r\nReceive: send a continuous stream of characters to the board, for\r\n\
+example a large text file from the terminal, or on Linux:\r\n\
+    yes 0123456789ABCDEF > /dev/ttyUSB0\r\n\
+Waiting for data...\r\n";
+
+/*==============================================================================
+ * Output helpers. The reports are always sent with polled transmission, at
+ * the console baud rate, between the tests.
+ */
+static void uart_sink(void * p_ctx, const char * p_buf, uint32_t length)
+{
+    UART_send((UART_instance_t *)p_ctx, (const uint8_t *)p_buf, length);
+}
+
+#define print(...)      MRV_fmt(uart_sink, &g_uart, __VA_ARGS__)
+
+/*==============================================================================
+ * Enable or disable the MSYS external interrupt 1, connected to UART_TXRDY.
+ * Called by the driver in ring mode.
+ */
+static void uart_tx_irq_control(UART_instance_t * this_uart, uint8_t enable)
+{
+    (void)this_uart;
+
+    if (enable)
+    {
+        MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    }
+    else
+    {
+        MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    }
+}
+
+/*==============================================================================
+ * Called from UART_tx_isr() in ring mode once the transmit ring is empty.
+ */
+static void uart_tx_complete(UART_instance_t * this_uart)
+{
+    (void)this_uart;
+
+    g_tx_done = 1u;
+}
+
+/*==============================================================================
+ * MSYS external interrupt 1, UART_TXRDY. In IRQ mode the handler refills the
+ * transmitter from the application buffer, in ring mode the driver does it
+ * from the transmit ring.
+ */
+void MSYS_EI1_IRQHandler(void)
+{
+    if (MODE_IRQ == g_mode)
+    {
+        size_t sent = UART_fill_tx_fifo(&g_uart, g_tx_ptr, g_tx_remaining);
+
+        g_tx_ptr += sent;
+        g_tx_remaining -= sent;
+        if (0u == g_tx_remaining)
+        {
+            MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+            g_tx_done = 1u;
+        }
+    }
+    else
+    {
+        UART_tx_isr(&g_uart);
+    }
+}
+
+/*==============================================================================
+ * MSYS external interrupt 2, UART_RXRDY. In IRQ mode the handler reads the
+ * characters and processes each complete frame, as a simple application
+ * would. In ring mode the driver only stores them in the receive ring.
+ */
+void MSYS_EI2_IRQHandler(void)
+{
+    if (MODE_IRQ == g_mode)
+    {
+        uint8_t rx_char;
+
+        while (0u != UART_get_rx(&g_uart, &rx_char, 1u))
+        {
+            g_rx_count++;
+            g_rx_frame_pos++;
+            if (g_rx_frame_pos >= RX_FRAME_SIZE)
+            {
+                g_rx_frame_pos = 0u;
+                MRV_delay_cycles(g_rx_load_cycles);
+            }
+        }
+        g_rx_errors |= UART_get_rx_status(&g_uart);
+    }
+    else
+    {
+        UART_rx_isr(&g_uart);
+    }
+}
+
+/*==============================================================================
+ * Idle loop, counting its iterations until *p_done is set or max iterations.
+ * The same loop is used for the calibration and the measurements.
+ */
+static uint32_t __attribute__((noinline))
+idle_loop(volatile uint8_t * p_done, uint32_t max)
+{
+    uint32_t count = 0u;
+
+    while ((0u == *p_done) && (count < max))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static void calibrate_idle_loop(void)
+{
+    uint32_t start = MRV_time_now32();
+    uint32_t count = idle_loop(&g_never, IDLE_CALIBRATION_COUNT);
+    uint32_t cycles = MRV_time_now32() - start;
+
+    g_idle_cycles_x256 = (uint32_t)(((uint64_t)cycles * 256u) / count);
+}
+
+/*==============================================================================
+ * Wait until the last character has left the transmitter, before changing the
+ * baud rate. The tests return once the last character is written to the
+ * transmit holding register, and CoreUARTapb does not report when the shift
+ * register is empty, so this waits for the time of two characters.
+ */
+static void uart_flush(uint32_t baud_rate)
+{
+    MRV_delay_us((2u * 10u * 1000000u) / baud_rate);
+}
+
+/*==============================================================================
+ * Initialize the UART at a baud rate, without interrupts. The baud value is
+ * computed at run time so that the tests follow SYS_CLK_FREQ.
+ */
+static uint16_t baud_value(uint32_t baud_rate)
+{
+    uint32_t divider = SYS_CLK_FREQ / (16u * baud_rate);
+
+    return (uint16_t)((divider > 0u) ? (divider - 1u) : 0u);
+}
+
+static uint32_t actual_baud_rate(uint32_t baud_rate)
+{
+    return SYS_CLK_FREQ / (16u * ((uint32_t)baud_value(baud_rate) + 1u));
+}
+
+static void uart_setup(uint32_t baud_rate)
+{
+    MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    MRV_disable_local_irq(MRV32_MSYS_EIE2_IRQn);
+    g_mode = MODE_POLLED;
+
+    UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, baud_value(baud_rate),
+              (DATA_8_BITS | NO_PARITY));
+}
+
+/*==============================================================================
+ * Transmit TX_TEST_SIZE characters in one of the modes, measuring the time
+ * until the last character is written to the transmitter and the iterations
+ * of the idle loop meanwhile.
+ */
+static void run_tx_test(uart_mode_t mode, tx_result_t * p_result)
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t idle = 0u;
+    uint64_t busy;
+
+    g_tx_done = 0u;
+    g_mode = mode;
+
+    start = MRV_time_now32();
+
+    switch (mode)
+    {
+        case MODE_POLLED:
+            UART_send(&g_uart, g_tx_data, TX_TEST_SIZE);
+            break;
+
+        case MODE_IRQ:
+            g_tx_ptr = g_tx_data;
+            g_tx_remaining = TX_TEST_SIZE;
+            MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+            idle = idle_loop(&g_tx_done, UINT32_MAX);
+            break;
+
+        default:
+            /*
+             * The ring is smaller than the test: the data is queued as room
+             * becomes available, which is the normal use of the ring.
+             */
+            {
+                uint32_t queued = 0u;
+
+                while (queued < TX_TEST_SIZE)
+                {
+                    queued += UART_send_async(&g_uart, &g_tx_data[queued],
+                                              TX_TEST_SIZE - queued);
+                    if (queued < TX_TEST_SIZE)
+                    {
+                        idle += idle_loop(&g_never, 16u);
+                    }
+                }
+
+                /*
+                 * The ring may have drained between two refills, setting
+                 * g_tx_done early: wait until it is empty after the last one.
+                 */
+                while (0u != UART_get_tx_pending(&g_uart))
+                {
+                    g_tx_done = 0u;
+                    if (0u != UART_get_tx_pending(&g_uart))
+                    {
+                        idle += idle_loop(&g_tx_done, UINT32_MAX);
+                    }
+                }
+            }
+            break;
+    }
+
+    cycles = MRV_time_now32() - start;
+    g_mode = MODE_POLLED;
+
+    busy = (uint64_t)cycles - (((uint64_t)idle * g_idle_cycles_x256) / 256u);
+    if (busy > cycles)
+    {
+        busy = 0u;
+    }
+
+    p_result->bytes_per_sec =
+        (uint32_t)(((uint64_t)TX_TEST_SIZE * SYS_CLK_FREQ) / cycles);
+    p_result->cpu_permille = (uint32_t)((busy * 1000u) / cycles);
+    p_result->cycles_per_byte = (uint32_t)(busy / TX_TEST_SIZE);
+}
+
+static void benchmark_tx(void)
+{
+    tx_result_t results[NB_BAUD_RATES][NB_MODES];
+    uint32_t baud_idx;
+    uint32_t mode;
+
+    print("%s", g_baud_msg);
+    uart_flush(CONSOLE_BAUD_RATE);
+
+    for (baud_idx = 0u; baud_idx < NB_BAUD_RATES; baud_idx++)
+    {
+        uart_setup(g_baud_rates[baud_idx]);
+        UART_init_tx_ring(&g_uart, g_tx_ring, sizeof(g_tx_ring),
+                          uart_tx_irq_control);
+        UART_set_tx_complete_handler(&g_uart, uart_tx_complete);
+
+        for (mode = 0u; mode < NB_MODES; mode++)
+        {
+            run_tx_test((uart_mode_t)mode, &results[baud_idx][mode]);
+            uart_flush(g_baud_rates[baud_idx]);
+        }
+    }
+
+    uart_setup(CONSOLE_BAUD_RATE);
+
+    print("\r\n\r\nTransmit, %u characters, SYS_CLK_FREQ %u Hz\r\n",
+          TX_TEST_SIZE, (uint32_t)SYS_CLK_FREQ);
+    print("    baud  actual  value  mode      bytes/s   line %%    CPU %%"
+          "  cycles/byte\r\n");
+
+    for (baud_idx = 0u; baud_idx < NB_BAUD_RATES; baud_idx++)
+    {
+        uint32_t actual = actual_baud_rate(g_baud_rates[baud_idx]);
+
+        for (mode = 0u; mode < NB_MODES; mode++)
+        {
+            const tx_result_t * p_result = &results[baud_idx][mode];
+
+            /* 10 bits per character: start, 8 data bits and stop bit. */
+            uint32_t line_permille = (uint32_t)
+                (((uint64_t)p_result->bytes_per_sec * 10000u) / actual);
+
+            if (0u == mode)
+            {
+                print("%8u %7u %6u", g_baud_rates[baud_idx], actual,
+                      (uint32_t)baud_value(g_baud_rates[baud_idx]));
+            }
+            else
+            {
+                print("%23s", "");
+            }
+            print("  %-6s %10u %8.1q %8.1q %12u\r\n", g_mode_names[mode],
+                  p_result->bytes_per_sec, line_permille,
+                  p_result->cpu_permille, p_result->cycles_per_byte);
+        }
+    }
+}
+
+/*==============================================================================
+ * Receive RX_TEST_SIZE characters in one of the modes, spending load_us for
+ * each frame of RX_FRAME_SIZE characters. Returns the number of loss events,
+ * or -1 when the data stopped arriving. A loss event is a check of the main
+ * loop finding that characters were lost since the previous check, so that
+ * the modes are counted the same way: CoreUARTapb reports an overflow with a
+ * sticky status bit, and a character count is only known in ring mode.
+ */
+static int32_t run_rx_test(uart_mode_t mode, uint32_t load_us)
+{
+    uint32_t load_cycles = (uint32_t)MRV_time_us_to_ticks(load_us);
+    uint32_t count = 0u;
+    uint32_t frame_pos = 0u;
+    uint32_t lost = 0u;
+    uint32_t ring_losses = 0u;
+    uint8_t errors = 0u;
+    uint8_t rx_buf[RX_FRAME_SIZE];
+    uart_rx_stats_t stats;
+    mrv_deadline_t timeout;
+
+    uart_setup(CONSOLE_BAUD_RATE);
+
+    /* Start from an empty receiver and clear the errors of the reports. */
+    while (0u != UART_get_rx(&g_uart, rx_buf, sizeof(rx_buf)))
+    {
+        ;
+    }
+    (void)UART_get_rx_status(&g_uart);
+
+    MRV_deadline_set_ms(&timeout, RX_TIMEOUT_MS);
+
+    switch (mode)
+    {
+        case MODE_POLLED:
+            /* Characters are only read between the frames processing. */
+            while ((count < RX_TEST_SIZE) && !MRV_deadline_expired(&timeout))
+            {
+                if (0u != UART_get_rx(&g_uart, rx_buf, 1u))
+                {
+                    count++;
+                    frame_pos++;
+                    if (frame_pos >= RX_FRAME_SIZE)
+                    {
+                        frame_pos = 0u;
+                        MRV_delay_cycles(load_cycles);
+                    }
+                    MRV_deadline_set_ms(&timeout, RX_TIMEOUT_MS);
+                }
+                errors |= UART_get_rx_status(&g_uart);
+                if (errors & UART_APB_OVERFLOW_ERROR)
+                {
+                    lost++;
+                    errors = 0u;
+                }
+            }
+            break;
+
+        case MODE_IRQ:
+            g_rx_count = 0u;
+            g_rx_frame_pos = 0u;
+            g_rx_load_cycles = load_cycles;
+            g_rx_errors = 0u;
+            g_mode = MODE_IRQ;
+            MRV_enable_local_irq(MRV32_MSYS_EIE2_IRQn);
+
+            while ((g_rx_count < RX_TEST_SIZE) &&
+                   !MRV_deadline_expired(&timeout))
+            {
+                if (count != g_rx_count)
+                {
+                    count = g_rx_count;
+                    MRV_deadline_set_ms(&timeout, RX_TIMEOUT_MS);
+                }
+                if (g_rx_errors & UART_APB_OVERFLOW_ERROR)
+                {
+                    MRV_disable_local_irq(MRV32_MSYS_EIE2_IRQn);
+                    g_rx_errors = 0u;
+                    lost++;
+                    MRV_enable_local_irq(MRV32_MSYS_EIE2_IRQn);
+                }
+            }
+            MRV_disable_local_irq(MRV32_MSYS_EIE2_IRQn);
+            count = g_rx_count;
+            break;
+
+        default:
+            /*
+             * The interrupt handler only fills the ring: the frames are
+             * processed here, with the interrupt enabled.
+             */
+            UART_init_rx_ring(&g_uart, g_rx_ring, sizeof(g_rx_ring),
+                              MRV_time_now32);
+            g_mode = MODE_RING;
+            MRV_enable_local_irq(MRV32_MSYS_EIE2_IRQn);
+
+            while ((count < RX_TEST_SIZE) && !MRV_deadline_expired(&timeout))
+            {
+                if (UART_get_rx_pending(&g_uart) >= RX_FRAME_SIZE)
+                {
+                    count += UART_read_rx_ring(&g_uart, rx_buf, RX_FRAME_SIZE);
+                    MRV_delay_cycles(load_cycles);
+                    MRV_deadline_set_ms(&timeout, RX_TIMEOUT_MS);
+                }
+                UART_get_rx_stats(&g_uart, &stats);
+                if ((stats.overflow_errors + stats.dropped) != ring_losses)
+                {
+                    ring_losses = stats.overflow_errors + stats.dropped;
+                    lost++;
+                }
+            }
+            MRV_disable_local_irq(MRV32_MSYS_EIE2_IRQn);
+            break;
+    }
+
+    g_mode = MODE_POLLED;
+
+    return (count < RX_TEST_SIZE) ? -1 : (int32_t)lost;
+}
+
+static void benchmark_rx(void)
+{
+    uint32_t nb_passed[NB_MODES] = {0u};
+    uint8_t failed[NB_MODES] = {0u};
+    uint32_t load_idx;
+    uint32_t mode;
+    uint8_t rx_char;
+
+    print("%s", g_rx_msg);
+
+    /* Wait for the stream to start. */
+    while (0u == UART_get_rx(&g_uart, &rx_char, 1u))
+    {
+        ;
+    }
+
+    print("\r\nReceive, %u characters per test, %u bytes frames, "
+          "loss events\r\n", RX_TEST_SIZE, RX_FRAME_SIZE);
+    print("  load us/frame    polled       IRQ      ring\r\n");
+
+    for (load_idx = 0u; load_idx < NB_RX_LOADS; load_idx++)
+    {
+        int32_t lost[NB_MODES];
+
+        for (mode = 0u; mode < NB_MODES; mode++)
+        {
+            lost[mode] = run_rx_test((uart_mode_t)mode,
+                                     g_rx_loads_us[load_idx]);
+            if (lost[mode] < 0)
+            {
+                print("\r\nNo data received for %u ms, test stopped.\r\n",
+                      RX_TIMEOUT_MS);
+                return;
+            }
+        }
+
+        print("%15u", g_rx_loads_us[load_idx]);
+        for (mode = 0u; mode < NB_MODES; mode++)
+        {
+            print(" %9d", lost[mode]);
+            if (0 != lost[mode])
+            {
+                failed[mode] = 1u;
+            }
+            else if (0u == failed[mode])
+            {
+                nb_passed[mode]++;
+            }
+        }
+        print("\r\n");
+    }
+
+    print("\r\nHighest load without loss, in us per frame of %u characters "
+          "(%u us at %u baud):\r\n", RX_FRAME_SIZE,
+          (RX_FRAME_SIZE * 10u * 1000000u) / CONSOLE_BAUD_RATE,
+          CONSOLE_BAUD_RATE);
+    for (mode = 0u; mode < NB_MODES; mode++)
+    {
+        print("  %-6s ", g_mode_names[mode]);
+        if (0u == nb_passed[mode])
+        {
+            print("characters lost without load\r\n");
+        }
+        else
+        {
+            print("%s%u\r\n", failed[mode] ? "" : ">= ",
+                  g_rx_loads_us[nb_passed[mode] - 1u]);
+        }
+    }
+}
+
+/******************************************************************************
+ * main function.
+ *****************************************************************************/
+void main(void)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < TX_TEST_SIZE; idx++)
+    {
+        /* Lines of 64 printable characters. */
+        uint32_t column = idx % 64u;
+
+        g_tx_data[idx] = (column == 62u) ? '\r' :
+                         (column == 63u) ? '\n' : (uint8_t)('0' + column);
+    }
+
+    uart_setup(CONSOLE_BAUD_RATE);
+    HAL_enable_interrupts();
+
+    print("%s", g_greeting_msg);
+    calibrate_idle_loop();
+    print("Idle loop: %.2q cycles per iteration\r\n",
+          (g_idle_cycles_x256 * 100u) / 256u);
+
+    benchmark_tx();
+    benchmark_rx();
+
+    print("\r\nBenchmark complete.\r\n");
+
+    while (1u)
+    {
+        ;
+    }
+}
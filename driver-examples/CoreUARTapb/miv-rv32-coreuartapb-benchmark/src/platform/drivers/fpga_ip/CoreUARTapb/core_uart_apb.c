@@ -0,0 +1,802 @@
+/*******************************************************************************
+ * (c) Copyright 2007-2023 Microchip FPGA Embedded Systems Solutions.
+ * 
+ * SPDX-License-Identifier: MIT
+ *
+ * @file core_uart_apb.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief CoreUARTapb driver implementation. See file "core_uart_apb.h" for 
+ * description of the functions implemented in this file.
+ * 
+ */
+
+#include "coreuartapb_regs.h"
+#include "core_uart_apb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NULL_INSTANCE ( ( UART_instance_t* ) 0 )
+#define NULL_BUFFER   ( ( uint8_t* ) 0 )
+
+#define MAX_LINE_CONFIG     ( ( uint8_t )( DATA_8_BITS | ODD_PARITY ) )
+#define MAX_BAUD_VALUE      ( ( uint16_t )( 0x1FFF ) )
+#define STATUS_ERROR_MASK   ( ( uint8_t )( STATUS_PARITYERR_MASK | \
+                                           STATUS_OVERFLOW_MASK  | \
+                                           STATUS_FRAMERR_MASK ) )
+#define BAUDVALUE_LSB ( (uint16_t) (0x00FF) )
+#define BAUDVALUE_MSB ( (uint16_t) (0xFF00) )
+#define BAUDVALUE_SHIFT ( (uint8_t) (5) )
+
+#define STATUS_ERROR_OFFSET STATUS_PARITYERR_SHIFT 
+
+/***************************************************************************//**
+ * UART_init()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_init
+(
+    UART_instance_t * this_uart,
+    addr_t base_addr,
+    uint16_t baud_value,
+    uint8_t line_config
+)
+{
+    uint8_t rx_full;
+    
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( line_config <= MAX_LINE_CONFIG )
+    HAL_ASSERT( baud_value <= MAX_BAUD_VALUE )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( line_config <= MAX_LINE_CONFIG ) &&
+        ( baud_value <= MAX_BAUD_VALUE ) )
+    {
+        /*
+         * Store lower 8-bits of baud value in CTRL1.
+         */
+        HAL_set_8bit_reg( base_addr, CTRL1, (uint_fast8_t)(baud_value &
+                                                       BAUDVALUE_LSB ) );
+    
+        /*
+         * Extract higher 5-bits of baud value and store in higher 5-bits 
+         * of CTRL2, along with line configuration in lower 3 three bits.
+         */
+        HAL_set_8bit_reg( base_addr, CTRL2, (uint_fast8_t)line_config | 
+                                           (uint_fast8_t)((baud_value &
+                                   BAUDVALUE_MSB) >> BAUDVALUE_SHIFT ) );
+    
+        this_uart->base_address = base_addr;
+#ifndef NDEBUG
+        {
+            uint8_t  config;
+            uint8_t  temp;
+            uint16_t baud_val;
+            baud_val = HAL_get_8bit_reg( this_uart->base_address, CTRL1 );
+            config =  HAL_get_8bit_reg( this_uart->base_address, CTRL2 );
+            /*
+             * To resolve operator precedence between & and <<
+             */
+            temp =  ( config  &  (uint8_t)(CTRL2_BAUDVALUE_MASK ) );
+            baud_val |= (uint16_t)( (uint16_t)(temp) << BAUDVALUE_SHIFT );
+            config &= (uint8_t)(~CTRL2_BAUDVALUE_MASK);
+            HAL_ASSERT( baud_val == baud_value );
+            HAL_ASSERT( config == line_config );
+        }        
+#endif
+        
+        /*
+         * Flush the receive FIFO of data that may have been received before the
+         * driver was initialized.
+         */
+        rx_full = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                    STATUS_RXFULL_MASK;
+        while ( rx_full )
+        {
+            HAL_get_8bit_reg( this_uart->base_address, RXDATA );
+            rx_full = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                        STATUS_RXFULL_MASK;
+        }
+
+        /*
+         * Clear status of the UART instance.
+         */
+        this_uart->status = (uint8_t)0;
+
+        /*
+         * No transmit ring until UART_init_tx_ring() is called.
+         */
+        this_uart->tx_ring = NULL_BUFFER;
+        this_uart->tx_ring_mask = 0u;
+        this_uart->tx_head = 0u;
+        this_uart->tx_tail = 0u;
+        this_uart->tx_irq_control = 0;
+        this_uart->tx_complete_handler = 0;
+
+        /*
+         * No receive ring until UART_init_rx_ring() is called.
+         */
+        this_uart->rx_ring = NULL_BUFFER;
+        this_uart->rx_ring_mask = 0u;
+        this_uart->rx_head = 0u;
+        this_uart->rx_tail = 0u;
+        this_uart->rx_get_time = 0;
+        this_uart->rx_frame_handler = 0;
+        this_uart->rx_frame_count = 0u;
+        this_uart->rx_delimiter = UART_RX_NO_DELIMITER;
+        this_uart->rx_idle_ticks = 0u;
+        this_uart->rx_frame_size = 0u;
+        this_uart->rx_last_time = 0u;
+    }
+}
+
+/***************************************************************************//**
+ * UART_send()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_send
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+)
+{
+    size_t char_idx;
+    uint8_t tx_ready;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( tx_buffer != NULL_BUFFER )
+    HAL_ASSERT( tx_size > 0 )
+      
+    if( (this_uart != NULL_INSTANCE) &&
+        (tx_buffer != NULL_BUFFER)   &&
+        (tx_size > (size_t)0) )
+    {
+        for ( char_idx = (size_t)0; char_idx < tx_size; char_idx++ )
+        {
+            /* Wait for UART to become ready to transmit. */
+            do {
+                tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                              STATUS_TXRDY_MASK;
+            } while ( !tx_ready );
+            /* Send next character in the buffer. */
+            HAL_set_8bit_reg( this_uart->base_address, TXDATA,
+                              (uint_fast8_t)tx_buffer[char_idx] );
+        }
+    }
+}
+
+/***************************************************************************//**
+ * UART_fill_tx_fifo()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_fill_tx_fifo
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+)
+{
+    uint8_t tx_ready;
+    size_t size_sent = 0u;
+    
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( tx_buffer != NULL_BUFFER )
+    HAL_ASSERT( tx_size > 0 )
+      
+    /* Fill the UART's Tx FIFO until the FIFO is full or the complete input 
+     * buffer has been written. */
+    if( (this_uart != NULL_INSTANCE) &&
+        (tx_buffer != NULL_BUFFER)   &&
+        (tx_size > 0u) )
+    {
+        tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                      STATUS_TXRDY_MASK;
+        if ( tx_ready )
+        {
+            do {
+                HAL_set_8bit_reg( this_uart->base_address, TXDATA,
+                                  (uint_fast8_t)tx_buffer[size_sent] );
+                size_sent++;
+                tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                              STATUS_TXRDY_MASK;
+            } while ( (tx_ready) && ( size_sent < tx_size ) );
+        }
+    }    
+    return size_sent;
+}
+
+/***************************************************************************//**
+ * UART_get_rx()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_get_rx
+(
+    UART_instance_t * this_uart,
+    uint8_t * rx_buffer,
+    size_t buff_size
+)
+{
+    uint8_t new_status;
+    uint8_t rx_full;
+    size_t rx_idx = 0u;
+    
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( rx_buffer != NULL_BUFFER )
+    HAL_ASSERT( buff_size > 0 )
+      
+    if( (this_uart != NULL_INSTANCE) &&
+        (rx_buffer != NULL_BUFFER)   &&
+        (buff_size > 0u) )
+    {
+        rx_idx = 0u;
+        new_status = HAL_get_8bit_reg( this_uart->base_address, STATUS );
+        this_uart->status |= new_status;
+        rx_full = new_status & STATUS_RXFULL_MASK;
+        while ( ( rx_full ) && ( rx_idx < buff_size ) )
+        {
+            rx_buffer[rx_idx] = HAL_get_8bit_reg( this_uart->base_address,
+                                                  RXDATA );
+            rx_idx++;
+            new_status = HAL_get_8bit_reg( this_uart->base_address, STATUS );
+            this_uart->status |= new_status;
+            rx_full = new_status & STATUS_RXFULL_MASK;
+        }
+    }
+    return rx_idx;
+}
+
+/***************************************************************************//**
+ * UART_polled_tx_string()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void 
+UART_polled_tx_string
+( 
+    UART_instance_t * this_uart, 
+    const uint8_t * p_sz_string
+)
+{
+    uint32_t char_idx;
+    uint8_t tx_ready;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( p_sz_string != NULL_BUFFER )
+    
+    if( ( this_uart != NULL_INSTANCE ) && ( p_sz_string != NULL_BUFFER ) )
+    {
+        char_idx = 0U;
+        while( 0U != p_sz_string[char_idx] )
+        {
+            /* Wait for UART to become ready to transmit. */
+            do {
+                tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                              STATUS_TXRDY_MASK;
+            } while ( !tx_ready );
+            /* Send next character in the buffer. */
+            HAL_set_8bit_reg( this_uart->base_address, TXDATA,
+                              (uint_fast8_t)p_sz_string[char_idx] );
+            char_idx++;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * UART_get_rx_status()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+uint8_t
+UART_get_rx_status
+(
+    UART_instance_t * this_uart
+)
+{
+    uint8_t status = UART_APB_INVALID_PARAM;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    /*
+     * Extract UART error status and place in lower bits of "status".
+     * Bit 0 - Parity error status
+     * Bit 1 - Overflow error status
+     * Bit 2 - Frame error status
+     */
+    if( this_uart != NULL_INSTANCE )
+    {
+        status = ( ( this_uart->status & STATUS_ERROR_MASK ) >> 
+                                          STATUS_ERROR_OFFSET );
+        /*
+         * Clear the sticky status for this instance.
+         */
+        this_uart->status = (uint8_t)0;
+    }
+    return status;
+}
+
+/***************************************************************************//**
+ * UART_init_tx_ring()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_init_tx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_irq_control_t irq_control
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( p_ring != NULL_BUFFER )
+    HAL_ASSERT( ring_size > 0u )
+    HAL_ASSERT( 0u == ( ring_size & ( ring_size - 1u ) ) )
+    HAL_ASSERT( irq_control != 0 )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( p_ring != NULL_BUFFER ) &&
+        ( ring_size > 0u ) &&
+        ( 0u == ( ring_size & ( ring_size - 1u ) ) ) &&
+        ( irq_control != 0 ) )
+    {
+        irq_control( this_uart, 0u );
+
+        this_uart->tx_ring = p_ring;
+        this_uart->tx_ring_mask = (uint32_t)ring_size - 1u;
+        this_uart->tx_head = 0u;
+        this_uart->tx_tail = 0u;
+        this_uart->tx_irq_control = irq_control;
+    }
+}
+
+/***************************************************************************//**
+ * UART_send_async()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_send_async
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+)
+{
+    size_t size_queued = 0u;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( tx_buffer != NULL_BUFFER )
+    HAL_ASSERT( this_uart->tx_ring != NULL_BUFFER )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( tx_buffer != NULL_BUFFER ) &&
+        ( this_uart->tx_ring != NULL_BUFFER ) )
+    {
+        uint32_t head = this_uart->tx_head;
+        uint32_t free_size = ( this_uart->tx_ring_mask + 1u ) -
+                             ( head - this_uart->tx_tail );
+
+        if( tx_size > free_size )
+        {
+            tx_size = free_size;
+        }
+
+        while( size_queued < tx_size )
+        {
+            this_uart->tx_ring[head & this_uart->tx_ring_mask] =
+                                                    tx_buffer[size_queued];
+            head++;
+            size_queued++;
+        }
+
+        if( size_queued > 0u )
+        {
+            /*
+             * Publish the data before enabling the interrupt. If UART_tx_isr()
+             * runs in between, it sends the data and disables the interrupt
+             * again, and the interrupt enabled below only finds an empty ring.
+             */
+            this_uart->tx_head = head;
+            this_uart->tx_irq_control( this_uart, 1u );
+        }
+    }
+
+    return size_queued;
+}
+
+/***************************************************************************//**
+ * UART_get_tx_pending()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_get_tx_pending
+(
+    UART_instance_t * this_uart
+)
+{
+    size_t pending = 0u;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( this_uart != NULL_INSTANCE )
+    {
+        pending = (size_t)( this_uart->tx_head - this_uart->tx_tail );
+    }
+
+    return pending;
+}
+
+/***************************************************************************//**
+ * UART_get_tx_free()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_get_tx_free
+(
+    UART_instance_t * this_uart
+)
+{
+    size_t free_size = 0u;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( this_uart->tx_ring != NULL_BUFFER ) )
+    {
+        free_size = (size_t)( ( this_uart->tx_ring_mask + 1u ) -
+                              ( this_uart->tx_head - this_uart->tx_tail ) );
+    }
+
+    return free_size;
+}
+
+/***************************************************************************//**
+ * UART_set_tx_complete_handler()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_set_tx_complete_handler
+(
+    UART_instance_t * this_uart,
+    uart_tx_handler_t handler
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( this_uart != NULL_INSTANCE )
+    {
+        this_uart->tx_complete_handler = handler;
+    }
+}
+
+/***************************************************************************//**
+ * UART_tx_isr()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_tx_isr
+(
+    UART_instance_t * this_uart
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( this_uart->tx_ring != NULL_BUFFER ) )
+    {
+        uint32_t start = this_uart->tx_tail;
+        uint32_t tail = start;
+        uint32_t head = this_uart->tx_head;
+        uint8_t tx_ready;
+
+        /* Fill the transmitter, and its FIFO when present, until it is full. */
+        tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                      STATUS_TXRDY_MASK;
+        while( ( tx_ready ) && ( tail != head ) )
+        {
+            HAL_set_8bit_reg( this_uart->base_address, TXDATA,
+                    (uint_fast8_t)this_uart->tx_ring[tail & this_uart->tx_ring_mask] );
+            tail++;
+            tx_ready = HAL_get_8bit_reg( this_uart->base_address, STATUS ) &
+                                                          STATUS_TXRDY_MASK;
+        }
+        this_uart->tx_tail = tail;
+
+        if( tail == this_uart->tx_head )
+        {
+            this_uart->tx_irq_control( this_uart, 0u );
+
+            /* Not on a spurious interrupt with nothing sent. */
+            if( ( this_uart->tx_complete_handler != 0 ) &&
+                ( tail != start ) )
+            {
+                this_uart->tx_complete_handler( this_uart );
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * UART_init_rx_ring()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_init_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_time_t get_time
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( p_ring != NULL_BUFFER )
+    HAL_ASSERT( ring_size > 0u )
+    HAL_ASSERT( 0u == ( ring_size & ( ring_size - 1u ) ) )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( p_ring != NULL_BUFFER ) &&
+        ( ring_size > 0u ) &&
+        ( 0u == ( ring_size & ( ring_size - 1u ) ) ) )
+    {
+        this_uart->rx_ring = p_ring;
+        this_uart->rx_ring_mask = (uint32_t)ring_size - 1u;
+        this_uart->rx_head = 0u;
+        this_uart->rx_tail = 0u;
+        this_uart->rx_get_time = get_time;
+        this_uart->rx_frame_size = 0u;
+        this_uart->rx_last_time = 0u;
+
+        this_uart->rx_stats.received = 0u;
+        this_uart->rx_stats.dropped = 0u;
+        this_uart->rx_stats.overflow_errors = 0u;
+        this_uart->rx_stats.framing_errors = 0u;
+        this_uart->rx_stats.parity_errors = 0u;
+    }
+}
+
+/***************************************************************************//**
+ * UART_set_rx_frame_handler()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_set_rx_frame_handler
+(
+    UART_instance_t * this_uart,
+    uart_rx_handler_t handler,
+    uint32_t frame_count,
+    int16_t delimiter,
+    uint32_t idle_ticks
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( ( 0u == idle_ticks ) || ( this_uart->rx_get_time != 0 ) )
+
+    if( this_uart != NULL_INSTANCE )
+    {
+        this_uart->rx_frame_handler = handler;
+        this_uart->rx_frame_count = frame_count;
+        this_uart->rx_delimiter = delimiter;
+        this_uart->rx_idle_ticks = idle_ticks;
+    }
+}
+
+/***************************************************************************//**
+ * UART_read_rx_ring()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_read_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * rx_buffer,
+    size_t buff_size
+)
+{
+    size_t size_read = 0u;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( rx_buffer != NULL_BUFFER )
+    HAL_ASSERT( this_uart->rx_ring != NULL_BUFFER )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( rx_buffer != NULL_BUFFER ) &&
+        ( this_uart->rx_ring != NULL_BUFFER ) )
+    {
+        uint32_t tail = this_uart->rx_tail;
+        uint32_t pending = this_uart->rx_head - tail;
+
+        if( buff_size > pending )
+        {
+            buff_size = pending;
+        }
+
+        while( size_read < buff_size )
+        {
+            rx_buffer[size_read] =
+                        this_uart->rx_ring[tail & this_uart->rx_ring_mask];
+            tail++;
+            size_read++;
+        }
+
+        /* Free the space only once the data has been copied. */
+        this_uart->rx_tail = tail;
+    }
+
+    return size_read;
+}
+
+/***************************************************************************//**
+ * UART_get_rx_pending()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+size_t
+UART_get_rx_pending
+(
+    UART_instance_t * this_uart
+)
+{
+    size_t pending = 0u;
+
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( this_uart != NULL_INSTANCE )
+    {
+        pending = (size_t)( this_uart->rx_head - this_uart->rx_tail );
+    }
+
+    return pending;
+}
+
+/***************************************************************************//**
+ * UART_get_rx_stats()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_get_rx_stats
+(
+    UART_instance_t * this_uart,
+    uart_rx_stats_t * p_stats
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+    HAL_ASSERT( p_stats != ( uart_rx_stats_t * )0 )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( p_stats != ( uart_rx_stats_t * )0 ) )
+    {
+        *p_stats = this_uart->rx_stats;
+    }
+}
+
+/***************************************************************************//**
+ * UART_rx_isr()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_rx_isr
+(
+    UART_instance_t * this_uart
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( this_uart->rx_ring != NULL_BUFFER ) )
+    {
+        uint32_t head = this_uart->rx_head;
+        uint32_t frame_size = this_uart->rx_frame_size;
+        uint8_t received = 0u;
+        uint8_t new_status;
+
+        /*
+         * One STATUS read per character: it gives both the RXFULL flag and
+         * the errors of the character about to be read from RXDATA.
+         */
+        new_status = HAL_get_8bit_reg( this_uart->base_address, STATUS );
+        while( 0u != ( new_status & STATUS_RXFULL_MASK ) )
+        {
+            uint8_t rx_byte;
+            uint8_t events = 0u;
+
+            this_uart->status |= new_status;
+            if( 0u != ( new_status & STATUS_ERROR_MASK ) )
+            {
+                if( 0u != ( new_status & STATUS_OVERFLOW_MASK ) )
+                {
+                    this_uart->rx_stats.overflow_errors++;
+                }
+                if( 0u != ( new_status & STATUS_FRAMERR_MASK ) )
+                {
+                    this_uart->rx_stats.framing_errors++;
+                }
+                if( 0u != ( new_status & STATUS_PARITYERR_MASK ) )
+                {
+                    this_uart->rx_stats.parity_errors++;
+                }
+            }
+
+            rx_byte = HAL_get_8bit_reg( this_uart->base_address, RXDATA );
+            received = 1u;
+
+            if( ( head - this_uart->rx_tail ) <= this_uart->rx_ring_mask )
+            {
+                this_uart->rx_ring[head & this_uart->rx_ring_mask] = rx_byte;
+                head++;
+                frame_size++;
+                this_uart->rx_stats.received++;
+
+                if( ( this_uart->rx_frame_count > 0u ) &&
+                    ( frame_size >= this_uart->rx_frame_count ) )
+                {
+                    events |= UART_RX_EVENT_COUNT;
+                }
+                if( (int16_t)rx_byte == this_uart->rx_delimiter )
+                {
+                    events |= UART_RX_EVENT_DELIMITER;
+                }
+            }
+            else
+            {
+                this_uart->rx_stats.dropped++;
+            }
+
+            if( ( 0u != events ) && ( this_uart->rx_frame_handler != 0 ) )
+            {
+                /*
+                 * Publish the frame before calling the handler so that it can
+                 * read it from the ring, up to and including this character.
+                 */
+                this_uart->rx_head = head;
+                frame_size = 0u;
+                this_uart->rx_frame_size = 0u;
+                this_uart->rx_frame_handler( this_uart, events );
+            }
+
+            new_status = HAL_get_8bit_reg( this_uart->base_address, STATUS );
+        }
+
+        this_uart->rx_head = head;
+        this_uart->rx_frame_size = frame_size;
+
+        if( ( received ) && ( this_uart->rx_get_time != 0 ) )
+        {
+            this_uart->rx_last_time = this_uart->rx_get_time();
+        }
+    }
+}
+
+/***************************************************************************//**
+ * UART_rx_idle_check()
+ * See "core_uart_apb.h" for details of how to use this function.
+ */
+void
+UART_rx_idle_check
+(
+    UART_instance_t * this_uart
+)
+{
+    HAL_ASSERT( this_uart != NULL_INSTANCE )
+
+    if( ( this_uart != NULL_INSTANCE ) &&
+        ( this_uart->rx_frame_handler != 0 ) &&
+        ( this_uart->rx_get_time != 0 ) &&
+        ( this_uart->rx_idle_ticks > 0u ) &&
+        ( this_uart->rx_frame_size > 0u ) )
+    {
+        /* Unsigned subtraction: correct across the wrap of the counter. */
+        uint32_t idle = this_uart->rx_get_time() - this_uart->rx_last_time;
+
+        if( idle >= this_uart->rx_idle_ticks )
+        {
+            this_uart->rx_frame_size = 0u;
+            this_uart->rx_frame_handler( this_uart, UART_RX_EVENT_IDLE );
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
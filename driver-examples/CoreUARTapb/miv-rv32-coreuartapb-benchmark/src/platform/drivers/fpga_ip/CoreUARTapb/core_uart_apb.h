@@ -0,0 +1,911 @@
+/*******************************************************************************
+ * (c) Copyright 2007-2023 Microchip FPGA Embedded Systems Solutions.
+ * 
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file core_uart_apb.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief This file contains the application programming interface for the 
+ * CoreUARTapb bare metal driver.
+ *
+ */
+/*=========================================================================*//**
+  @mainpage CoreUARTapb Bare Metal Driver.
+
+  @section intro_sec Introduction
+  CoreUARTapb is an implementation of the Universal Asynchronous 
+  Receiver/Transmitter aimed at minimal FPGA tile usage within a Microchip FPGA.
+  The CoreUARTapb bare metal software driver is designed to be used in systems 
+  with no operating system.
+
+  The CoreUARTapb driver provides functions for basic polled transmitting and 
+  receiving operations. It also provide functions that allow the use of the 
+  CoreUARTapb in interrupt-driven mode but leaves the management of interrupts 
+  to the calling application, as interrupt enabling and disabling are not 
+  controlled through the CoreUARTapb registers. The CoreUARTapb driver is 
+  provided as C source code.
+
+  @section driver_configuration Driver Configuration
+  Your application software should configure the CoreUARTapb driver by calling
+  the UART_init() function for each CoreUARTapb instance in the hardware design.
+  The configuration parameters include the CoreUARTapb hardware instance base
+  address and other runtime parameters, such as baud rate, bit width, and 
+  parity. No CoreUARTapb hardware configuration parameters are needed by the
+  driver, apart from the CoreUARTapb hardware instance base address. Hence, no 
+  additional configuration files are required to use the driver.
+
+  A CoreUARTapb hardware instance is generated with fixed baud rate, character
+  size, and parity configuration settings as part of the hardware flow. The
+  baud_value and line_config parameter values passed to the UART_init() function
+  have no effect if fixed values were selected for the baud rate, character 
+  size, and parity in the hardware configuration of CoreUARTapb. When fixed 
+  values are selected for these hardware configuration parameters, the driver is
+  unable to overwrite the fixed values in the CoreUARTapb control registers, 
+  CTRL1 and CTRL2.
+
+  @section theory_op Theory of Operation
+  The CoreUARTapb software driver is designed to allow the control of multiple 
+  instances of CoreUARTapb. Each instance of CoreUARTapb in the hardware design 
+  is associated with a single instance of the UART_instance_t structure in the 
+  software. You need to allocate memory for one unique UART_instance_t structure
+  instance for each CoreUARTapb hardware instance. The contents of these data 
+  structures are initialized while calling the UART_init() function. A pointer   
+  to the structure is passed to the subsequent driver functions in order to   
+  identify the CoreUARTapb hardware instance you wish to perform the requested  
+  operation on.
+  
+  Note: Do not attempt to directly manipulate the content of UART_instance_t 
+  structures. This structure is only intended to be modified by the driver 
+  function.
+
+  Once initialized, the driver transmits and receives data. Transmit is 
+  performed using the UART_send() function. If this function blocks, then it 
+  returns only when the data passed to it has been sent to the CoreUARTapb 
+  hardware. Data received by the CoreUARTapb hardware is read by the user
+  application using the UART_get_rx() function.
+
+  The UART_fill_tx_fifo() function is also provided as a part of the
+  interrupt-driven transmit. This function fills the CoreUARTapb hardware 
+  transmit FIFO with the content of a data buffer passed as a parameter before 
+  returning. The control of the interrupts must be implemented outside the 
+  driver, as the CoreUARTapb hardware does not provide the ability to enable 
+  or disable its interrupt sources.
+
+  The UART_polled_tx_string() function is provided to transmit a NULL-terminated
+  string in polled mode. If this function blocks, then it returns only when the 
+  data passed to it has been sent to the CoreUARTapb hardware.
+
+  The UART_get_rx_status() function returns the error status of the CoreUARTapb
+  receiver. This is used by applications to take appropriate action in case of
+  receiver errors.
+
+  @section tx_ring Interrupt-Driven Transmit Ring
+  UART_send() and UART_polled_tx_string() wait on the TXRDY status bit for
+  every character, so the processor is busy for the whole duration of the
+  transmission: close to 90 microseconds per character at 115200 baud.
+
+  The UART_init_tx_ring() function attaches a ring buffer to a CoreUARTapb
+  instance. UART_send_async() then copies the data to the ring and returns
+  immediately. The UART_tx_isr() function, called from the interrupt handler of
+  the processor interrupt connected to the TXRDY output of CoreUARTapb, writes
+  the ring content to the transmitter for as long as TXRDY is set, so that the
+  transmit FIFO is filled completely on each interrupt when FIFO mode is
+  enabled. A handler registered with UART_set_tx_complete_handler() is called
+  once the ring is empty.
+
+  TXRDY is a level signal which stays set while the transmitter has room, and
+  CoreUARTapb provides no register to mask it. The application therefore
+  provides a function enabling and disabling the TXRDY interrupt at the
+  processor or interrupt controller level: the driver enables the interrupt
+  when data is queued and disables it when the ring is empty.
+
+      static void uart_tx_irq_control(UART_instance_t * this_uart, uint8_t enable)
+      {
+          if (enable)
+          {
+              MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+          }
+          else
+          {
+              MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+          }
+      }
+
+      void MSYS_EI1_IRQHandler(void)
+      {
+          UART_tx_isr(&g_uart);
+      }
+
+  The same function can call PLIC_EnableIRQ() and PLIC_DisableIRQ() when the
+  TXRDY output is routed through the PLIC, and the transmit ring works the same
+  way under FreeRTOS: a task can wait on a semaphore given by the
+  transmit-complete handler. UART_send_async() must only be called from one
+  context at a time; tasks sharing a UART must serialize their calls, for
+  example with a mutex.
+
+  @section rx_ring Interrupt-Driven Receive Ring
+  UART_get_rx() must be polled, reads the STATUS register twice per character
+  and only reports receive errors after the fact, through the sticky status
+  returned by UART_get_rx_status(). A protocol receiving frames, such as YMODEM
+  or a command shell, then has to busy-poll the UART to avoid losing
+  characters.
+
+  The UART_init_rx_ring() function attaches a receive ring buffer to a
+  CoreUARTapb instance. The UART_rx_isr() function, called from the interrupt
+  handler of the processor interrupt connected to the RXRDY output of
+  CoreUARTapb, drains the receiver, and its FIFO when present, into the ring.
+  It reads STATUS once per character and counts the parity, overflow and
+  framing errors, as well as the characters dropped because the ring was full.
+  The application reads the ring with UART_read_rx_ring().
+
+  A frame handler registered with UART_set_rx_frame_handler() is called, in
+  interrupt context, when one of the following events occurs:
+    - UART_RX_EVENT_COUNT: a number of characters was received since the
+      previous event,
+    - UART_RX_EVENT_DELIMITER: the delimiter character, for example '\r', was
+      received,
+    - UART_RX_EVENT_IDLE: no character was received for the idle time after
+      the last one, which usually marks the end of a frame.
+
+  Each event covers the characters received since the previous one. The idle
+  time is measured with a time function supplied by the application, for
+  example MRV_time_now32() from miv_rv32_time.h. Since no RXRDY interrupt
+  occurs once the line is idle, UART_rx_idle_check() must be called
+  periodically, for example from the SysTick handler, to raise the idle
+  event:
+
+      static uint8_t g_rx_ring[256];
+
+      UART_init_rx_ring(&g_uart, g_rx_ring, sizeof(g_rx_ring), MRV_time_now32);
+      UART_set_rx_frame_handler(&g_uart, uart_rx_frame, 64u, '\r',
+                                MRV_time_us_to_ticks(2000u));
+
+      void MSYS_EI2_IRQHandler(void)
+      {
+          UART_rx_isr(&g_uart);
+      }
+
+      void SysTick_Handler(void)
+      {
+          UART_rx_idle_check(&g_uart);
+      }
+
+  UART_rx_isr() and UART_rx_idle_check() must not interrupt each other; give
+  their interrupts the same priority when the interrupt controller supports
+  nesting.
+*//*=========================================================================*/
+#ifndef __CORE_UART_APB_H
+#define __CORE_UART_APB_H 1
+
+#ifndef LEGACY_DIR_STRUCTURE
+#include "hal/hal.h"
+
+#else
+#include "hal.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Data Bits Length Defines
+  ========================
+  These constants define the data length in a UART packet.
+  | Constant    | Description                           |
+  |-------------|---------------------------------------|
+  | DATA_7_BITS | Data length is 7-bits                 |
+  | DATA_8_BITS | Data length is 8-bits                 |
+ */
+#define DATA_7_BITS     0x00u
+#define DATA_8_BITS     0x01u
+
+/***************************************************************************//**
+  Parity Defines
+  ==============
+  These constants define parity check options.
+  | Constant    | Description                           |
+  |-------------|---------------------------------------|
+  | NO_PARITY   | No Parity bit                         |
+  | EVEN_PARITY | Even Parity bit                       |
+  | ODD_PARITY  | ODD Parity bit                        |
+ */
+#define NO_PARITY       0x00u
+#define EVEN_PARITY     0x02u
+#define ODD_PARITY      0x06u
+
+/***************************************************************************//**
+  Error Status Definitions
+  ========================
+  These constants define the different types of possible errors in UART 
+  transmission of data.
+  | Constant                | Description                           |
+  |-------------------------|---------------------------------------|
+  | UART_APB_PARITY_ERROR   | Data parity error                     |
+  | UART_APB_OVERFLOW_ERROR | Data overflow error                   |
+  | UART_APB_FRAMING_ERROR  | Data framing error                    |
+  | UART_APB_NO_ERROR       | No error                              |
+  | UART_APB_INVALID_PARAM  | Invalid parameter                     |
+ */
+#define UART_APB_PARITY_ERROR    0x01u
+#define UART_APB_OVERFLOW_ERROR  0x02u
+#define UART_APB_FRAMING_ERROR   0x04u
+#define UART_APB_NO_ERROR        0x00u
+#define UART_APB_INVALID_PARAM   0xFFu
+
+struct uart_instance;
+
+/***************************************************************************//**
+ * The uart_irq_control_t type is the prototype of the application function
+ * enabling (enable = 1) or disabling (enable = 0) the processor interrupt
+ * connected to the TXRDY output of a CoreUARTapb instance.
+ */
+typedef void (*uart_irq_control_t)(struct uart_instance * this_uart,
+                                   uint8_t enable);
+
+/***************************************************************************//**
+ * The uart_tx_handler_t type is the prototype of the transmit-complete
+ * handler, called from UART_tx_isr() when the transmit ring becomes empty.
+ */
+typedef void (*uart_tx_handler_t)(struct uart_instance * this_uart);
+
+/***************************************************************************//**
+  Receive Frame Events
+  ====================
+  These constants are the events passed to the receive frame handler. Several
+  events can be combined in one call.
+  | Constant                | Description                                   |
+  |-------------------------|-----------------------------------------------|
+  | UART_RX_EVENT_COUNT     | Frame character count reached                 |
+  | UART_RX_EVENT_DELIMITER | Delimiter character received                  |
+  | UART_RX_EVENT_IDLE      | Line idle after the last character received   |
+ */
+#define UART_RX_EVENT_COUNT         0x01u
+#define UART_RX_EVENT_DELIMITER     0x02u
+#define UART_RX_EVENT_IDLE          0x04u
+
+/***************************************************************************//**
+  The UART_RX_NO_DELIMITER constant disables the delimiter event when passed
+  as the delimiter parameter of UART_set_rx_frame_handler().
+ */
+#define UART_RX_NO_DELIMITER        (-1)
+
+/***************************************************************************//**
+ * The uart_rx_handler_t type is the prototype of the receive frame handler,
+ * called from UART_rx_isr() or UART_rx_idle_check(). The events parameter is a
+ * combination of the UART_RX_EVENT_xxx constants.
+ */
+typedef void (*uart_rx_handler_t)(struct uart_instance * this_uart,
+                                  uint8_t events);
+
+/***************************************************************************//**
+ * The uart_time_t type is the prototype of the application function returning
+ * the current time, in ticks of a free-running 32 bit counter, used to detect
+ * the idle line.
+ */
+typedef uint32_t (*uart_time_t)(void);
+
+/***************************************************************************//**
+ * The uart_rx_stats_t structure holds the receive counters returned by
+ * UART_get_rx_stats().
+ */
+typedef struct
+{
+    uint32_t received;          /* characters stored in the receive ring */
+    uint32_t dropped;           /* characters lost because the ring was full */
+    uint32_t overflow_errors;   /* characters lost by the receiver */
+    uint32_t framing_errors;
+    uint32_t parity_errors;
+} uart_rx_stats_t;
+
+/***************************************************************************//**  
+ * There should be one instance of this structure for each instance of 
+ * CoreUARTapb in your system. This structure instance identifies various UARTs
+ * in a system and should be passed as first parameter to UART functions to
+ * identify which UART performs the requested operation. The 'status' element in
+ * the structure is used to provide sticky status information. The tx_xxx and
+ * rx_xxx elements hold the state of the interrupt-driven transmit and receive
+ * rings.
+ */
+typedef struct uart_instance
+{
+    addr_t      base_address;
+    uint8_t     status;
+
+    uint8_t *   tx_ring;
+    uint32_t    tx_ring_mask;
+    volatile uint32_t tx_head;
+    volatile uint32_t tx_tail;
+    uart_irq_control_t tx_irq_control;
+    uart_tx_handler_t tx_complete_handler;
+
+    uint8_t *   rx_ring;
+    uint32_t    rx_ring_mask;
+    volatile uint32_t rx_head;
+    volatile uint32_t rx_tail;
+    uart_time_t rx_get_time;
+    uart_rx_handler_t rx_frame_handler;
+    uint32_t    rx_frame_count;
+    int16_t     rx_delimiter;
+    uint32_t    rx_idle_ticks;
+    volatile uint32_t rx_frame_size;
+    volatile uint32_t rx_last_time;
+    uart_rx_stats_t rx_stats;
+} UART_instance_t;
+
+/***************************************************************************//**
+ * The UART_init() function initializes the UART with the configuration passed 
+ * as parameters. The configuration parameters are the baud_value that generates
+ * the baud rate and the line configuration (bit length and parity).
+ *
+ * @param this_uart   The this_uart parameter is a pointer to the 
+ *                    UART_instance_t structure, which holds all data regarding 
+ *                    this instance of the CoreUARTapb. This pointer is used to
+ *                    identify the target CoreUARTapb hardware instance in 
+ *                    subsequent calls to the CoreUARTapb functions.
+ * @param base_addr   The base_address parameter is the base address in the 
+ *                    processor's memory map for the registers of the 
+ *                    CoreUARTapb instance being initialized.
+ * @param baud_value  The baud_value parameter selects the baud rate for the
+ *                    UART. The baud value is calculated from the frequency of
+ *                    the system clock in hertz and the desired baud rate using
+ *                    the following equation:                      
+ *                    baud_value = (clock / (baud_rate * 16)) - 1.    
+ *                    The baud_value parameter must be a value in the range 0 
+ *                    to 8191 (or 0x0000 to 0x1FFF).
+ * @param line_config This parameter is the line configuration, specifies the 
+ *                    bit length and parity settings. This is the logical OR of:
+ *                     - DATA_7_BITS
+ *                     - DATA_8_BITS
+ *                     - NO_PARITY
+ *                     - EVEN_PARITY
+ *                     - ODD_PARITY  
+ *                    For example, 8 bits even parity would be specified as 
+ *                    (DATA_8_BITS | EVEN_PARITY). 
+ * @return            This function does not return a value.
+ * @example
+ * @code
+ *   #define BAUD_VALUE_57600    25
+ *   
+ *   #define COREUARTAPB0_BASE_ADDR      0xC3000000UL
+ *   
+ *   UART_instance_t g_uart;
+ *   int main()
+ *   {
+ *      UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, 
+                  BAUD_VALUE_57600, (DATA_8_BITS | EVEN_PARITY));
+ *   }
+ * @endcode
+ */
+void
+UART_init
+(
+    UART_instance_t * this_uart,
+    addr_t base_addr,
+    uint16_t baud_value,
+    uint8_t line_config
+);
+
+/***************************************************************************//**
+ * The UART_send() function is used to transmit data. It transfers the content
+ * of the transmitter data buffer, passed as a function parameter, into the 
+ * UART's hardware transmitter FIFO. It returns when the full content of the 
+ * transmitter data buffer has been transferred to the UART's transmitter FIFO. 
+ *
+ * Note: You should not assume that the data you are sending using this function 
+ * has been received at the other end by the time this function returns. The 
+ * actual transmission over the serial connection is still be taking place at
+ * the time of the function return. It is safe to release or reuse the memory
+ * used as the transmit buffer once this function returns.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to the 
+ *                      UART_instance_t structure, which holds all data
+ *                      regarding this instance of the CoreUARTapbUART.
+ * @param tx_buffer     The tx_buffer parameter is a pointer to a buffer that
+ *                      contains the data to be transmitted.
+ * @param tx_size       The tx_size parameter is the size in bytes of the 
+ *                      transmitted data.
+ *
+ * @return              This function does not return a value.
+ *
+ * @example
+ * @code
+ *   uint8_t testmsg1[] = {"\n\r\n\r\n\rUART_send() test message 1"};
+ *   UART_send(&g_uart,(const uint8_t *)&testmsg1,sizeof(testmsg1));
+ * @endcode
+ */
+void
+UART_send
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+);
+
+/***************************************************************************//**
+ * The UART_fill_tx_fifo() function fills the UART's transmitter hardware FIFO 
+ * with the data found in the transmitter buffer that is passed in as a 
+ * function parameter. The function returns either when the FIFO is full or 
+ * when the complete contents of the transmitter buffer have been copied into 
+ * the FIFO. It returns the number of bytes copied into the UART's transmitter
+ * hardware FIFO. This function is intended to be used as part of 
+ * interrupt-driven transmission.
+ *
+ * Note: You should not assume that the data you transmit using this function
+ * has been received at the other end by the time this function returns. The 
+ * actual transmission over the serial connection is still be taking place at
+ * the time of the function return. 
+ *
+ * @param this_uart     The this_uart parameter is a pointer to the 
+ *                      UART_instance_t structure, which holds all data 
+ *                      regarding this instance of the UART.
+ * @param tx_buffer     The tx_buffer parameter is a pointer to a buffer that
+ *                      contains the data to be transmitted.
+ * @param tx_size       The tx_size parameter is the size in bytes of the 
+ *                      transmitted data.
+ * @return              This function returns the number of bytes copied into
+ *                      the UART's transmitter hardware FIFO. 
+ *
+ * @example
+ * @code
+ *   void send_using_interrupt
+ *   (
+ *       uint8_t * pbuff,
+ *       size_t tx_size
+ *   )
+ *   {
+ *       size_t size_in_fifo;
+ *       size_in_fifo = UART_fill_tx_fifo( &g_uart, pbuff, tx_size );
+ *   }
+ * @endcode
+ */
+size_t
+UART_fill_tx_fifo
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+);
+
+/***************************************************************************//**
+ * The UART_get_rx() function reads the content of the UART's receiver hardware 
+ * FIFO and stores it in the receiver buffer that is passed in as a function 
+ * parameter. It copies either the full contents of the FIFO into the receiver 
+ * buffer, or just enough data from the FIFO to fill the receiver buffer, 
+ * depending on the size of the receiver buffer.  The size of the receiver 
+ * buffer is passed in as a function parameter. UART_get_rx() returns the number
+ * of bytes copied into the receiver buffer. If no data was received at the time
+ * the function is called, the function returns 0.
+ *
+ * Note:   This function reads and accumulates the receiver status of the 
+ *         CoreUARTapb instance before reading each byte from the receiver's 
+ *         data register/FIFO. This allows the driver to maintain a sticky 
+ *         record of any receiver errors that occur as the UART receives each 
+ *         data byte; receiver errors would otherwise be lost after each read 
+ *         from the receiver's data register. A call to the UART_get_rx_status()
+ *         function returns any receiver errors accumulated during the execution
+ *         of the UART_get_rx() function.  
+ * 
+ * Note:   When FIFO mode is disabled in the CoreUARTapb hardware configuration,
+ *         the driver accumulates a sticky record of any parity errors, framing 
+ *         errors, or overflow errors. When FIFO mode is enabled, the driver 
+ *         accumulates a sticky record of overflow errors only; in this case, 
+ *         interrupts must be used to handle parity errors or framing errors.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to the
+ *                      UART_instance_t structure, which holds all data 
+ *                      regarding this instance of the UART.
+ * @param rx_buffer     The rx_buffer parameter is a pointer to a buffer where
+ *                      the received data is copied.
+ * @param buff_size     The buff_size parameter is the size of the receive
+ *                      buffer in bytes.
+ * @return              This function returns the number of bytes copied into
+ *                      the receive buffer.
+ *
+ * @example
+ * @code
+ *   #define MAX_RX_DATA_SIZE    256
+ *   
+ *   uint8_t rx_data[MAX_RX_DATA_SIZE];
+ *   uint8_t rx_size = 0;
+ *           
+ *   rx_size = UART_get_rx( &g_uart, rx_data, sizeof(rx_data) );
+ * @endcode
+ */
+size_t
+UART_get_rx
+(
+    UART_instance_t * this_uart,
+    uint8_t * rx_buffer,
+    size_t buff_size
+);
+
+/***************************************************************************//**
+ * The UART_polled_tx_string() function is used to transmit a NULL ('\0') 
+ * terminated string. Internally, it polls for the transmit ready status and
+ * transfers the text starting at the address pointed by p_sz_string into
+ * the UART's hardware transmitter FIFO. It is a blocking function and returns
+ * only when the complete string has been transferred to the UART's transmit 
+ * FIFO.
+ *
+ * Note: You should not assume that the data you transmit using this function 
+ * has been received at the other end by the time this function returns. The
+ * actual transmission over the serial connection is still be taking place at
+ * the time of the function return.
+ *
+ * @param this_uart     The this_uart parameter is the pointer to a 
+ *                      UART_instance_t structure, which holds all data 
+ *                      regarding this instance of the UART.
+ * @param p_sz_string   The p_sz_string parameter is a pointer to a buffer
+ *                      containing the NULL ('\0') terminated string to be 
+ *                      transmitted.
+ * @return              This function does not return a value.
+ *
+ * @example
+ * @code
+ *   uint8_t testmsg1[] = {"\r\n\r\nUART_polled_tx_string() test message 1\0"};
+ *   UART_polled_tx_string(&g_uart,(const uint8_t *)&testmsg1);
+ * @endcode
+ */
+void 
+UART_polled_tx_string
+( 
+    UART_instance_t * this_uart, 
+    const uint8_t * p_sz_string
+);
+
+/***************************************************************************//**
+ * The UART_get_rx_status() function returns the receiver error status of the 
+ * CoreUARTapb instance. It reads both the current error status of the receiver
+ * and the accumulated error status from preceding calls to the UART_get_rx() 
+ * function and combines them using a bitwise OR. It returns the cumulative 
+ * parity, framing, and overflow error status of the receiver, since the 
+ * previous call to UART_get_rx_status() as an 8-bit encoded value.
+ *
+ * Note: The UART_get_rx() function reads and accumulates the receiver status 
+ * of the CoreUARTapb instance before reading each byte from the receiver's data
+ * register/FIFO. The driver maintains a sticky record of the cumulative error
+ * status, which persists after the UART_get_rx() function returns. The
+ * UART_get_rx_status() function clears this accumulated record of receiver 
+ * errors before returning.
+ * 
+ * @param this_uart     The this_uart parameter is a pointer to a 
+ *                      UART_instance_t structure which holds all data regarding 
+ *                      this instance of the UART.
+ * @return              This function returns the UART receiver error status as
+ *                      an 8-bit encoded value. The return value is 0, if there
+ *                      are no receiver errors occurred. The driver provides a
+ *                      set of bit mask constants, which should be compared with
+ *                      and/or used to mask the returned value to determine the 
+ *                      receiver error status.  
+ *                      When the return value is compared to the following bit 
+ *                      masks, a non-zero result indicates that the 
+ *                      corresponding error occurred:   
+ *                      UART_APB_PARITY_ERROR    (bit mask = 0x01)         
+ *                      UART_APB_OVERFLOW_ERROR  (bit mask = 0x02)  
+ *                      UART_APB_FRAMING_ERROR   (bit mask = 0x04)  
+ *                      When the return value is compared to the following bit 
+ *                      mask, a non-zero result indicates that no error 
+ *                      occurred:  
+ *                      UART_APB_NO_ERROR        (0x00)
+ *
+ * @example
+ * @code
+ *   UART_instance_t g_uart;
+ *   uint8_t rx_data[MAX_RX_DATA_SIZE];
+ *   uint8_t err_status;
+ *   err_status = UART_get_err_status(&g_uart);
+ *   
+ *   if(UART_APB_NO_ERROR == err_status )
+ *   {
+ *        rx_size = UART_get_rx( &g_uart, rx_data, MAX_RX_DATA_SIZE );
+ *   }
+ * @endcode
+ */
+uint8_t
+UART_get_rx_status
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_init_tx_ring() function attaches a transmit ring buffer to a
+ * CoreUARTapb instance, for use by UART_send_async() and UART_tx_isr(). It must
+ * be called after UART_init().
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_ring        The p_ring parameter is a pointer to the memory used
+ *                      for the ring buffer. It must remain allocated for as
+ *                      long as the ring is used.
+ * @param ring_size     The ring_size parameter is the size of the ring buffer
+ *                      in bytes. It must be a power of two.
+ * @param irq_control   The irq_control parameter is a pointer to the
+ *                      application function enabling and disabling the TXRDY
+ *                      interrupt. The interrupt is disabled by this function.
+ * @return              This function does not return a value.
+ *
+ * @example
+ * @code
+ *   static uint8_t g_tx_ring[512];
+ *
+ *   UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, BAUD_VALUE_115200,
+ *             (DATA_8_BITS | NO_PARITY));
+ *   UART_init_tx_ring(&g_uart, g_tx_ring, sizeof(g_tx_ring),
+ *                     uart_tx_irq_control);
+ * @endcode
+ */
+void
+UART_init_tx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_irq_control_t irq_control
+);
+
+/***************************************************************************//**
+ * The UART_send_async() function copies data to the transmit ring and enables
+ * the TXRDY interrupt. It returns without waiting for the data to be
+ * transmitted. The memory of tx_buffer can be reused as soon as the function
+ * returns.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param tx_buffer     The tx_buffer parameter is a pointer to a buffer that
+ *                      contains the data to be transmitted.
+ * @param tx_size       The tx_size parameter is the size in bytes of the
+ *                      data to transmit.
+ * @return              This function returns the number of bytes copied to the
+ *                      transmit ring. It is lower than tx_size when the ring
+ *                      does not have enough free space; the remaining data can
+ *                      be sent later.
+ */
+size_t
+UART_send_async
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+);
+
+/***************************************************************************//**
+ * The UART_get_tx_pending() function returns the number of bytes in the
+ * transmit ring which have not been written to the transmitter yet.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the number of pending bytes.
+ */
+size_t
+UART_get_tx_pending
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_get_tx_free() function returns the number of bytes which can be
+ * copied to the transmit ring by UART_send_async() without being truncated.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the free space of the transmit
+ *                      ring in bytes, or 0 when no ring is attached.
+ */
+size_t
+UART_get_tx_free
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_set_tx_complete_handler() function registers a function called by
+ * UART_tx_isr(), in interrupt context, when the last byte of the transmit ring
+ * has been written to the transmitter.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param handler       The handler parameter is a pointer to the function to
+ *                      call, or 0 to remove the handler.
+ * @return              This function does not return a value.
+ */
+void
+UART_set_tx_complete_handler
+(
+    UART_instance_t * this_uart,
+    uart_tx_handler_t handler
+);
+
+/***************************************************************************//**
+ * The UART_tx_isr() function must be called from the interrupt handler of the
+ * processor interrupt connected to the TXRDY output of the CoreUARTapb
+ * instance. It moves data from the transmit ring to the transmitter for as
+ * long as TXRDY is set. When the ring is empty, it disables the TXRDY
+ * interrupt and calls the transmit-complete handler.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_tx_isr
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_init_rx_ring() function attaches a receive ring buffer to a
+ * CoreUARTapb instance, for use by UART_rx_isr(), and clears the receive
+ * counters. It must be called after UART_init() and before the RXRDY
+ * interrupt is enabled.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_ring        The p_ring parameter is a pointer to the memory used
+ *                      for the ring buffer. It must remain allocated for as
+ *                      long as the ring is used.
+ * @param ring_size     The ring_size parameter is the size of the ring buffer
+ *                      in bytes. It must be a power of two.
+ * @param get_time      The get_time parameter is a pointer to the application
+ *                      function returning the current time, used for the idle
+ *                      event. It can be 0 when the idle event is not used.
+ * @return              This function does not return a value.
+ */
+void
+UART_init_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_time_t get_time
+);
+
+/***************************************************************************//**
+ * The UART_set_rx_frame_handler() function registers the receive frame handler
+ * and the events for which it is called.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param handler       The handler parameter is a pointer to the function to
+ *                      call, or 0 to remove the handler.
+ * @param frame_count   The frame_count parameter is the number of characters
+ *                      raising UART_RX_EVENT_COUNT, or 0 to disable the event.
+ * @param delimiter     The delimiter parameter is the character raising
+ *                      UART_RX_EVENT_DELIMITER, or UART_RX_NO_DELIMITER.
+ * @param idle_ticks    The idle_ticks parameter is the time without character,
+ *                      in ticks of the time function passed to
+ *                      UART_init_rx_ring(), raising UART_RX_EVENT_IDLE, or 0 to
+ *                      disable the event.
+ * @return              This function does not return a value.
+ */
+void
+UART_set_rx_frame_handler
+(
+    UART_instance_t * this_uart,
+    uart_rx_handler_t handler,
+    uint32_t frame_count,
+    int16_t delimiter,
+    uint32_t idle_ticks
+);
+
+/***************************************************************************//**
+ * The UART_read_rx_ring() function copies received data from the receive ring
+ * to a buffer and removes it from the ring.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param rx_buffer     The rx_buffer parameter is a pointer to the buffer
+ *                      receiving the data.
+ * @param buff_size     The buff_size parameter is the size of the buffer in
+ *                      bytes.
+ * @return              This function returns the number of bytes copied, which
+ *                      is 0 when the ring is empty.
+ */
+size_t
+UART_read_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * rx_buffer,
+    size_t buff_size
+);
+
+/***************************************************************************//**
+ * The UART_get_rx_pending() function returns the number of bytes in the
+ * receive ring which have not been read yet.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the number of pending bytes.
+ */
+size_t
+UART_get_rx_pending
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_get_rx_stats() function returns the receive counters of a
+ * CoreUARTapb instance. The counters are cleared by UART_init_rx_ring() only.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_stats       The p_stats parameter is a pointer to the structure
+ *                      receiving the counters.
+ * @return              This function does not return a value.
+ */
+void
+UART_get_rx_stats
+(
+    UART_instance_t * this_uart,
+    uart_rx_stats_t * p_stats
+);
+
+/***************************************************************************//**
+ * The UART_rx_isr() function must be called from the interrupt handler of the
+ * processor interrupt connected to the RXRDY output of the CoreUARTapb
+ * instance. It moves the received characters to the receive ring, counts the
+ * receive errors and calls the frame handler on the count and delimiter
+ * events.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_rx_isr
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_rx_idle_check() function calls the frame handler with
+ * UART_RX_EVENT_IDLE when characters were received since the previous event
+ * and none for the idle time. It must be called periodically, at an interval
+ * shorter than the idle time, for the event to be raised on time.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_rx_idle_check
+(
+    UART_instance_t * this_uart
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_UART_APB_H */
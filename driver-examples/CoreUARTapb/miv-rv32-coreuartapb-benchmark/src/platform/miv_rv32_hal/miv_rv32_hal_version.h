@@ -0,0 +1,27 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_hal_version.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Hardware Abstraction Layer functions for Mi-V soft processors
+ *
+ */
+ 
+#ifndef MIV_RV32_HAL_VERSION_H
+#define MIV_RV32_HAL_VERSION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MIV_RV32_HAL_VERSION_MAJOR 4
+#define MIV_RV32_HAL_VERSION_MINOR 2
+#define MIV_RV32_HAL_VERSION_PATCH 101
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include <drivers/fpga_ip/CoreUARTapb/core_uart_apb.h>
 #include "fpga_design_config/fpga_design_config.h"
 #include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_time.h"
+#include "uart_log/uart_log.h"
 
 /******************************************************************************
  * Maximum receiver buffer size.
@@ -20,6 +22,34 @@
 #define MAX_RX_DATA_SIZE    256
 #define NULL 0
 
+/******************************************************************************
+ * Transmit ring size, must be a power of two.
+ *****************************************************************************/
+#define TX_RING_SIZE        512
+
+/******************************************************************************
+ * Receive ring size, must be a power of two.
+ *****************************************************************************/
+#define RX_RING_SIZE        256
+
+/******************************************************************************
+ * Receive frame events: a frame ends on a carriage return, after 64
+ * characters, or when the line is idle for 5 ms. The idle time is checked
+ * every millisecond from the SysTick handler.
+ *****************************************************************************/
+#define RX_FRAME_COUNT      64u
+#define RX_FRAME_DELIMITER  '\r'
+#define RX_IDLE_TIME_US     5000u
+#define SYSTICK_RATE_HZ     1000u
+
+/******************************************************************************
+ * Log channel ring sizes, must be powers of two, and period of the status
+ * message.
+ *****************************************************************************/
+#define APP_LOG_RING_SIZE   512
+#define RX_LOG_RING_SIZE    1024
+#define STATUS_PERIOD_MS    10000u
+
 /******************************************************************************
  * CoreUARTapb instance data.
  *****************************************************************************/
@@ -28,6 +58,29 @@ UART_instance_t g_uart;
 uint8_t rx_data[MAX_RX_DATA_SIZE];
 size_t rx_size = NULL;
 
+static uint8_t g_tx_ring[TX_RING_SIZE];
+static uint8_t g_rx_ring[RX_RING_SIZE];
+volatile uint32_t g_tx_complete_count = 0u;
+volatile uint32_t g_rx_frame_count = 0u;
+volatile uint8_t g_rx_frame_pending = 0u;
+
+/******************************************************************************
+ * A second CoreUARTapb, when present in the design, carries the receive log
+ * so that it does not mix with the echoed frames.
+ *****************************************************************************/
+#ifdef COREUARTAPB1_BASE_ADDR
+UART_instance_t g_uart1;
+static uint8_t g_tx_ring1[TX_RING_SIZE];
+#endif
+
+/******************************************************************************
+ * Log channels: "app" for the main loop, "rx" for the receive frame handler.
+ *****************************************************************************/
+static uart_log_channel_t g_app_log;
+static uart_log_channel_t g_rx_log;
+static uint8_t g_app_log_ring[APP_LOG_RING_SIZE];
+static uint8_t g_rx_log_ring[RX_LOG_RING_SIZE];
+
 /******************************************************************************
  * Greeting message displayed over the UART terminal.
  *****************************************************************************/
@@ -38,42 +91,148 @@ uint8_t g_message[] =
 ***************************************************************************\r\n\
 \r\n\r\n\
 This example project demonstrates the interrupt based transmission and reception\
-\r\nusing CoreUARTapb. Press any key to get an interrupt.\r\n\n";
+\r\nusing CoreUARTapb. Type a line of text: it is echoed back as one frame when\
+\r\nyou press Enter, or when you stop typing.\r\n\n";
 
 /******************************************************************************
- * Interrupt message displayed over the UART.
+ * Length of a string, without its terminating NUL.
  *****************************************************************************/
-uint8_t interrupt_message[] = "\r\r\n\r\n\n Both MSYS external interrupt 1 and \
-MSYS external interrupt 2 occurred. \n\r";
+#define STR_LEN(s)          (sizeof(s) - 1u)
+
+/******************************************************************************
+ * Enable or disable the MSYS external interrupt 1, which is connected to the
+ * UART_TXRDY pin of CoreUARTapb. Called by the driver, which enables the
+ * interrupt when data is queued in the transmit ring and disables it when the
+ * ring is empty.
+ *****************************************************************************/
+static void uart_tx_irq_control(UART_instance_t * this_uart, uint8_t enable)
+{
+    (void)this_uart;
+
+    if(enable)
+    {
+        MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    }
+    else
+    {
+        MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    }
+}
+
+#ifdef COREUARTAPB1_BASE_ADDR
+/******************************************************************************
+ * Enable or disable the MSYS external interrupt 3, which is connected to the
+ * UART_TXRDY pin of the second CoreUARTapb.
+ *****************************************************************************/
+static void uart1_tx_irq_control(UART_instance_t * this_uart, uint8_t enable)
+{
+    (void)this_uart;
+
+    if(enable)
+    {
+        MRV_enable_local_irq(MRV32_MSYS_EIE3_IRQn);
+    }
+    else
+    {
+        MRV_disable_local_irq(MRV32_MSYS_EIE3_IRQn);
+    }
+}
+#endif
+
+/******************************************************************************
+ * Called from UART_tx_isr() once the transmit ring is empty.
+ *****************************************************************************/
+static void uart_tx_complete(UART_instance_t * this_uart)
+{
+    (void)this_uart;
+
+    g_tx_complete_count++;
+}
+
+/******************************************************************************
+ * Called from UART_rx_isr() or UART_rx_idle_check() when a frame has been
+ * received. The frame is logged on the "rx" channel and left in the receive
+ * ring for the main loop, which echoes it back: the main loop also sends the
+ * log messages, and UART_send_async() must only be called from one context.
+ * Both handlers run from interrupts of the same priority, so they never
+ * interrupt each other while writing the channel.
+ *****************************************************************************/
+static void uart_rx_frame(UART_instance_t * this_uart, uint8_t events)
+{
+    g_rx_frame_count++;
+
+    UART_LOG_INFO( &g_rx_log, "frame of %u bytes, ended on %s",
+                   (unsigned)UART_get_rx_pending( this_uart ),
+                   (events & UART_RX_EVENT_DELIMITER) ? "delimiter" :
+                   (events & UART_RX_EVENT_COUNT) ? "count" : "idle line" );
+
+    g_rx_frame_pending = 1u;
+}
+
+/******************************************************************************
+ * Echo the received frames back through the transmit ring, without waiting
+ * for the transmitter. Called from the main loop.
+ *****************************************************************************/
+static void echo_rx_frames(void)
+{
+    /* Cleared first, so that a frame received meanwhile is not missed. */
+    g_rx_frame_pending = 0u;
+
+    rx_size = UART_read_rx_ring( &g_uart, rx_data, sizeof(rx_data) );
+    if(rx_size > NULL)
+    {
+        UART_send_async( &g_uart, rx_data, rx_size );
+        UART_send_async( &g_uart, (const uint8_t *)"\r\n", 2u );
+    }
+}
 
 /******************************************************************************
  * Interrupt Service Routine (ISR) for the MSYS external interrupt 2,
- * which is connected to UART_RXRDY pin of CoreUARTapb
+ * which is connected to UART_RXRDY pin of CoreUARTapb. It drains the receiver
+ * into the receive ring.
  *****************************************************************************/
 void MSYS_EI2_IRQHandler(void)
 {
-    rx_size = UART_get_rx( &g_uart, rx_data, sizeof(rx_data) );
+    UART_rx_isr( &g_uart );
+}
+
+/******************************************************************************
+ * SysTick interrupt handler, raising the idle line event of the receive ring.
+ *****************************************************************************/
+void SysTick_Handler(void)
+{
+    UART_rx_idle_check( &g_uart );
 }
 
 /******************************************************************************
  * Interrupt Service Routine (ISR) for the MSYS external interrupt 1,
- * which is connected to UART_TXRDY pin of CoreUARTapb
+ * which is connected to UART_TXRDY pin of CoreUARTapb. It refills the
+ * transmitter from the transmit ring.
  *****************************************************************************/
 void MSYS_EI1_IRQHandler(void)
 {
-    if(rx_size > NULL)
-    {
-        UART_send( &g_uart, rx_data, rx_size );
-        rx_size--;
-        UART_polled_tx_string( &g_uart, interrupt_message );
-    }
+    UART_tx_isr( &g_uart );
 }
 
+#ifdef COREUARTAPB1_BASE_ADDR
+/******************************************************************************
+ * Interrupt Service Routine (ISR) for the MSYS external interrupt 3,
+ * which is connected to UART_TXRDY pin of the second CoreUARTapb.
+ *****************************************************************************/
+void MSYS_EI3_IRQHandler(void)
+{
+    UART_tx_isr( &g_uart1 );
+}
+#endif
+
 /******************************************************************************
  * main function.
  *****************************************************************************/
 void main( void )
 {
+    uart_rx_stats_t rx_stats;
+    mrv_deadline_t status_deadline;
+    uint8_t rx_log_outputs;
 
     /**************************************************************************
      * Initialize CoreUARTapb with its base address, baud value, and line
@@ -83,30 +242,99 @@ void main( void )
             BAUD_VALUE_115200, (DATA_8_BITS | NO_PARITY) );
 
     /**************************************************************************
-     * Send the Greeting message.
+     * Attach the transmit ring. The driver enables MSYS external interrupt 1
+     * - UART_TXRDY - through uart_tx_irq_control() when it has data to send.
      *************************************************************************/
-    UART_polled_tx_string( &g_uart, g_message );
+    UART_init_tx_ring( &g_uart, g_tx_ring, sizeof(g_tx_ring),
+                       uart_tx_irq_control );
+    UART_set_tx_complete_handler( &g_uart, uart_tx_complete );
 
     /**************************************************************************
-     * Enable MSYS external interrupt 2 - UART_RXRDY
+     * Attach the receive ring. The idle time is measured with the mcycle
+     * timebase and checked from the SysTick interrupt.
      *************************************************************************/
-    MRV_enable_local_irq(MRV32_MSYS_EIE2_IRQn);
+    UART_init_rx_ring( &g_uart, g_rx_ring, sizeof(g_rx_ring),
+                       MRV_time_now32 );
+    UART_set_rx_frame_handler( &g_uart, uart_rx_frame, RX_FRAME_COUNT,
+                               RX_FRAME_DELIMITER,
+                               (uint32_t)MRV_time_us_to_ticks(RX_IDLE_TIME_US) );
+    MRV_systick_config( SYS_CLK_FREQ / SYSTICK_RATE_HZ );
+
+    /**************************************************************************
+     * Route the "app" channel to the first UART, and the "rx" channel to the
+     * second UART when there is one. The "app" channel has the higher
+     * priority: its messages are sent first when both share an output.
+     *************************************************************************/
+    rx_log_outputs = UART_LOG_OUTPUT( uart_log_add_output( &g_uart ) );
+
+#ifdef COREUARTAPB1_BASE_ADDR
+    UART_init( &g_uart1, COREUARTAPB1_BASE_ADDR,
+            BAUD_VALUE_115200, (DATA_8_BITS | NO_PARITY) );
+    UART_init_tx_ring( &g_uart1, g_tx_ring1, sizeof(g_tx_ring1),
+                       uart1_tx_irq_control );
+    rx_log_outputs = UART_LOG_OUTPUT( uart_log_add_output( &g_uart1 ) );
+#endif
+
+    uart_log_init_channel( &g_app_log, "app", g_app_log_ring,
+                           sizeof(g_app_log_ring), UART_LOG_PRIORITY_HIGH,
+                           UART_LOG_OUTPUT(0), UART_LOG_LEVEL_INFO );
+    uart_log_init_channel( &g_rx_log, "rx", g_rx_log_ring,
+                           sizeof(g_rx_log_ring), UART_LOG_PRIORITY_LOW,
+                           rx_log_outputs, UART_LOG_LEVEL_DEBUG );
 
     /**************************************************************************
-     * Enable MSYS external interrupt 1 - UART_TXRDY
+     * Queue the Greeting message. The function returns straight away, the
+     * message is transmitted from the TXRDY interrupt. It is queued before
+     * the receive interrupts are enabled, since UART_send_async() must not
+     * be called from two contexts at the same time.
      *************************************************************************/
-    MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+    UART_send_async( &g_uart, g_message, STR_LEN(g_message) );
+
+    /**************************************************************************
+     * Enable MSYS external interrupt 2 - UART_RXRDY
+     *************************************************************************/
+    MRV_enable_local_irq(MRV32_MSYS_EIE2_IRQn);
 
     /**************************************************************************
      * Enables all interrupts
      *************************************************************************/
     HAL_enable_interrupts();
+    MRV_deadline_set_ms( &status_deadline, STATUS_PERIOD_MS );
 
     /**************************************************************************
-     * Infinite Loop.
+     * Infinite Loop: echo the received frames, send the queued log messages,
+     * and log the receive statistics periodically.
      *************************************************************************/
     while(1u)
     {
-        ;
+        if(g_rx_frame_pending)
+        {
+            echo_rx_frames();
+        }
+
+        uart_log_process();
+
+        if(MRV_deadline_expired( &status_deadline ))
+        {
+            UART_get_rx_stats( &g_uart, &rx_stats );
+            UART_LOG_INFO( &g_app_log,
+                           "%u frames, %u bytes received, %u bytes dropped",
+                           (unsigned)g_rx_frame_count,
+                           (unsigned)rx_stats.received,
+                           (unsigned)rx_stats.dropped );
+            if(rx_stats.overflow_errors || rx_stats.framing_errors ||
+               rx_stats.parity_errors)
+            {
+                UART_LOG_WARN( &g_app_log,
+                               "errors: %u overflow, %u framing, %u parity",
+                               (unsigned)rx_stats.overflow_errors,
+                               (unsigned)rx_stats.framing_errors,
+                               (unsigned)rx_stats.parity_errors );
+            }
+            UART_LOG_DEBUG( &g_app_log, "log messages dropped: app %u, rx %u",
+                            (unsigned)uart_log_get_dropped( &g_app_log ),
+                            (unsigned)uart_log_get_dropped( &g_rx_log ) );
+            MRV_deadline_set_ms( &status_deadline, STATUS_PERIOD_MS );
+        }
     }
 }
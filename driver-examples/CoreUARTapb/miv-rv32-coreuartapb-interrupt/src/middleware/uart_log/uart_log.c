@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file uart_log.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Multi-channel, non-blocking logging over CoreUARTapb instances. See
+ * file "uart_log.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_hal/miv_rv32_fmt.h"
+#include "uart_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * A message is stored in the ring of its channel as one length byte followed
+ * by the message characters.
+ */
+#define LOG_HEADER_SIZE                 1u
+#define LOG_EOL_SIZE                    2u
+
+/*------------------------------------------------------------------------------
+ * State of a message being formatted into the ring of a channel. The
+ * characters are written from pos, up to end, the start of the data not yet
+ * sent, and up to limit characters.
+ */
+typedef struct
+{
+    uart_log_channel_t * p_channel;
+    uint32_t pos;
+    uint32_t end;
+    uint32_t length;
+    uint32_t limit;
+    uint8_t overflow;
+} log_writer_t;
+
+/*------------------------------------------------------------------------------
+ * Outputs, and channels sorted by decreasing priority.
+ */
+static UART_instance_t * g_outputs[UART_LOG_MAX_OUTPUTS];
+static uint32_t g_nb_outputs = 0u;
+
+static uart_log_channel_t * g_channels[UART_LOG_MAX_CHANNELS];
+static uint32_t g_nb_channels = 0u;
+
+static const char g_level_chars[] = "-EWID";
+
+/*------------------------------------------------------------------------------
+ * Sink of MRV_vfmt(), writing to the ring of the channel.
+ */
+static void log_sink(void * p_ctx, const char * p_buf, uint32_t length)
+{
+    log_writer_t * p_writer = (log_writer_t *)p_ctx;
+    uart_log_channel_t * p_channel = p_writer->p_channel;
+
+    while ((length > 0u) && (p_writer->length < p_writer->limit))
+    {
+        if (p_writer->pos == p_writer->end)
+        {
+            p_writer->overflow = 1u;
+            return;
+        }
+
+        p_channel->ring[p_writer->pos & p_channel->ring_mask] = (uint8_t)*p_buf;
+        p_writer->pos++;
+        p_writer->length++;
+        p_buf++;
+        length--;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Check that all the outputs in the mask have room for a message.
+ */
+static uint8_t log_outputs_ready(uint8_t outputs, uint32_t length)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < g_nb_outputs; idx++)
+    {
+        if ((0u != (outputs & UART_LOG_OUTPUT(idx))) &&
+            (UART_get_tx_free(g_outputs[idx]) < length))
+        {
+            return 0u;
+        }
+    }
+
+    return 1u;
+}
+
+/*------------------------------------------------------------------------------
+ * Copy a message to the transmit rings of the outputs of its channel, in two
+ * parts when it wraps around the end of the channel ring.
+ */
+static void
+log_send
+(
+    const uart_log_channel_t * p_channel,
+    uint32_t start,
+    uint32_t length
+)
+{
+    uint32_t offset = start & p_channel->ring_mask;
+    uint32_t first = (p_channel->ring_mask + 1u) - offset;
+    uint32_t idx;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    for (idx = 0u; idx < g_nb_outputs; idx++)
+    {
+        if (0u != (p_channel->outputs & UART_LOG_OUTPUT(idx)))
+        {
+            (void)UART_send_async(g_outputs[idx], &p_channel->ring[offset],
+                                  first);
+            if (length > first)
+            {
+                (void)UART_send_async(g_outputs[idx], p_channel->ring,
+                                      length - first);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ * uart_log_add_output()
+ * See "uart_log.h" for details of how to use this function.
+ */
+int uart_log_add_output(UART_instance_t * p_uart)
+{
+    if ((0 == p_uart) || (g_nb_outputs >= UART_LOG_MAX_OUTPUTS))
+    {
+        return -1;
+    }
+
+    g_outputs[g_nb_outputs] = p_uart;
+    g_nb_outputs++;
+
+    return (int)g_nb_outputs - 1;
+}
+
+/***************************************************************************//**
+ * uart_log_init_channel()
+ * See "uart_log.h" for details of how to use this function.
+ */
+int
+uart_log_init_channel
+(
+    uart_log_channel_t * p_channel,
+    const char * name,
+    uint8_t * p_ring,
+    uint32_t ring_size,
+    uint8_t priority,
+    uint8_t outputs,
+    uint8_t level
+)
+{
+    uint32_t idx;
+
+    if ((0 == p_channel) || (0 == p_ring) ||
+        (ring_size < (LOG_HEADER_SIZE + UART_LOG_MAX_MESSAGE)) ||
+        (0u != (ring_size & (ring_size - 1u))) ||
+        (g_nb_channels >= UART_LOG_MAX_CHANNELS))
+    {
+        return -1;
+    }
+
+    p_channel->name = (0 != name) ? name : "";
+    p_channel->ring = p_ring;
+    p_channel->ring_mask = ring_size - 1u;
+    p_channel->head = 0u;
+    p_channel->tail = 0u;
+    p_channel->priority = priority;
+    p_channel->outputs = outputs;
+    p_channel->level = level;
+    p_channel->written = 0u;
+    p_channel->dropped = 0u;
+
+    /* Insert after the channels of the same or a higher priority. */
+    idx = g_nb_channels;
+    while ((idx > 0u) && (g_channels[idx - 1u]->priority < priority))
+    {
+        g_channels[idx] = g_channels[idx - 1u];
+        idx--;
+    }
+    g_channels[idx] = p_channel;
+    g_nb_channels++;
+
+    return 0;
+}
+
+/***************************************************************************//**
+ * uart_log_set_level()
+ * See "uart_log.h" for details of how to use this function.
+ */
+void uart_log_set_level(uart_log_channel_t * p_channel, uint8_t level)
+{
+    p_channel->level = level;
+}
+
+/***************************************************************************//**
+ * uart_log_vwrite()
+ * See "uart_log.h" for details of how to use this function.
+ */
+uint8_t
+uart_log_vwrite
+(
+    uart_log_channel_t * p_channel,
+    uint8_t level,
+    const char * p_format,
+    va_list args
+)
+{
+    log_writer_t writer;
+    uint32_t head;
+
+    if ((level > p_channel->level) || (level > UART_LOG_LEVEL_DEBUG))
+    {
+        return 0u;
+    }
+
+    head = p_channel->head;
+
+    writer.p_channel = p_channel;
+    writer.pos = head + LOG_HEADER_SIZE;
+    writer.end = p_channel->tail + p_channel->ring_mask + 1u;
+    writer.length = 0u;
+    writer.limit = UART_LOG_MAX_MESSAGE - LOG_EOL_SIZE;
+    writer.overflow = ((writer.end - head) < LOG_HEADER_SIZE) ? 1u : 0u;
+
+    if (0u == writer.overflow)
+    {
+        (void)MRV_fmt(log_sink, &writer, "%c %s: ",
+                      g_level_chars[level], p_channel->name);
+        (void)MRV_vfmt(log_sink, &writer, p_format, args);
+
+        /* The end of line is kept when the message is truncated. */
+        writer.limit = UART_LOG_MAX_MESSAGE;
+        log_sink(&writer, "\r\n", LOG_EOL_SIZE);
+    }
+
+    if (0u != writer.overflow)
+    {
+        p_channel->dropped++;
+        return 0u;
+    }
+
+    p_channel->ring[head & p_channel->ring_mask] = (uint8_t)writer.length;
+
+    /* Publish the message once it is complete. */
+    p_channel->head = writer.pos;
+    p_channel->written++;
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * uart_log_write()
+ * See "uart_log.h" for details of how to use this function.
+ */
+uint8_t
+uart_log_write
+(
+    uart_log_channel_t * p_channel,
+    uint8_t level,
+    const char * p_format,
+    ...
+)
+{
+    va_list args;
+    uint8_t queued;
+
+    va_start(args, p_format);
+    queued = uart_log_vwrite(p_channel, level, p_format, args);
+    va_end(args);
+
+    return queued;
+}
+
+/***************************************************************************//**
+ * uart_log_process()
+ * See "uart_log.h" for details of how to use this function.
+ */
+void uart_log_process(void)
+{
+    uint8_t blocked = 0u;
+    uint32_t idx;
+
+    for (idx = 0u; idx < g_nb_channels; idx++)
+    {
+        uart_log_channel_t * p_channel = g_channels[idx];
+
+        /*
+         * A channel is not sent to an output on which a channel of a higher
+         * priority still has messages waiting.
+         */
+        while ((0u == (p_channel->outputs & blocked)) &&
+               (p_channel->tail != p_channel->head))
+        {
+            uint32_t tail = p_channel->tail;
+            uint32_t length = p_channel->ring[tail & p_channel->ring_mask];
+
+            if (!log_outputs_ready(p_channel->outputs, length))
+            {
+                break;
+            }
+
+            log_send(p_channel, tail + LOG_HEADER_SIZE, length);
+            p_channel->tail = tail + LOG_HEADER_SIZE + length;
+        }
+
+        if (p_channel->tail != p_channel->head)
+        {
+            blocked |= p_channel->outputs;
+        }
+    }
+}
+
+/***************************************************************************//**
+ * uart_log_get_dropped()
+ * See "uart_log.h" for details of how to use this function.
+ */
+uint32_t uart_log_get_dropped(const uart_log_channel_t * p_channel)
+{
+    return p_channel->dropped;
+}
+
+/***************************************************************************//**
+ * uart_log_get_pending()
+ * See "uart_log.h" for details of how to use this function.
+ */
+uint32_t uart_log_get_pending(const uart_log_channel_t * p_channel)
+{
+    return p_channel->head - p_channel->tail;
+}
+
+#ifdef __cplusplus
+}
+#endif
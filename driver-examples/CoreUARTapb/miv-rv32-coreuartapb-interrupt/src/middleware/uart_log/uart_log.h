@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file uart_log.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Multi-channel, non-blocking logging over CoreUARTapb instances.
+ *
+ */
+
+/*=========================================================================*//**
+  UART Log
+  =======================================
+  Diagnostic messages printed with UART_polled_tx_string() stall the caller
+  for the whole transmission, close to 90 microseconds per character at
+  115200 baud, and messages from different parts of the application share the
+  same UART.
+
+  With this module, messages are written to channels. Each channel has:
+    - a name, printed in front of each message,
+    - a ring buffer holding the formatted messages until they are sent,
+    - a run-time level: messages less severe than the level are discarded,
+    - a priority, setting the order in which channels are sent,
+    - the set of UART outputs its messages are sent to.
+
+  uart_log_write(), or the UART_LOG_xxx() macros, format the message with
+  MRV_vfmt() directly into the ring of the channel, followed by "\r\n", and
+  return. They never wait: when the ring does not have room for the whole
+  message, the message is dropped and the drop counter of the channel is
+  incremented.
+
+  uart_log_process(), called from the main loop or from a low priority task,
+  moves complete messages from the channel rings to the transmit rings of
+  the UART outputs with UART_send_async(). Higher priority channels are sent
+  first, and a message is only moved when all the outputs of its channel have
+  room for it, so messages are never interleaved on an output and a lower
+  priority channel does not overtake a higher priority one waiting for the
+  same output.
+
+  --------------------------------
+  Compile-time filtering
+  --------------------------------
+  The UART_LOG_ERROR(), UART_LOG_WARN(), UART_LOG_INFO() and UART_LOG_DEBUG()
+  macros expand to nothing when their level is above UART_LOG_LEVEL_MAX,
+  which is UART_LOG_LEVEL_INFO by default. The arguments are then not
+  evaluated and no code is generated, so debug messages can stay in
+  time-critical code:
+
+      UART_LOG_DEBUG(&g_isr_log, "frame %u bytes", size);
+
+  Define UART_LOG_LEVEL_MAX in the compiler settings, for example to
+  UART_LOG_LEVEL_DEBUG, to build them in.
+
+  --------------------------------
+  Example
+  --------------------------------
+      static uint8_t g_app_ring[1024];
+      static uart_log_channel_t g_app_log;
+
+      uart_log_add_output(&g_uart);
+      uart_log_init_channel(&g_app_log, "app", g_app_ring, sizeof(g_app_ring),
+                            UART_LOG_PRIORITY_HIGH, UART_LOG_OUTPUT(0),
+                            UART_LOG_LEVEL_INFO);
+
+      UART_LOG_INFO(&g_app_log, "link up, %u Mbps", speed);
+
+      while (1)
+      {
+          uart_log_process();
+      }
+
+  The UART outputs must have a transmit ring, attached with
+  UART_init_tx_ring(), at least UART_LOG_MAX_MESSAGE bytes long.
+
+  A channel must only be written from one context at a time: use a separate
+  channel for each interrupt handler or task which logs messages.
+  uart_log_process() must only be called from one context.
+
+ *//*=========================================================================*/
+#ifndef UART_LOG_H
+#define UART_LOG_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Log Levels
+  ==========
+  | Constant              | Description                                     |
+  |-----------------------|-------------------------------------------------|
+  | UART_LOG_LEVEL_NONE   | Channel level: discard all messages             |
+  | UART_LOG_LEVEL_ERROR  | Errors                                          |
+  | UART_LOG_LEVEL_WARN   | Warnings                                        |
+  | UART_LOG_LEVEL_INFO   | Information                                     |
+  | UART_LOG_LEVEL_DEBUG  | Debug messages                                  |
+ */
+#define UART_LOG_LEVEL_NONE             0u
+#define UART_LOG_LEVEL_ERROR            1u
+#define UART_LOG_LEVEL_WARN             2u
+#define UART_LOG_LEVEL_INFO             3u
+#define UART_LOG_LEVEL_DEBUG            4u
+
+/*
+ * Highest level built in the application.
+ */
+#ifndef UART_LOG_LEVEL_MAX
+#define UART_LOG_LEVEL_MAX              UART_LOG_LEVEL_INFO
+#endif
+
+/*
+ * Maximum number of UART outputs and of channels.
+ */
+#ifndef UART_LOG_MAX_OUTPUTS
+#define UART_LOG_MAX_OUTPUTS            4u
+#endif
+
+#ifndef UART_LOG_MAX_CHANNELS
+#define UART_LOG_MAX_CHANNELS           8u
+#endif
+
+/*
+ * Maximum length of a message, including the level, the channel name and the
+ * end of line, up to 255. Longer messages are truncated.
+ */
+#ifndef UART_LOG_MAX_MESSAGE
+#define UART_LOG_MAX_MESSAGE            128u
+#endif
+
+#if UART_LOG_MAX_MESSAGE > 255
+#error UART_LOG_MAX_MESSAGE must not be greater than 255
+#endif
+
+/***************************************************************************//**
+  Channel priorities. Any value can be used: channels with a higher value are
+  sent first.
+ */
+#define UART_LOG_PRIORITY_LOW           0u
+#define UART_LOG_PRIORITY_NORMAL        1u
+#define UART_LOG_PRIORITY_HIGH          2u
+
+/***************************************************************************//**
+  Bit mask selecting the output of index n, as returned by
+  uart_log_add_output(). Outputs are combined with |.
+ */
+#define UART_LOG_OUTPUT(n)              ((uint8_t)(1u << (n)))
+
+/***************************************************************************//**
+  The uart_log_channel_t structure holds the state of a channel. Its content
+  is managed by the functions of this module.
+ */
+typedef struct
+{
+    const char * name;
+    uint8_t * ring;
+    uint32_t ring_mask;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint8_t priority;
+    uint8_t outputs;
+    uint8_t level;
+    volatile uint32_t written;
+    volatile uint32_t dropped;
+} uart_log_channel_t;
+
+/***************************************************************************//**
+  The uart_log_add_output() function adds a UART to the outputs channels can
+  be routed to.
+
+  @param p_uart
+  UART instance, with a transmit ring attached.
+
+  @return
+  This function returns the index of the output, to use with
+  UART_LOG_OUTPUT(), or -1 when UART_LOG_MAX_OUTPUTS outputs were added
+  already.
+ */
+int uart_log_add_output(UART_instance_t * p_uart);
+
+/***************************************************************************//**
+  The uart_log_init_channel() function initializes a channel and adds it to
+  the channels sent by uart_log_process().
+
+  @param p_channel
+  Channel to initialize.
+
+  @param name
+  Name printed in front of the messages of the channel.
+
+  @param p_ring
+  Memory used for the ring buffer of the channel.
+
+  @param ring_size
+  Size of the ring buffer in bytes. It must be a power of two.
+
+  @param priority
+  Priority of the channel, for example UART_LOG_PRIORITY_HIGH.
+
+  @param outputs
+  Outputs the messages are sent to, a combination of UART_LOG_OUTPUT() masks.
+
+  @param level
+  Run-time level of the channel.
+
+  @return
+  This function returns 0 on success, or -1 when the parameters are invalid
+  or UART_LOG_MAX_CHANNELS channels were initialized already.
+ */
+int
+uart_log_init_channel
+(
+    uart_log_channel_t * p_channel,
+    const char * name,
+    uint8_t * p_ring,
+    uint32_t ring_size,
+    uint8_t priority,
+    uint8_t outputs,
+    uint8_t level
+);
+
+/***************************************************************************//**
+  The uart_log_set_level() function changes the run-time level of a channel.
+ */
+void uart_log_set_level(uart_log_channel_t * p_channel, uint8_t level);
+
+/***************************************************************************//**
+  The uart_log_write() function formats a message into the ring of a channel.
+  See miv_rv32_fmt.h for the supported conversions.
+
+  @param p_channel
+  Channel to write to.
+
+  @param level
+  Level of the message. The message is discarded when it is higher than the
+  level of the channel.
+
+  @param p_format
+  Format string.
+
+  @return
+  This function returns 1 when the message was queued, 0 when it was
+  discarded by the level or dropped because the ring was full.
+ */
+uint8_t
+uart_log_write
+(
+    uart_log_channel_t * p_channel,
+    uint8_t level,
+    const char * p_format,
+    ...
+);
+
+/***************************************************************************//**
+  The uart_log_vwrite() function is the version of uart_log_write() taking its
+  arguments as a va_list.
+ */
+uint8_t
+uart_log_vwrite
+(
+    uart_log_channel_t * p_channel,
+    uint8_t level,
+    const char * p_format,
+    va_list args
+);
+
+/***************************************************************************//**
+  The uart_log_process() function moves the queued messages to the transmit
+  rings of the UART outputs, by decreasing channel priority, for as long as
+  the outputs have room. It does not wait.
+ */
+void uart_log_process(void);
+
+/***************************************************************************//**
+  The uart_log_get_dropped() function returns the number of messages of a
+  channel dropped because its ring was full.
+ */
+uint32_t uart_log_get_dropped(const uart_log_channel_t * p_channel);
+
+/***************************************************************************//**
+  The uart_log_get_pending() function returns the number of bytes queued in
+  the ring of a channel.
+ */
+uint32_t uart_log_get_pending(const uart_log_channel_t * p_channel);
+
+/*------------------------------------------------------------------------------
+ * Logging macros, removed at compile time above UART_LOG_LEVEL_MAX.
+ */
+#if UART_LOG_LEVEL_MAX >= UART_LOG_LEVEL_ERROR
+#define UART_LOG_ERROR(p_channel, ...) \
+    ((void)uart_log_write((p_channel), UART_LOG_LEVEL_ERROR, __VA_ARGS__))
+#else
+#define UART_LOG_ERROR(p_channel, ...)  ((void)0)
+#endif
+
+#if UART_LOG_LEVEL_MAX >= UART_LOG_LEVEL_WARN
+#define UART_LOG_WARN(p_channel, ...) \
+    ((void)uart_log_write((p_channel), UART_LOG_LEVEL_WARN, __VA_ARGS__))
+#else
+#define UART_LOG_WARN(p_channel, ...)   ((void)0)
+#endif
+
+#if UART_LOG_LEVEL_MAX >= UART_LOG_LEVEL_INFO
+#define UART_LOG_INFO(p_channel, ...) \
+    ((void)uart_log_write((p_channel), UART_LOG_LEVEL_INFO, __VA_ARGS__))
+#else
+#define UART_LOG_INFO(p_channel, ...)   ((void)0)
+#endif
+
+#if UART_LOG_LEVEL_MAX >= UART_LOG_LEVEL_DEBUG
+#define UART_LOG_DEBUG(p_channel, ...) \
+    ((void)uart_log_write((p_channel), UART_LOG_LEVEL_DEBUG, __VA_ARGS__))
+#else
+#define UART_LOG_DEBUG(p_channel, ...)  ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* UART_LOG_H */
@@ -96,6 +96,101 @@
   The UART_get_rx_status() function returns the error status of the CoreUARTapb
   receiver. This is used by applications to take appropriate action in case of
   receiver errors.
+
+  @section tx_ring Interrupt-Driven Transmit Ring
+  UART_send() and UART_polled_tx_string() wait on the TXRDY status bit for
+  every character, so the processor is busy for the whole duration of the
+  transmission: close to 90 microseconds per character at 115200 baud.
+
+  The UART_init_tx_ring() function attaches a ring buffer to a CoreUARTapb
+  instance. UART_send_async() then copies the data to the ring and returns
+  immediately. The UART_tx_isr() function, called from the interrupt handler of
+  the processor interrupt connected to the TXRDY output of CoreUARTapb, writes
+  the ring content to the transmitter for as long as TXRDY is set, so that the
+  transmit FIFO is filled completely on each interrupt when FIFO mode is
+  enabled. A handler registered with UART_set_tx_complete_handler() is called
+  once the ring is empty.
+
+  TXRDY is a level signal which stays set while the transmitter has room, and
+  CoreUARTapb provides no register to mask it. The application therefore
+  provides a function enabling and disabling the TXRDY interrupt at the
+  processor or interrupt controller level: the driver enables the interrupt
+  when data is queued and disables it when the ring is empty.
+
+      static void uart_tx_irq_control(UART_instance_t * this_uart, uint8_t enable)
+      {
+          if (enable)
+          {
+              MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+          }
+          else
+          {
+              MRV_disable_local_irq(MRV32_MSYS_EIE1_IRQn);
+          }
+      }
+
+      void MSYS_EI1_IRQHandler(void)
+      {
+          UART_tx_isr(&g_uart);
+      }
+
+  The same function can call PLIC_EnableIRQ() and PLIC_DisableIRQ() when the
+  TXRDY output is routed through the PLIC, and the transmit ring works the same
+  way under FreeRTOS: a task can wait on a semaphore given by the
+  transmit-complete handler. UART_send_async() must only be called from one
+  context at a time; tasks sharing a UART must serialize their calls, for
+  example with a mutex.
+
+  @section rx_ring Interrupt-Driven Receive Ring
+  UART_get_rx() must be polled, reads the STATUS register twice per character
+  and only reports receive errors after the fact, through the sticky status
+  returned by UART_get_rx_status(). A protocol receiving frames, such as YMODEM
+  or a command shell, then has to busy-poll the UART to avoid losing
+  characters.
+
+  The UART_init_rx_ring() function attaches a receive ring buffer to a
+  CoreUARTapb instance. The UART_rx_isr() function, called from the interrupt
+  handler of the processor interrupt connected to the RXRDY output of
+  CoreUARTapb, drains the receiver, and its FIFO when present, into the ring.
+  It reads STATUS once per character and counts the parity, overflow and
+  framing errors, as well as the characters dropped because the ring was full.
+  The application reads the ring with UART_read_rx_ring().
+
+  A frame handler registered with UART_set_rx_frame_handler() is called, in
+  interrupt context, when one of the following events occurs:
+    - UART_RX_EVENT_COUNT: a number of characters was received since the
+      previous event,
+    - UART_RX_EVENT_DELIMITER: the delimiter character, for example '\r', was
+      received,
+    - UART_RX_EVENT_IDLE: no character was received for the idle time after
+      the last one, which usually marks the end of a frame.
+
+  Each event covers the characters received since the previous one. The idle
+  time is measured with a time function supplied by the application, for
+  example MRV_time_now32() from miv_rv32_time.h. Since no RXRDY interrupt
+  occurs once the line is idle, UART_rx_idle_check() must be called
+  periodically, for example from the SysTick handler, to raise the idle
+  event:
+
+      static uint8_t g_rx_ring[256];
+
+      UART_init_rx_ring(&g_uart, g_rx_ring, sizeof(g_rx_ring), MRV_time_now32);
+      UART_set_rx_frame_handler(&g_uart, uart_rx_frame, 64u, '\r',
+                                MRV_time_us_to_ticks(2000u));
+
+      void MSYS_EI2_IRQHandler(void)
+      {
+          UART_rx_isr(&g_uart);
+      }
+
+      void SysTick_Handler(void)
+      {
+          UART_rx_idle_check(&g_uart);
+      }
+
+  UART_rx_isr() and UART_rx_idle_check() must not interrupt each other; give
+  their interrupts the same priority when the interrupt controller supports
+  nesting.
 *//*=========================================================================*/
 #ifndef __CORE_UART_APB_H
 #define __CORE_UART_APB_H 1
@@ -156,17 +251,104 @@ extern "C" {
 #define UART_APB_NO_ERROR        0x00u
 #define UART_APB_INVALID_PARAM   0xFFu
 
+struct uart_instance;
+
+/***************************************************************************//**
+ * The uart_irq_control_t type is the prototype of the application function
+ * enabling (enable = 1) or disabling (enable = 0) the processor interrupt
+ * connected to the TXRDY output of a CoreUARTapb instance.
+ */
+typedef void (*uart_irq_control_t)(struct uart_instance * this_uart,
+                                   uint8_t enable);
+
+/***************************************************************************//**
+ * The uart_tx_handler_t type is the prototype of the transmit-complete
+ * handler, called from UART_tx_isr() when the transmit ring becomes empty.
+ */
+typedef void (*uart_tx_handler_t)(struct uart_instance * this_uart);
+
+/***************************************************************************//**
+  Receive Frame Events
+  ====================
+  These constants are the events passed to the receive frame handler. Several
+  events can be combined in one call.
+  | Constant                | Description                                   |
+  |-------------------------|-----------------------------------------------|
+  | UART_RX_EVENT_COUNT     | Frame character count reached                 |
+  | UART_RX_EVENT_DELIMITER | Delimiter character received                  |
+  | UART_RX_EVENT_IDLE      | Line idle after the last character received   |
+ */
+#define UART_RX_EVENT_COUNT         0x01u
+#define UART_RX_EVENT_DELIMITER     0x02u
+#define UART_RX_EVENT_IDLE          0x04u
+
+/***************************************************************************//**
+  The UART_RX_NO_DELIMITER constant disables the delimiter event when passed
+  as the delimiter parameter of UART_set_rx_frame_handler().
+ */
+#define UART_RX_NO_DELIMITER        (-1)
+
+/***************************************************************************//**
+ * The uart_rx_handler_t type is the prototype of the receive frame handler,
+ * called from UART_rx_isr() or UART_rx_idle_check(). The events parameter is a
+ * combination of the UART_RX_EVENT_xxx constants.
+ */
+typedef void (*uart_rx_handler_t)(struct uart_instance * this_uart,
+                                  uint8_t events);
+
+/***************************************************************************//**
+ * The uart_time_t type is the prototype of the application function returning
+ * the current time, in ticks of a free-running 32 bit counter, used to detect
+ * the idle line.
+ */
+typedef uint32_t (*uart_time_t)(void);
+
+/***************************************************************************//**
+ * The uart_rx_stats_t structure holds the receive counters returned by
+ * UART_get_rx_stats().
+ */
+typedef struct
+{
+    uint32_t received;          /* characters stored in the receive ring */
+    uint32_t dropped;           /* characters lost because the ring was full */
+    uint32_t overflow_errors;   /* characters lost by the receiver */
+    uint32_t framing_errors;
+    uint32_t parity_errors;
+} uart_rx_stats_t;
+
 /***************************************************************************//**  
  * There should be one instance of this structure for each instance of 
  * CoreUARTapb in your system. This structure instance identifies various UARTs
  * in a system and should be passed as first parameter to UART functions to
  * identify which UART performs the requested operation. The 'status' element in
- * the structure is used to provide sticky status information. 
+ * the structure is used to provide sticky status information. The tx_xxx and
+ * rx_xxx elements hold the state of the interrupt-driven transmit and receive
+ * rings.
  */
-typedef struct 
+typedef struct uart_instance
 {
     addr_t      base_address;
     uint8_t     status;
+
+    uint8_t *   tx_ring;
+    uint32_t    tx_ring_mask;
+    volatile uint32_t tx_head;
+    volatile uint32_t tx_tail;
+    uart_irq_control_t tx_irq_control;
+    uart_tx_handler_t tx_complete_handler;
+
+    uint8_t *   rx_ring;
+    uint32_t    rx_ring_mask;
+    volatile uint32_t rx_head;
+    volatile uint32_t rx_tail;
+    uart_time_t rx_get_time;
+    uart_rx_handler_t rx_frame_handler;
+    uint32_t    rx_frame_count;
+    int16_t     rx_delimiter;
+    uint32_t    rx_idle_ticks;
+    volatile uint32_t rx_frame_size;
+    volatile uint32_t rx_last_time;
+    uart_rx_stats_t rx_stats;
 } UART_instance_t;
 
 /***************************************************************************//**
@@ -444,6 +626,284 @@ UART_get_rx_status
     UART_instance_t * this_uart
 );
 
+/***************************************************************************//**
+ * The UART_init_tx_ring() function attaches a transmit ring buffer to a
+ * CoreUARTapb instance, for use by UART_send_async() and UART_tx_isr(). It must
+ * be called after UART_init().
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_ring        The p_ring parameter is a pointer to the memory used
+ *                      for the ring buffer. It must remain allocated for as
+ *                      long as the ring is used.
+ * @param ring_size     The ring_size parameter is the size of the ring buffer
+ *                      in bytes. It must be a power of two.
+ * @param irq_control   The irq_control parameter is a pointer to the
+ *                      application function enabling and disabling the TXRDY
+ *                      interrupt. The interrupt is disabled by this function.
+ * @return              This function does not return a value.
+ *
+ * @example
+ * @code
+ *   static uint8_t g_tx_ring[512];
+ *
+ *   UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, BAUD_VALUE_115200,
+ *             (DATA_8_BITS | NO_PARITY));
+ *   UART_init_tx_ring(&g_uart, g_tx_ring, sizeof(g_tx_ring),
+ *                     uart_tx_irq_control);
+ * @endcode
+ */
+void
+UART_init_tx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_irq_control_t irq_control
+);
+
+/***************************************************************************//**
+ * The UART_send_async() function copies data to the transmit ring and enables
+ * the TXRDY interrupt. It returns without waiting for the data to be
+ * transmitted. The memory of tx_buffer can be reused as soon as the function
+ * returns.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param tx_buffer     The tx_buffer parameter is a pointer to a buffer that
+ *                      contains the data to be transmitted.
+ * @param tx_size       The tx_size parameter is the size in bytes of the
+ *                      data to transmit.
+ * @return              This function returns the number of bytes copied to the
+ *                      transmit ring. It is lower than tx_size when the ring
+ *                      does not have enough free space; the remaining data can
+ *                      be sent later.
+ */
+size_t
+UART_send_async
+(
+    UART_instance_t * this_uart,
+    const uint8_t * tx_buffer,
+    size_t tx_size
+);
+
+/***************************************************************************//**
+ * The UART_get_tx_pending() function returns the number of bytes in the
+ * transmit ring which have not been written to the transmitter yet.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the number of pending bytes.
+ */
+size_t
+UART_get_tx_pending
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_get_tx_free() function returns the number of bytes which can be
+ * copied to the transmit ring by UART_send_async() without being truncated.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the free space of the transmit
+ *                      ring in bytes, or 0 when no ring is attached.
+ */
+size_t
+UART_get_tx_free
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_set_tx_complete_handler() function registers a function called by
+ * UART_tx_isr(), in interrupt context, when the last byte of the transmit ring
+ * has been written to the transmitter.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param handler       The handler parameter is a pointer to the function to
+ *                      call, or 0 to remove the handler.
+ * @return              This function does not return a value.
+ */
+void
+UART_set_tx_complete_handler
+(
+    UART_instance_t * this_uart,
+    uart_tx_handler_t handler
+);
+
+/***************************************************************************//**
+ * The UART_tx_isr() function must be called from the interrupt handler of the
+ * processor interrupt connected to the TXRDY output of the CoreUARTapb
+ * instance. It moves data from the transmit ring to the transmitter for as
+ * long as TXRDY is set. When the ring is empty, it disables the TXRDY
+ * interrupt and calls the transmit-complete handler.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_tx_isr
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_init_rx_ring() function attaches a receive ring buffer to a
+ * CoreUARTapb instance, for use by UART_rx_isr(), and clears the receive
+ * counters. It must be called after UART_init() and before the RXRDY
+ * interrupt is enabled.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_ring        The p_ring parameter is a pointer to the memory used
+ *                      for the ring buffer. It must remain allocated for as
+ *                      long as the ring is used.
+ * @param ring_size     The ring_size parameter is the size of the ring buffer
+ *                      in bytes. It must be a power of two.
+ * @param get_time      The get_time parameter is a pointer to the application
+ *                      function returning the current time, used for the idle
+ *                      event. It can be 0 when the idle event is not used.
+ * @return              This function does not return a value.
+ */
+void
+UART_init_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * p_ring,
+    size_t ring_size,
+    uart_time_t get_time
+);
+
+/***************************************************************************//**
+ * The UART_set_rx_frame_handler() function registers the receive frame handler
+ * and the events for which it is called.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param handler       The handler parameter is a pointer to the function to
+ *                      call, or 0 to remove the handler.
+ * @param frame_count   The frame_count parameter is the number of characters
+ *                      raising UART_RX_EVENT_COUNT, or 0 to disable the event.
+ * @param delimiter     The delimiter parameter is the character raising
+ *                      UART_RX_EVENT_DELIMITER, or UART_RX_NO_DELIMITER.
+ * @param idle_ticks    The idle_ticks parameter is the time without character,
+ *                      in ticks of the time function passed to
+ *                      UART_init_rx_ring(), raising UART_RX_EVENT_IDLE, or 0 to
+ *                      disable the event.
+ * @return              This function does not return a value.
+ */
+void
+UART_set_rx_frame_handler
+(
+    UART_instance_t * this_uart,
+    uart_rx_handler_t handler,
+    uint32_t frame_count,
+    int16_t delimiter,
+    uint32_t idle_ticks
+);
+
+/***************************************************************************//**
+ * The UART_read_rx_ring() function copies received data from the receive ring
+ * to a buffer and removes it from the ring.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param rx_buffer     The rx_buffer parameter is a pointer to the buffer
+ *                      receiving the data.
+ * @param buff_size     The buff_size parameter is the size of the buffer in
+ *                      bytes.
+ * @return              This function returns the number of bytes copied, which
+ *                      is 0 when the ring is empty.
+ */
+size_t
+UART_read_rx_ring
+(
+    UART_instance_t * this_uart,
+    uint8_t * rx_buffer,
+    size_t buff_size
+);
+
+/***************************************************************************//**
+ * The UART_get_rx_pending() function returns the number of bytes in the
+ * receive ring which have not been read yet.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function returns the number of pending bytes.
+ */
+size_t
+UART_get_rx_pending
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_get_rx_stats() function returns the receive counters of a
+ * CoreUARTapb instance. The counters are cleared by UART_init_rx_ring() only.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @param p_stats       The p_stats parameter is a pointer to the structure
+ *                      receiving the counters.
+ * @return              This function does not return a value.
+ */
+void
+UART_get_rx_stats
+(
+    UART_instance_t * this_uart,
+    uart_rx_stats_t * p_stats
+);
+
+/***************************************************************************//**
+ * The UART_rx_isr() function must be called from the interrupt handler of the
+ * processor interrupt connected to the RXRDY output of the CoreUARTapb
+ * instance. It moves the received characters to the receive ring, counts the
+ * receive errors and calls the frame handler on the count and delimiter
+ * events.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_rx_isr
+(
+    UART_instance_t * this_uart
+);
+
+/***************************************************************************//**
+ * The UART_rx_idle_check() function calls the frame handler with
+ * UART_RX_EVENT_IDLE when characters were received since the previous event
+ * and none for the idle time. It must be called periodically, at an interval
+ * shorter than the idle time, for the event to be raised on time.
+ *
+ * @param this_uart     The this_uart parameter is a pointer to a
+ *                      UART_instance_t structure which holds all data regarding
+ *                      this instance of the UART.
+ * @return              This function does not return a value.
+ */
+void
+UART_rx_idle_check
+(
+    UART_instance_t * this_uart
+);
+
 #ifdef __cplusplus
 }
 #endif
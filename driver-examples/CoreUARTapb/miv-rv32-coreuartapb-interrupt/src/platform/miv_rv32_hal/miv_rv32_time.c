@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_time.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief High resolution timebase, delays and deadlines for Mi-V soft
+ * processors. See file "miv_rv32_time.h" for description of the functions
+ * implemented in this file.
+ *
+ */
+#include "miv_rv32_hal.h"
+#include "miv_rv32_time.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * MRV_delay_cycles()
+ * See "miv_rv32_time.h" for details of how to use this function.
+ */
+void MRV_delay_cycles(uint32_t cycles)
+{
+    uint32_t start = MRV_time_now32();
+
+    while ((MRV_time_now32() - start) < cycles)
+    {
+        ;
+    }
+}
+
+/***************************************************************************//**
+ * MRV_delay_us()
+ * See "miv_rv32_time.h" for details of how to use this function.
+ */
+void MRV_delay_us(uint32_t us)
+{
+    mrv_deadline_t deadline;
+
+    MRV_deadline_set_us(&deadline, us);
+    while (0u == MRV_deadline_expired(&deadline))
+    {
+        ;
+    }
+}
+
+/***************************************************************************//**
+ * MRV_delay_ms()
+ * See "miv_rv32_time.h" for details of how to use this function.
+ */
+void MRV_delay_ms(uint32_t ms)
+{
+    mrv_deadline_t deadline;
+
+    MRV_deadline_set_ms(&deadline, ms);
+    while (0u == MRV_deadline_expired(&deadline))
+    {
+        ;
+    }
+}
+
+/***************************************************************************//**
+ * MRV_deadline_remaining_us()
+ * See "miv_rv32_time.h" for details of how to use this function.
+ */
+uint32_t MRV_deadline_remaining_us(const mrv_deadline_t * p_deadline)
+{
+    uint64_t now = MRV_time_now();
+    uint64_t us;
+
+    if (now >= p_deadline->expiry)
+    {
+        return 0u;
+    }
+
+    us = MRV_time_ticks_to_us(p_deadline->expiry - now);
+
+    return (us > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)us;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -35,12 +35,15 @@ miv_plic_instance_t g_plic;
 const uint8_t g_greeting_msg[] =
 "\r\n\r\n **** PolarFire MiV PLIC Example ****\n\n\n\r\
 Select 1 -> PLIC0, 2 -> PLIC1, 3 ->PLIC2, 4 ->PLIC3 interrupt\r\n\
+       5 -> PLIC0 to PLIC3 interrupts together\r\n\
+       s -> Display the PLIC dispatch statistics\r\n\
 ";
 
 const uint8_t g_separator[] =
 "\r\n----------------------------------------------------------------------\r\n";
 
 static void display_greeting(void);
+static void display_dispatch_stats(void);
 
 uint8_t data_buffer [1024];
 uint8_t input_text[506] = {0x00};
@@ -63,6 +66,30 @@ static void display_greeting(void)
     UART_polled_tx_string(&g_uart, g_greeting_msg);
 }
 
+/*==============================================================================
+ * Display the number of times each PLIC handler was called and the deepest
+ * nesting of PLIC handlers reached so far.
+ */
+static void display_dispatch_stats(void)
+{
+    uint32_t irq;
+
+    for (irq = MIV_PLIC_EXT0_IRQn; irq <= MIV_PLIC_EXT3_IRQn; irq++)
+    {
+        snprintf((char *)data_buffer, sizeof(data_buffer),
+                 "\r\nPLIC %u (priority %u): %u calls",
+                 (unsigned int)(irq - 1u),
+                 (unsigned int)MIV_PLIC_get_priority(&g_plic, (miv_plic_irq_num_t)irq),
+                 (unsigned int)MIV_PLIC_get_dispatch_count(&g_plic, (miv_plic_irq_num_t)irq));
+        UART_polled_tx_string(&g_uart, data_buffer);
+    }
+
+    snprintf((char *)data_buffer, sizeof(data_buffer),
+             "\r\nMaximum nesting depth: %u\r\n",
+             (unsigned int)MIV_PLIC_get_max_nesting(&g_plic));
+    UART_polled_tx_string(&g_uart, data_buffer);
+}
+
 /************************************************************************//***
  * In the test design the plic interrupts 0-3 are connected to GPIO 4:7
  * respectively. This application demonstrates the invoking of these plic
@@ -122,14 +149,15 @@ uint8_t ESS_PLIC_EXT7_IRQHandler(void)
 
 /**************************************************************************//**
  * PLIC interrupts are routed as external interrupt to the MIV_RV32 core from
- * MIV_ESS. The handle_plic_interrupt() is the ESS_PLIC driver function which
- * will identify the plic interrupt number and then invokes the appropriate
- * plic interrupt handler.
+ * MIV_ESS. The MIV_PLIC_nested_isr() is the MIV_PLIC driver function which
+ * will serve all the pending plic interrupts, highest priority first, and
+ * let a plic interrupt of a higher priority preempt the handler being run.
+ * Use MIV_PLIC_drain_isr() instead to serve all the pending interrupts
+ * without nesting, or MIV_PLIC_isr() to serve one interrupt per trap.
  */
 void External_IRQHandler(void)
 {
-    uint32_t reg_val = read_csr(mip);
-    MIV_PLIC_isr(&g_plic);
+    MIV_PLIC_nested_isr(&g_plic);
 }
 
 void Invalid_IRQHandler(void)
@@ -176,6 +204,13 @@ void main(void)
 
     MIV_PLIC_init(&g_plic, MIV_PLIC_BASE_ADDR, PLIC_EXT_INTR_SOURCES);
 
+    /* PLIC3 has the highest priority and can preempt PLIC0 to PLIC2. */
+    MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT0_IRQn, 1u);
+    MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT1_IRQn, 2u);
+    MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT2_IRQn, 3u);
+    MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT3_IRQn, 4u);
+    MIV_PLIC_set_priority_threshold(&g_plic, 0u);
+
     MIV_PLIC_enable_irq(&g_plic, MIV_PLIC_EXT0_IRQn); /* GPIO-4 */
     MIV_PLIC_enable_irq(&g_plic, MIV_PLIC_EXT1_IRQn); /* GPIO-5 */
     MIV_PLIC_enable_irq(&g_plic, MIV_PLIC_EXT2_IRQn); /* GPIO-6 */
@@ -216,6 +251,15 @@ void main(void)
                     GPIO_set_outputs(&g_gpio_inout, val);
                 break;
 
+                case '5':
+                    val = 0xF0u;
+                    GPIO_set_outputs(&g_gpio_inout, val);
+                break;
+
+                case 's':
+                    display_dispatch_stats();
+                break;
+
                 default:
                     display_greeting();
                 break;
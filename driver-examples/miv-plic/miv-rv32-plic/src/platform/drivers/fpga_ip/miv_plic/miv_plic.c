@@ -252,6 +252,53 @@ __attribute__((weak)) uint8_t MIV_PLIC_EXT30_IRQHandler(void)
     return(0U); /* Default handler */
 }
 
+/*-------------------------------------------------------------------------*//**
+ * Address of the priority threshold and claim/complete registers of the
+ * current hart.
+ */
+#define PLIC_TARGET_ADDR(this_plic) \
+    ((this_plic)->base_addr + (0x1000 * read_csr(mhartid)))
+
+/*-------------------------------------------------------------------------*//**
+ * Number of entries of the handler table and of the dispatch counters.
+ */
+#define PLIC_NB_HANDLERS    32u
+
+/*-------------------------------------------------------------------------*//**
+ * Call the handler of a claimed interrupt source, then complete the claim and
+ * disable the source if the handler requested it. A source without a handler
+ * is only completed.
+ */
+static void
+plic_dispatch
+(
+    miv_plic_instance_t *this_plic,
+    addr_t target_addr,
+    uint32_t int_num
+)
+{
+    uint8_t disable = EXT_IRQ_KEEP_ENABLED;
+
+    if (int_num >= PLIC_NB_HANDLERS)
+    {
+        HAL_set_32bit_reg(target_addr, INT_CLAIM_COMPLETE, int_num);
+        return;
+    }
+
+    ++this_plic->dispatch_count[int_num];
+
+    disable = ext_irq_handler_table[int_num]();
+
+    /* Indicate the PLIC controller that the interrupt is processed and claim is
+     * complete. */
+    HAL_set_32bit_reg(target_addr, INT_CLAIM_COMPLETE, int_num);
+
+    if (EXT_IRQ_DISABLE == disable)
+    {
+        MIV_PLIC_disable_irq(this_plic, (miv_plic_irq_num_t)int_num);
+    }
+}
+
 /*-------------------------------------------------------------------------*//**
  * Please refer to miv_plic.h for more information about this function.
 */
@@ -261,23 +308,109 @@ MIV_PLIC_isr
     miv_plic_instance_t *this_plic
 )
 {
-    unsigned long hart_id = read_csr(mhartid);
+    addr_t target_addr = PLIC_TARGET_ADDR(this_plic);
 
     /* claim the interrupt from PLIC controller */
+    uint32_t int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
 
-    uint32_t int_num = HAL_get_32bit_reg(this_plic->base_addr +
-                                        (0x1000 * hart_id), INT_CLAIM_COMPLETE);
+    plic_dispatch(this_plic, target_addr, int_num);
+}
 
-    uint8_t disable = EXT_IRQ_KEEP_ENABLED;
-    disable = ext_irq_handler_table[int_num]();
+/*-------------------------------------------------------------------------*//**
+ * Please refer to miv_plic.h for more information about this function.
+*/
+void
+MIV_PLIC_drain_isr
+(
+    miv_plic_instance_t *this_plic
+)
+{
+    addr_t target_addr = PLIC_TARGET_ADDR(this_plic);
+    uint32_t int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
 
-    /* Indicate the PLIC controller that the interrupt is processed and claim is
-     * complete. */
-    HAL_set_32bit_reg(this_plic->base_addr +
-                                (0x1000 * hart_id), INT_CLAIM_COMPLETE, int_num);
+    /* Serve the pending sources, highest priority first, until the claim
+     * register indicates that no enabled source is pending. */
+    while (0u != int_num)
+    {
+        plic_dispatch(this_plic, target_addr, int_num);
+        int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
+    }
+}
 
-    if (EXT_IRQ_DISABLE == disable)
+/*-------------------------------------------------------------------------*//**
+ * Please refer to miv_plic.h for more information about this function.
+*/
+void
+MIV_PLIC_nested_isr
+(
+    miv_plic_instance_t *this_plic
+)
+{
+    addr_t target_addr = PLIC_TARGET_ADDR(this_plic);
+    uint32_t saved_threshold;
+    uintptr_t saved_mepc;
+    uintptr_t saved_mstatus;
+    uintptr_t saved_mie;
+    uint32_t int_num;
+
+    /*
+     * A nested trap overwrites mepc and the previous interrupt enable and
+     * privilege fields of mstatus, which are used by mret to return from
+     * this trap. Keep them, and the threshold of the preempted level, aside.
+     */
+    saved_threshold = HAL_get_32bit_reg(target_addr, INT_PRIORITY_THRESHOLD);
+    saved_mepc = read_csr(mepc);
+    saved_mstatus = read_csr(mstatus);
+
+    /*
+     * Only the PLIC sources are meant to nest. Mask the machine timer and
+     * software interrupts so that enabling MIE below does not let them
+     * preempt the PLIC handlers.
+     */
+    saved_mie = clear_csr(mie, MIP_MTIP | MIP_MSIP);
+
+    int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
+
+    while (0u != int_num)
     {
-        MIV_PLIC_disable_irq(this_plic, (miv_plic_irq_num_t)int_num);
+        uint8_t disable;
+
+        if (int_num >= PLIC_NB_HANDLERS)
+        {
+            HAL_set_32bit_reg(target_addr, INT_CLAIM_COMPLETE, int_num);
+            int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
+            continue;
+        }
+
+        ++this_plic->dispatch_count[int_num];
+        ++this_plic->nesting;
+        if (this_plic->nesting > this_plic->max_nesting)
+        {
+            this_plic->max_nesting = this_plic->nesting;
+        }
+
+        /* Only sources with a higher priority can preempt this handler. */
+        HAL_set_32bit_reg(target_addr, INT_PRIORITY_THRESHOLD,
+                    HAL_get_32bit_reg(this_plic->base_addr + (int_num * 4u), INT_PRIORITY));
+        set_csr(mstatus, MSTATUS_MIE);
+
+        disable = ext_irq_handler_table[int_num]();
+
+        clear_csr(mstatus, MSTATUS_MIE);
+        HAL_set_32bit_reg(target_addr, INT_PRIORITY_THRESHOLD, saved_threshold);
+        --this_plic->nesting;
+
+        HAL_set_32bit_reg(target_addr, INT_CLAIM_COMPLETE, int_num);
+
+        if (EXT_IRQ_DISABLE == disable)
+        {
+            MIV_PLIC_disable_irq(this_plic, (miv_plic_irq_num_t)int_num);
+        }
+
+        int_num = HAL_get_32bit_reg(target_addr, INT_CLAIM_COMPLETE);
     }
+
+    write_csr(mie, saved_mie);
+    write_csr(mepc, saved_mepc);
+    write_csr(mstatus, saved_mstatus);
 }
@@ -99,6 +99,41 @@
   serviced first, for example, if interrupt 1 and 6 assert at the same time,
   interrupt 1 will be serviced first, followed by interrupt 6.
 
+  The PLIC serves the pending interrupt with the highest priority first. The
+  priority of each source is set using MIV_PLIC_set_priority(); only sources
+  with a priority strictly greater than the priority threshold of the hart,
+  set using MIV_PLIC_set_priority_threshold(), are signalled to the processor.
+  A source with priority 0 is never signalled.
+
+  ----------------------------------------
+  Dispatch modes
+  ----------------------------------------
+  The driver provides three top level interrupt handlers. One of them must be
+  called from the external interrupt handler of the processor.
+
+  MIV_PLIC_isr() claims, services and completes a single interrupt source.
+  Any other pending source causes a new trap as soon as the handler returns.
+
+  MIV_PLIC_drain_isr() keeps claiming interrupt sources until the claim
+  register returns 0, so that a burst of interrupts is served within a single
+  trap instead of paying the trap entry and exit cost for each source.
+
+  MIV_PLIC_nested_isr() serves all the pending sources like
+  MIV_PLIC_drain_isr() but lets sources of a higher priority preempt the
+  handler being run. Before calling the handler of a source, the priority
+  threshold is raised to the priority of the source and interrupts are enabled
+  again in mstatus; the threshold, mepc and mstatus are restored once the
+  handler returns. The machine timer and software interrupts are masked in mie
+  while the PLIC handlers run, so only PLIC sources nest. Other local
+  interrupts of the processor that are enabled in mie can still preempt the
+  PLIC handlers in this mode. The stack must be sized for the deepest nesting.
+
+  The number of times the handler of each source was called is recorded and can
+  be read using MIV_PLIC_get_dispatch_count(), together with the maximum nesting
+  depth reached, using MIV_PLIC_get_max_nesting(). A count recorded against
+  NoInterrupt_IRQn means that the claim register returned 0 when the
+  MIV_PLIC_isr() function was called.
+
 */
 
 #ifndef MIV_PLIC_H_
@@ -186,6 +221,9 @@ typedef struct
 typedef struct miv_plic_instance
 {
     addr_t base_addr;
+    volatile uint32_t dispatch_count[32];
+    volatile uint32_t nesting;
+    volatile uint32_t max_nesting;
 } miv_plic_instance_t;
 
 /*-------------------------------------------------------------------------*//**
@@ -244,6 +282,69 @@ typedef struct miv_plic_instance
  */
 void MIV_PLIC_isr(miv_plic_instance_t *this_plic);
 
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_drain_isr() function is an alternative to MIV_PLIC_isr(). It
+ * claims, services and completes interrupt sources until no enabled source is
+ * pending, all within a single call.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure which
+ *                  holds all the data related to the Mi-V PLIC instance.
+ *
+ * @return
+ *                  This function does not return any value.
+ *
+ * Example:
+ * @code
+ *         void External_IRQHandler(void)
+ *         {
+ *             MIV_PLIC_drain_isr(&g_plic);
+ *         }
+ * @endcode
+ */
+void MIV_PLIC_drain_isr(miv_plic_instance_t *this_plic);
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_nested_isr() function is an alternative to MIV_PLIC_isr(). It
+ * services all the pending interrupt sources like MIV_PLIC_drain_isr() and
+ * runs each handler with interrupts enabled and the priority threshold set to
+ * the priority of the source, so that sources with a higher priority can
+ * preempt it.
+ *
+ * Setting MIE in mstatus enables every interrupt that is enabled in mie, not
+ * only the PLIC. This function therefore clears the machine timer (MTIE) and
+ * software (MSIE) enable bits in mie for the duration of the call and restores
+ * mie before returning. Timer and software interrupts that become pending
+ * meanwhile are taken after the trap returns. Any other local interrupt left
+ * enabled in mie can still preempt the PLIC handlers.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure which
+ *                  holds all the data related to the Mi-V PLIC instance.
+ *
+ * @return
+ *                  This function does not return any value.
+ *
+ * Example:
+ * @code
+ *         void External_IRQHandler(void)
+ *         {
+ *             MIV_PLIC_nested_isr(&g_plic);
+ *         }
+ *
+ *         void main(void)
+ *         {
+ *             MIV_PLIC_init(&g_plic, MIV_PLIC_BASE_ADDR, PLIC_EXT_INTR_SOURCES);
+ *
+ *             MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT0_IRQn, 1u);
+ *             MIV_PLIC_set_priority(&g_plic, MIV_PLIC_EXT1_IRQn, 2u);
+ *             MIV_PLIC_enable_irq(&g_plic, MIV_PLIC_EXT0_IRQn);
+ *             MIV_PLIC_enable_irq(&g_plic, MIV_PLIC_EXT1_IRQn);
+ *         }
+ * @endcode
+ */
+void MIV_PLIC_nested_isr(miv_plic_instance_t *this_plic);
+
 /*-------------------------------------------------------------------------*//**
  * The MIV_PLIC_init() function initializes the Mi-V PLIC instance with base
  * address. This function resets the PLIC controller by disabling all the PLIC
@@ -292,6 +393,13 @@ MIV_PLIC_init
     unsigned long hart_id = read_csr(mhartid);
 
     this_plic->base_addr = base_addr;
+    this_plic->nesting = 0u;
+    this_plic->max_nesting = 0u;
+
+    for(inc = 0; inc < 32u; ++inc)
+    {
+        this_plic->dispatch_count[inc] = 0u;
+    }
 
     /* Disable all interrupts for the current hart.
      * The PLIC_EXT_INTR_SOURCES should be defined in the hw_platform.h. This 
@@ -418,6 +526,148 @@ MIV_PLIC_disable_irq
 
 }
 
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_set_priority() function sets the priority of a PLIC interrupt
+ * source. A source is only signalled to the processor when its priority is
+ * greater than the priority threshold. All sources have a priority of 0 after
+ * reset; give the sources a non-zero priority before enabling them.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ * @param IRQn
+ *                  Number of the PLIC interrupt.
+ * @param priority
+ *                  Priority of the interrupt, 0 being the lowest.
+ *
+ * @return
+ *                 This function does not return any value.
+ */
+static inline void
+MIV_PLIC_set_priority
+(
+        miv_plic_instance_t *this_plic,
+        miv_plic_irq_num_t IRQn,
+        uint32_t priority
+)
+{
+    HAL_set_32bit_reg((this_plic->base_addr + ((uint32_t)IRQn * 4u)), INT_PRIORITY, priority);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_get_priority() function returns the priority of a PLIC
+ * interrupt source.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ * @param IRQn
+ *                  Number of the PLIC interrupt.
+ *
+ * @return
+ *                 The priority of the interrupt.
+ */
+static inline uint32_t
+MIV_PLIC_get_priority
+(
+        miv_plic_instance_t *this_plic,
+        miv_plic_irq_num_t IRQn
+)
+{
+    return HAL_get_32bit_reg((this_plic->base_addr + ((uint32_t)IRQn * 4u)), INT_PRIORITY);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_set_priority_threshold() function sets the priority threshold
+ * of the current hart. Only the interrupts with a priority greater than the
+ * threshold are signalled to the processor.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ * @param threshold
+ *                  The new priority threshold.
+ *
+ * @return
+ *                 This function does not return any value.
+ */
+static inline void
+MIV_PLIC_set_priority_threshold
+(
+        miv_plic_instance_t *this_plic,
+        uint32_t threshold
+)
+{
+    unsigned long hart_id = read_csr(mhartid);
+
+    HAL_set_32bit_reg((this_plic->base_addr + (0x1000 * hart_id)), INT_PRIORITY_THRESHOLD, threshold);
+}
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_get_dispatch_count() function returns the number of times the
+ * handler of a PLIC interrupt source was called since MIV_PLIC_init() or the
+ * last call to MIV_PLIC_clear_dispatch_counts().
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ * @param IRQn
+ *                  Number of the PLIC interrupt.
+ *
+ * @return
+ *                 The number of calls to the interrupt handler.
+ */
+static inline uint32_t
+MIV_PLIC_get_dispatch_count
+(
+        miv_plic_instance_t *this_plic,
+        miv_plic_irq_num_t IRQn
+)
+{
+    return this_plic->dispatch_count[(uint32_t)IRQn & 31u];
+}
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_get_max_nesting() function returns the highest number of PLIC
+ * handlers that were running at the same time in MIV_PLIC_nested_isr(). A
+ * value greater than 1 shows that a handler has been preempted.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ *
+ * @return
+ *                 The maximum nesting depth.
+ */
+static inline uint32_t
+MIV_PLIC_get_max_nesting
+(
+        miv_plic_instance_t *this_plic
+)
+{
+    return this_plic->max_nesting;
+}
+
+/*-------------------------------------------------------------------------*//**
+ * The MIV_PLIC_clear_dispatch_counts() function clears the dispatch counters
+ * and the maximum nesting depth.
+ *
+ * @param this_plic
+ *                  A pointer to the miv_plic_instance_t data structure.
+ *
+ * @return
+ *                 This function does not return any value.
+ */
+static inline void
+MIV_PLIC_clear_dispatch_counts
+(
+        miv_plic_instance_t *this_plic
+)
+{
+    uint32_t inc;
+
+    for(inc = 0; inc < 32u; ++inc)
+    {
+        this_plic->dispatch_count[inc] = 0u;
+    }
+    this_plic->max_nesting = 0u;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,12 +15,18 @@
 extern "C" {
 #endif
 
+/* Interrupt source priority register offset */
+#define INT_PRIORITY_REG_OFFSET                     0x0u
+
 /* Interrupt pending register offset */
 #define INT_PENDING_REG_OFFSET                      0x1000u
 
 /* Interrupt enable register */
 #define INT_ENABLE_REG_OFFSET                       0x2000u
 
+/* Interrupt priority threshold register */
+#define INT_PRIORITY_THRESHOLD_REG_OFFSET           0x200000u
+
 /* Interrupt claim complete register */
 #define INT_CLAIM_COMPLETE_REG_OFFSET               0x200004u
 
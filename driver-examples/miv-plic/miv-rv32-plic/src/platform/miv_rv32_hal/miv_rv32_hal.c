@@ -185,7 +185,12 @@ void handle_m_ext_interrupt(void)
     uint32_t int_num  = PLIC->TARGET[hart_id].CLAIM_COMPLETE;
     uint8_t disable = EXT_IRQ_KEEP_ENABLED;
 
+#ifdef MIV_LEGACY_RV32_PLIC_DRAIN
+    /* Serve all the pending sources within this trap. */
+    while (0u != int_num)
+#else
     if (0u !=int_num)
+#endif
     {
         disable = ext_irq_handler_table[int_num]();
 
@@ -195,6 +200,10 @@ void handle_m_ext_interrupt(void)
         {
             MRV_PLIC_disable_irq((IRQn_Type)int_num);
         }
+
+#ifdef MIV_LEGACY_RV32_PLIC_DRAIN
+        int_num = PLIC->TARGET[hart_id].CLAIM_COMPLETE;
+#endif
     }
 }
 #endif
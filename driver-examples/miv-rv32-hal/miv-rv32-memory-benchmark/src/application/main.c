@@ -0,0 +1,668 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MIV_RV32 Memory Benchmark Example project
+ *
+ * This project measures the performance of the memory regions of the design:
+ * sequential read, write and copy bandwidth of the processor, load-to-load
+ * latency measured by pointer chasing, and the copy throughput of the MIV_ESS
+ * uDMA compared with a processor copy. It also compares the memcpy(), memset()
+ * and memcmp() functions of the C library with the MRV_ versions of the HAL.
+ * The regions are defined in fpga_design_config.h and the results are printed
+ * over the UART as tables.
+ *
+ * Please refer README.md in the root folder of this project for more details.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "miv_rv32_hal/miv_rv32_hal.h"
+#include "miv_rv32_hal/miv_rv32_fmt.h"
+#include "miv_rv32_hal/miv_rv32_string.h"
+#include "fpga_design_config/fpga_design_config.h"
+#include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
+#include "drivers/fpga_ip/miv_udma/miv_udma.h"
+
+/******************************************************************************
+ * Benchmark parameters.
+ *****************************************************************************/
+#define MIN_TEST_SIZE                   1024u
+#define MAX_TEST_SIZE                   (64u * 1024u)
+
+/* Size used for the copies between two regions. */
+#define CROSS_COPY_SIZE                 (16u * 1024u)
+
+/* Pointer chasing: number of nodes in the chain and number of loads timed. */
+#define CHASE_MAX_NODES                 512u
+#define CHASE_MIN_STRIDE                32u
+#define CHASE_STEPS                     4096u
+
+/* Buffer sizes of the memory function tests: Ethernet frame sizes. */
+static const uint32_t g_frame_sizes[] = {64u, 128u, 256u, 512u, 1024u, 1518u};
+
+#define NB_FRAME_SIZES  (sizeof(g_frame_sizes) / sizeof(g_frame_sizes[0]))
+
+/* Each test is repeated and the fastest run is kept. */
+#define NB_RUNS                         3u
+
+/* Give up waiting for a uDMA transfer after this number of cycles. */
+#define UDMA_TIMEOUT_CYCLES             (SYS_CLK_FREQ / 10u)
+
+/******************************************************************************
+ * Memory regions under test, from fpga_design_config.h.
+ *****************************************************************************/
+typedef struct
+{
+    const char * name;
+    uintptr_t base;
+    uint32_t size;
+} mem_region_t;
+
+static const mem_region_t g_regions[] =
+{
+#ifdef MEMBENCH_TCM_BASE_ADDR
+    {"TCM", MEMBENCH_TCM_BASE_ADDR, MEMBENCH_TCM_SIZE},
+#endif
+#ifdef MEMBENCH_LSRAM_BASE_ADDR
+    {"LSRAM", MEMBENCH_LSRAM_BASE_ADDR, MEMBENCH_LSRAM_SIZE},
+#endif
+#ifdef MEMBENCH_DDR_BASE_ADDR
+    {"DDR", MEMBENCH_DDR_BASE_ADDR, MEMBENCH_DDR_SIZE},
+#endif
+};
+
+#define NB_REGIONS      (sizeof(g_regions) / sizeof(g_regions[0]))
+
+/******************************************************************************
+ * Peripheral instance data.
+ *****************************************************************************/
+UART_instance_t g_uart;
+
+miv_udma_instance_t g_miv_ess_udma;
+
+static volatile uint32_t g_udma_done = 0u;
+static volatile uint32_t g_udma_status = 0u;
+
+static volatile uint32_t g_sink;
+
+static uint16_t g_chase_order[CHASE_MAX_NODES];
+
+/*==============================================================================
+ * Messages displayed over the UART.
+ */
+const uint8_t g_greeting_msg[] =
+"\r\n\r\n\t\t **** PolarFire MIV_RV32 Memory Benchmark ****\n\n\r\
+Bandwidths are in MB/s, latencies in processor clock cycles per load.\r\n\
+The fastest of several runs is reported for each test.\r\n";
+
+/* MIV RV32 External interrupt handlers for MIV_ESS uDMA */
+void MSYS_EI1_IRQHandler()
+{
+    g_udma_status = MIV_uDMA_read_status(&g_miv_ess_udma);
+
+    MIV_uDMA_reset(&g_miv_ess_udma);
+
+    g_udma_done = 1u;
+}
+
+/*==============================================================================
+ * Output helpers. The reports are formatted with MRV_fmt() and sent with
+ * polled transmission, so the C library printf family, whose cost is measured
+ * by benchmark_format(), is not used for the output.
+ */
+static void uart_sink(void * p_ctx, const char * p_buf, uint32_t length)
+{
+    UART_send((UART_instance_t *)p_ctx, (const uint8_t *)p_buf, length);
+}
+
+#define print(...)      MRV_fmt(uart_sink, &g_uart, __VA_ARGS__)
+
+/* Bandwidth in MB/s with one decimal, or "-" when not measured. */
+static void print_mbps(uint32_t nb_bytes, uint32_t cycles, uint32_t width)
+{
+    uint32_t tenths;
+
+    if (0u == cycles)
+    {
+        print("%*s", width, "-");
+        return;
+    }
+
+    tenths = (uint32_t)(((uint64_t)nb_bytes * SYS_CLK_FREQ) /
+                        ((uint64_t)cycles * 100000u));
+    print("%*.1q", width, tenths);
+}
+
+static inline uint32_t cycles(void)
+{
+    return read_csr(mcycle);
+}
+
+/*==============================================================================
+ * Processor tests. The buffers are accessed through volatile pointers so
+ * that the compiler keeps one access per word and does not replace the loops
+ * by calls to memset() or memcpy(). The loops are unrolled four times to
+ * reduce the loop overhead included in the measurement.
+ */
+static uint32_t test_read(uintptr_t addr, uint32_t nb_bytes)
+{
+    volatile const uint32_t * p_word = (volatile const uint32_t *)addr;
+    uint32_t nb_words = nb_bytes / 4u;
+    uint32_t sum = 0u;
+    uint32_t start = cycles();
+    uint32_t idx;
+
+    for (idx = 0u; idx < nb_words; idx += 4u)
+    {
+        sum += p_word[idx];
+        sum += p_word[idx + 1u];
+        sum += p_word[idx + 2u];
+        sum += p_word[idx + 3u];
+    }
+
+    start = cycles() - start;
+    g_sink = sum;
+
+    return start;
+}
+
+static uint32_t test_write(uintptr_t addr, uint32_t nb_bytes)
+{
+    volatile uint32_t * p_word = (volatile uint32_t *)addr;
+    uint32_t nb_words = nb_bytes / 4u;
+    uint32_t start = cycles();
+    uint32_t idx;
+
+    for (idx = 0u; idx < nb_words; idx += 4u)
+    {
+        p_word[idx] = idx;
+        p_word[idx + 1u] = idx;
+        p_word[idx + 2u] = idx;
+        p_word[idx + 3u] = idx;
+    }
+
+    return cycles() - start;
+}
+
+static uint32_t test_copy(uintptr_t src, uintptr_t dest, uint32_t nb_bytes)
+{
+    volatile const uint32_t * p_src = (volatile const uint32_t *)src;
+    volatile uint32_t * p_dest = (volatile uint32_t *)dest;
+    uint32_t nb_words = nb_bytes / 4u;
+    uint32_t start = cycles();
+    uint32_t idx;
+
+    for (idx = 0u; idx < nb_words; idx += 4u)
+    {
+        p_dest[idx] = p_src[idx];
+        p_dest[idx + 1u] = p_src[idx + 1u];
+        p_dest[idx + 2u] = p_src[idx + 2u];
+        p_dest[idx + 3u] = p_src[idx + 3u];
+    }
+
+    return cycles() - start;
+}
+
+/*
+ * Link the nodes of a region into a single cycle visiting them in a random
+ * order (Sattolo's algorithm), then time CHASE_STEPS dependent loads. Every
+ * load must complete before the address of the next one is known, so the
+ * result is the load-to-use latency of the region rather than its bandwidth.
+ */
+static uint32_t test_latency(uintptr_t addr, uint32_t nb_bytes)
+{
+    uint32_t nb_nodes = nb_bytes / CHASE_MIN_STRIDE;
+    uint32_t stride;
+    uint32_t seed = 0x2545F491u;
+    uint32_t idx;
+    uint32_t start;
+    uintptr_t node;
+
+    if (nb_nodes > CHASE_MAX_NODES)
+    {
+        nb_nodes = CHASE_MAX_NODES;
+    }
+    stride = (nb_bytes / nb_nodes) & ~3u;
+
+    for (idx = 0u; idx < nb_nodes; idx++)
+    {
+        g_chase_order[idx] = (uint16_t)idx;
+    }
+    for (idx = nb_nodes - 1u; idx > 0u; idx--)
+    {
+        uint32_t other;
+        uint16_t swap;
+
+        seed = (seed * 1664525u) + 1013904223u;
+        other = (seed >> 8) % idx;
+        swap = g_chase_order[idx];
+        g_chase_order[idx] = g_chase_order[other];
+        g_chase_order[other] = swap;
+    }
+
+    /* Node i points to node g_chase_order[i]. */
+    for (idx = 0u; idx < nb_nodes; idx++)
+    {
+        *(volatile uintptr_t *)(addr + (idx * stride)) =
+            addr + ((uint32_t)g_chase_order[idx] * stride);
+    }
+
+    node = addr;
+    start = cycles();
+    for (idx = 0u; idx < CHASE_STEPS; idx += 4u)
+    {
+        node = *(volatile uintptr_t *)node;
+        node = *(volatile uintptr_t *)node;
+        node = *(volatile uintptr_t *)node;
+        node = *(volatile uintptr_t *)node;
+    }
+    start = cycles() - start;
+    g_sink = (uint32_t)node;
+
+    return start / CHASE_STEPS;
+}
+
+/*==============================================================================
+ * uDMA test: the time from the start of the transfer to its completion
+ * interrupt. Returns 0 when the transfer fails or does not complete.
+ */
+static uint32_t test_udma(uintptr_t src, uintptr_t dest, uint32_t nb_bytes)
+{
+    uint32_t start;
+    uint32_t elapsed;
+
+    g_udma_done = 0u;
+    MIV_uDMA_config(&g_miv_ess_udma, src, dest, nb_bytes / 4u,
+                    MIV_uDMA_CTRL_IRQ_CONFIG);
+
+    start = cycles();
+    MIV_uDMA_start(&g_miv_ess_udma);
+    do {
+        elapsed = cycles() - start;
+    } while ((0u == g_udma_done) && (elapsed < UDMA_TIMEOUT_CYCLES));
+
+    if ((0u == g_udma_done) || (0u != (g_udma_status & MIV_uDMA_STATUS_ERROR)))
+    {
+        MIV_uDMA_reset(&g_miv_ess_udma);
+        return 0u;
+    }
+
+    return elapsed;
+}
+
+/* Returns 1 when the two buffers hold the same data. */
+static uint8_t same_data(uintptr_t src, uintptr_t dest, uint32_t nb_bytes)
+{
+    volatile const uint32_t * p_src = (volatile const uint32_t *)src;
+    volatile const uint32_t * p_dest = (volatile const uint32_t *)dest;
+    uint32_t idx;
+
+    for (idx = 0u; idx < (nb_bytes / 4u); idx++)
+    {
+        if (p_src[idx] != p_dest[idx])
+        {
+            return 0u;
+        }
+    }
+
+    return 1u;
+}
+
+static void fill_pattern(uintptr_t addr, uint32_t nb_bytes, uint32_t seed)
+{
+    volatile uint32_t * p_word = (volatile uint32_t *)addr;
+    uint32_t idx;
+
+    for (idx = 0u; idx < (nb_bytes / 4u); idx++)
+    {
+        seed = (seed * 1664525u) + 1013904223u;
+        p_word[idx] = seed;
+    }
+}
+
+static uint32_t fastest(uint32_t current, uint32_t measured)
+{
+    if ((0u == measured) || ((0u != current) && (current < measured)))
+    {
+        return current;
+    }
+    return measured;
+}
+
+/*==============================================================================
+ * Run all the tests on one region for each power of two size which fits in
+ * half of the region; the other half is the copy destination.
+ */
+static void benchmark_region(const mem_region_t * p_region)
+{
+    uint32_t size;
+
+    print("\r\n\r\nRegion %s at 0x%08X, %u KB\r\n",
+          p_region->name, (uint32_t)p_region->base, p_region->size / 1024u);
+    print("    size       read      write   CPU copy  uDMA copy    latency\r\n");
+
+    for (size = MIN_TEST_SIZE;
+         (size <= MAX_TEST_SIZE) && (size <= (p_region->size / 2u));
+         size *= 2u)
+    {
+        uintptr_t src = p_region->base;
+        uintptr_t dest = p_region->base + (p_region->size / 2u);
+        uint32_t read_cycles = 0u;
+        uint32_t write_cycles = 0u;
+        uint32_t copy_cycles = 0u;
+        uint32_t udma_cycles = 0u;
+        uint32_t latency = 0u;
+        uint8_t udma_ok = 1u;
+        uint32_t run;
+
+        for (run = 0u; run < NB_RUNS; run++)
+        {
+            write_cycles = fastest(write_cycles, test_write(src, size));
+            read_cycles = fastest(read_cycles, test_read(src, size));
+            copy_cycles = fastest(copy_cycles, test_copy(src, dest, size));
+
+            fill_pattern(src, size, run);
+            fill_pattern(dest, size, ~run);
+            udma_cycles = fastest(udma_cycles, test_udma(src, dest, size));
+            if (!same_data(src, dest, size))
+            {
+                udma_ok = 0u;
+            }
+
+            latency = fastest(latency, test_latency(src, size));
+        }
+
+        print("%8u", size);
+        print_mbps(size, read_cycles, 11u);
+        print_mbps(size, write_cycles, 11u);
+        print_mbps(size, copy_cycles, 11u);
+        if (udma_ok)
+        {
+            print_mbps(size, udma_cycles, 11u);
+        }
+        else
+        {
+            print("%11s", "ERROR");
+        }
+        print("%11u\r\n", latency);
+    }
+}
+
+/*==============================================================================
+ * Copy CROSS_COPY_SIZE bytes between every pair of regions, with the
+ * processor and with the uDMA.
+ */
+static void benchmark_cross_copy(void)
+{
+    uint32_t src_idx;
+    uint32_t dest_idx;
+
+    if (NB_REGIONS < 2u)
+    {
+        return;
+    }
+
+    print("\r\n\r\nCopy between regions, %u bytes\r\n", CROSS_COPY_SIZE);
+    print("  from     to        CPU copy  uDMA copy\r\n");
+
+    for (src_idx = 0u; src_idx < NB_REGIONS; src_idx++)
+    {
+        for (dest_idx = 0u; dest_idx < NB_REGIONS; dest_idx++)
+        {
+            const mem_region_t * p_src = &g_regions[src_idx];
+            const mem_region_t * p_dest = &g_regions[dest_idx];
+            uint32_t size = CROSS_COPY_SIZE;
+            uint32_t copy_cycles = 0u;
+            uint32_t udma_cycles = 0u;
+            uint8_t udma_ok = 1u;
+            uint32_t run;
+
+            if (src_idx == dest_idx)
+            {
+                continue;
+            }
+            if (size > p_src->size)
+            {
+                size = p_src->size;
+            }
+            if (size > p_dest->size)
+            {
+                size = p_dest->size;
+            }
+
+            for (run = 0u; run < NB_RUNS; run++)
+            {
+                copy_cycles = fastest(copy_cycles,
+                                      test_copy(p_src->base, p_dest->base, size));
+
+                fill_pattern(p_src->base, size, run);
+                fill_pattern(p_dest->base, size, ~run);
+                udma_cycles = fastest(udma_cycles,
+                                      test_udma(p_src->base, p_dest->base, size));
+                if (!same_data(p_src->base, p_dest->base, size))
+                {
+                    udma_ok = 0u;
+                }
+            }
+
+            print("  %-9s%-9s", p_src->name, p_dest->name);
+            print_mbps(size, copy_cycles, 9u);
+            if (udma_ok)
+            {
+                print_mbps(size, udma_cycles, 11u);
+            }
+            else
+            {
+                print("%11s", "ERROR");
+            }
+            print("\r\n");
+        }
+    }
+}
+
+/*==============================================================================
+ * Memory functions: cycles per call of the C library functions and of their
+ * MRV_ versions, for Ethernet frame sizes. The misaligned copy reads from an
+ * address offset by 2 bytes, as done for the payload of a received frame.
+ */
+typedef void * (*copy_fn_t)(void * p_dest, const void * p_src, size_t n);
+typedef void * (*set_fn_t)(void * p_dest, int value, size_t n);
+typedef int (*cmp_fn_t)(const void * p_buf1, const void * p_buf2, size_t n);
+
+static uint32_t time_copy(copy_fn_t copy, uintptr_t dest, uintptr_t src,
+                          uint32_t nb_bytes)
+{
+    uint32_t best = 0u;
+    uint32_t run;
+
+    for (run = 0u; run < NB_RUNS; run++)
+    {
+        uint32_t start = cycles();
+
+        copy((void *)dest, (const void *)src, nb_bytes);
+        best = fastest(best, cycles() - start);
+    }
+
+    return best;
+}
+
+static uint32_t time_set(set_fn_t set, uintptr_t dest, uint32_t nb_bytes)
+{
+    uint32_t best = 0u;
+    uint32_t run;
+
+    for (run = 0u; run < NB_RUNS; run++)
+    {
+        uint32_t start = cycles();
+
+        set((void *)dest, 0x5A, nb_bytes);
+        best = fastest(best, cycles() - start);
+    }
+
+    return best;
+}
+
+static uint32_t time_cmp(cmp_fn_t cmp, uintptr_t buf1, uintptr_t buf2,
+                         uint32_t nb_bytes)
+{
+    uint32_t best = 0u;
+    uint32_t run;
+
+    for (run = 0u; run < NB_RUNS; run++)
+    {
+        uint32_t start = cycles();
+
+        g_sink = (uint32_t)cmp((const void *)buf1, (const void *)buf2, nb_bytes);
+        best = fastest(best, cycles() - start);
+    }
+
+    return best;
+}
+
+static void benchmark_mem_functions(const mem_region_t * p_region)
+{
+    uintptr_t src = p_region->base;
+    uintptr_t dest = p_region->base + (p_region->size / 2u);
+    uint32_t idx;
+
+    if ((p_region->size / 2u) < (g_frame_sizes[NB_FRAME_SIZES - 1u] + 4u))
+    {
+        return;
+    }
+
+    print("\r\n\r\nMemory functions in %s, cycles per call, C library / MRV_\r\n",
+          p_region->name);
+    print("    size     memcpy aligned      memcpy src+2            memset");
+    print("            memcmp\r\n");
+
+    for (idx = 0u; idx < NB_FRAME_SIZES; idx++)
+    {
+        uint32_t size = g_frame_sizes[idx];
+
+        fill_pattern(src, size + 4u, idx);
+
+        print("%8u", size);
+        print("%10u%8u", time_copy(memcpy, dest, src, size),
+              time_copy(MRV_memcpy, dest, src, size));
+        print("%10u%8u", time_copy(memcpy, dest, src + 2u, size),
+              time_copy(MRV_memcpy, dest, src + 2u, size));
+        print("%10u%8u", time_set(memset, dest, size),
+              time_set(MRV_memset, dest, size));
+
+        /* Equal buffers: the whole size is compared. */
+        (void)MRV_memcpy((void *)dest, (const void *)src, size);
+        print("%10u%8u\r\n", time_cmp(memcmp, dest, src, size),
+              time_cmp(MRV_memcmp, dest, src, size));
+    }
+}
+
+/*==============================================================================
+ * Formatted output: cycles per call of the C library snprintf() and of
+ * MRV_snprintf(), for typical status messages. Each format takes the same
+ * three arguments. The two outputs are compared to check MRV_snprintf().
+ */
+typedef int (*format_fn_t)(char * p_buf, size_t size, const char * p_format, ...);
+
+typedef struct
+{
+    const char * name;
+    const char * format;
+} format_case_t;
+
+static const format_case_t g_format_cases[] =
+{
+    {"decimal", "Frames: %u, errors: %d\r\n"},
+    {"hex",     "Reg 0x%08X = 0x%08x\r\n"},
+    {"padded",  "%10u|%-8d|%s\r\n"},
+};
+
+#define NB_FORMAT_CASES (sizeof(g_format_cases) / sizeof(g_format_cases[0]))
+
+static char g_lib_text[96];
+static char g_mrv_text[96];
+
+static uint32_t time_format(format_fn_t format, char * p_buf,
+                            const char * p_format)
+{
+    uint32_t best = 0u;
+    uint32_t run;
+
+    for (run = 0u; run < NB_RUNS; run++)
+    {
+        uint32_t start = cycles();
+
+        (void)format(p_buf, sizeof(g_lib_text), p_format,
+                     3735928559u, -1234567, "link up");
+        best = fastest(best, cycles() - start);
+    }
+
+    return best;
+}
+
+static void benchmark_format(void)
+{
+    uint32_t idx;
+
+    print("\r\n\r\nFormatted output, cycles per call, snprintf / MRV_snprintf\r\n");
+    print("    format           lib       MRV\r\n");
+
+    for (idx = 0u; idx < NB_FORMAT_CASES; idx++)
+    {
+        const format_case_t * p_case = &g_format_cases[idx];
+
+        print("    %-10s", p_case->name);
+        print("%10u", time_format(snprintf, g_lib_text, p_case->format));
+        print("%10u", time_format(MRV_snprintf, g_mrv_text, p_case->format));
+
+        if (0 != strcmp(g_lib_text, g_mrv_text))
+        {
+            print("  ERROR: output differs");
+        }
+        print("\r\n");
+    }
+}
+
+/******************************************************************************
+ * main function.
+ *****************************************************************************/
+void main(void)
+{
+    uint32_t region;
+
+    /* Initialize CoreUARTapb with its base address, baud value, and line
+     * configuration.
+     */
+    UART_init(&g_uart, COREUARTAPB0_BASE_ADDR, BAUD_VALUE_115200, (DATA_8_BITS | NO_PARITY));
+
+    print("%s", (const char *)g_greeting_msg);
+
+    MIV_uDMA_init(&g_miv_ess_udma, MIV_ESS_uDMA_BASE_ADDR);
+
+    MRV_enable_local_irq(MRV32_MSYS_EIE1_IRQn);
+
+    HAL_enable_interrupts();
+
+    for (region = 0u; region < NB_REGIONS; region++)
+    {
+        benchmark_region(&g_regions[region]);
+    }
+
+    benchmark_cross_copy();
+
+    if (NB_REGIONS > 0u)
+    {
+        benchmark_mem_functions(&g_regions[0]);
+    }
+
+    benchmark_format();
+
+    print("\r\n\r\nBenchmark complete.\r\n");
+
+    while (1)
+    {
+        ;
+    }
+}
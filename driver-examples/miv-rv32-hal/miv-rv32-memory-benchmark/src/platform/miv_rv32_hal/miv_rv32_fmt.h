@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_fmt.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Small formatted output functions for Mi-V soft processors, writing
+ * to an application supplied sink.
+ *
+ */
+
+/*=========================================================================*//**
+  MIV_RV32 Formatted Output
+  =======================================
+  Status messages are usually formatted with sprintf() into a buffer which is
+  then sent with UART_polled_tx_string(). The printf family of the newlib C
+  library pulls in several kilobytes of code, including the floating point
+  conversions, and the reentrant versions can allocate memory from the heap.
+
+  MRV_fmt() formats its arguments without using the C library, the heap or
+  any static data, so it can be called from several tasks or from interrupt
+  handlers at the same time. The characters are gathered in a small buffer on
+  the stack of the caller, MRV_FMT_BUFFER_SIZE bytes, and passed to a sink
+  function each time the buffer is full and once at the end. The sink writes
+  them to their destination, for example a UART, a transmit ring or a trace
+  buffer:
+
+      static void uart_sink(void * p_ctx, const char * p_buf, uint32_t length)
+      {
+          UART_send((UART_instance_t *)p_ctx, (const uint8_t *)p_buf, length);
+      }
+
+      MRV_fmt(uart_sink, &g_uart, "Frames: %u, errors: %u\r\n", good, bad);
+
+  MRV_snprintf() uses the same formatter to write to a character buffer.
+
+  --------------------------------
+  Conversions
+  --------------------------------
+  The format string follows the C standard syntax,
+  %[flags][width][.precision][length]conversion, for the conversions below:
+
+  | Conversion | Argument             | Output                               |
+  |------------|----------------------|--------------------------------------|
+  | d, i       | signed integer       | decimal                              |
+  | u          | unsigned integer     | decimal                              |
+  | x, X       | unsigned integer     | hexadecimal, lower or upper case     |
+  | o          | unsigned integer     | octal                                |
+  | q          | signed integer       | fixed point decimal, see below       |
+  | c          | character            | the character                        |
+  | s          | string               | the string                           |
+  | p          | pointer              | 0x followed by 8 hexadecimal digits  |
+  | %          | none                 | %                                    |
+
+  The flags are '-' (left justify), '0' (pad with zeros), '+' and ' ' (sign of
+  positive numbers) and '#' (0x prefix for x and X). The width and precision
+  can be given as '*', taken from the arguments. The length modifiers hh, h,
+  l, ll, z and t are supported; 64 bit values are only divided with 64 bit
+  arithmetic when they do not fit in 32 bits.
+
+  The q conversion prints fixed point values without floating point: the
+  argument is an integer holding the value multiplied by 10 to the power of
+  the precision, and the decimal point is inserted before the last precision
+  digits. For example, a bandwidth measured in tenths of MB/s is printed with:
+
+      MRV_fmt(uart_sink, &g_uart, "%.1q MB/s\r\n", tenths);   // "12.5 MB/s"
+
+  The floating point conversions (f, e, g, a) are not supported and, like any
+  unknown conversion, are copied to the output as they appear in the format.
+
+  Since the q conversion is not known to the compiler, the functions are not
+  declared with the printf format attribute: the arguments are not checked
+  against the format at compile time.
+
+ *//*=========================================================================*/
+#ifndef MIV_RV32_FMT_H
+#define MIV_RV32_FMT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+  Size of the buffer, on the stack of the caller, gathering the characters
+  passed to the sink in one call.
+ */
+#ifndef MRV_FMT_BUFFER_SIZE
+#define MRV_FMT_BUFFER_SIZE             32u
+#endif
+
+/***************************************************************************//**
+  The mrv_fmt_sink_t type is the prototype of the function receiving the
+  formatted characters. The characters are not NUL terminated.
+ */
+typedef void (*mrv_fmt_sink_t)(void * p_ctx, const char * p_buf, uint32_t length);
+
+/***************************************************************************//**
+  The MRV_fmt() function formats its arguments and writes the result to a
+  sink.
+
+  @param sink
+  Function receiving the formatted characters.
+
+  @param p_ctx
+  Value passed to the sink, for example the UART instance.
+
+  @param p_format
+  Format string.
+
+  @return
+  This function returns the number of characters written to the sink.
+ */
+int MRV_fmt(mrv_fmt_sink_t sink, void * p_ctx, const char * p_format, ...);
+
+/***************************************************************************//**
+  The MRV_vfmt() function is the version of MRV_fmt() taking its arguments as
+  a va_list, used to write functions with a variable number of arguments on
+  top of the formatter.
+ */
+int MRV_vfmt(mrv_fmt_sink_t sink,
+             void * p_ctx,
+             const char * p_format,
+             va_list args);
+
+/***************************************************************************//**
+  The MRV_snprintf() function formats its arguments into a character buffer.
+  At most size - 1 characters are written, followed by a NUL character.
+
+  @param p_buf
+  Buffer receiving the string.
+
+  @param size
+  Size of the buffer in bytes. Nothing is written when it is 0.
+
+  @param p_format
+  Format string.
+
+  @return
+  This function returns the length of the complete formatted string, which
+  is size or more when the string was truncated.
+ */
+int MRV_snprintf(char * p_buf, size_t size, const char * p_format, ...);
+
+/***************************************************************************//**
+  The MRV_vsnprintf() function is the version of MRV_snprintf() taking its
+  arguments as a va_list.
+ */
+int MRV_vsnprintf(char * p_buf, size_t size, const char * p_format, va_list args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MIV_RV32_FMT_H */
@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_string.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Word-optimized memory copy, fill and compare functions for Mi-V soft
+ * processors. See file "miv_rv32_string.h" for description of the functions
+ * implemented in this file.
+ *
+ */
+#include "miv_rv32_string.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Word type allowed to access buffers of any type.
+ */
+typedef uint32_t __attribute__((__may_alias__)) mrv_word_t;
+
+/*------------------------------------------------------------------------------
+ * Stop GCC from replacing the byte loops below with calls to memcpy() or
+ * memset(), which are these functions when MRV_STRING_REPLACE_LIBC is defined.
+ */
+#define MRV_STRING_FUNCTION \
+    __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+/***************************************************************************//**
+ * MRV_memcpy()
+ * See "miv_rv32_string.h" for details of how to use this function.
+ */
+MRV_STRING_FUNCTION
+void * MRV_memcpy(void * p_dest, const void * p_src, size_t n)
+{
+    uint8_t * p_d = (uint8_t *)p_dest;
+    const uint8_t * p_s = (const uint8_t *)p_src;
+
+    if (n >= MRV_STRING_SMALL_SIZE)
+    {
+        mrv_word_t * p_dw;
+        const mrv_word_t * p_sw;
+        uint32_t offset;
+
+        while (0u != ((uintptr_t)p_d & 3u))
+        {
+            *p_d++ = *p_s++;
+            n--;
+        }
+
+        p_dw = (mrv_word_t *)p_d;
+        offset = (uintptr_t)p_s & 3u;
+
+        if (0u == offset)
+        {
+            p_sw = (const mrv_word_t *)p_s;
+
+            while (n >= 32u)
+            {
+                p_dw[0] = p_sw[0];
+                p_dw[1] = p_sw[1];
+                p_dw[2] = p_sw[2];
+                p_dw[3] = p_sw[3];
+                p_dw[4] = p_sw[4];
+                p_dw[5] = p_sw[5];
+                p_dw[6] = p_sw[6];
+                p_dw[7] = p_sw[7];
+                p_dw += 8;
+                p_sw += 8;
+                n -= 32u;
+            }
+            while (n >= 4u)
+            {
+                *p_dw++ = *p_sw++;
+                n -= 4u;
+            }
+
+            p_s = (const uint8_t *)p_sw;
+        }
+        else
+        {
+            /*
+             * Each destination word is made of the last bytes of an aligned
+             * source word (low) and the first bytes of the next one (high).
+             */
+            uint32_t shift_low = offset * 8u;
+            uint32_t shift_high = 32u - shift_low;
+            uint32_t low;
+            uint32_t high;
+
+            p_sw = (const mrv_word_t *)(p_s - offset);
+            low = *p_sw++;
+
+            while (n >= 16u)
+            {
+                high = p_sw[0];
+                p_dw[0] = (low >> shift_low) | (high << shift_high);
+                low = p_sw[1];
+                p_dw[1] = (high >> shift_low) | (low << shift_high);
+                high = p_sw[2];
+                p_dw[2] = (low >> shift_low) | (high << shift_high);
+                low = p_sw[3];
+                p_dw[3] = (high >> shift_low) | (low << shift_high);
+                p_dw += 4;
+                p_sw += 4;
+                n -= 16u;
+            }
+            while (n >= 4u)
+            {
+                high = *p_sw++;
+                *p_dw++ = (low >> shift_low) | (high << shift_high);
+                low = high;
+                n -= 4u;
+            }
+
+            /* The next source byte is in the last word read, held in low. */
+            p_s = ((const uint8_t *)p_sw - 4u) + offset;
+        }
+
+        p_d = (uint8_t *)p_dw;
+    }
+
+    while (n > 0u)
+    {
+        *p_d++ = *p_s++;
+        n--;
+    }
+
+    return p_dest;
+}
+
+/***************************************************************************//**
+ * MRV_memset()
+ * See "miv_rv32_string.h" for details of how to use this function.
+ */
+MRV_STRING_FUNCTION
+void * MRV_memset(void * p_dest, int value, size_t n)
+{
+    uint8_t * p_d = (uint8_t *)p_dest;
+    uint8_t byte = (uint8_t)value;
+
+    if (n >= MRV_STRING_SMALL_SIZE)
+    {
+        uint32_t word = (uint32_t)byte * 0x01010101u;
+        mrv_word_t * p_dw;
+
+        while (0u != ((uintptr_t)p_d & 3u))
+        {
+            *p_d++ = byte;
+            n--;
+        }
+
+        p_dw = (mrv_word_t *)p_d;
+
+        while (n >= 32u)
+        {
+            p_dw[0] = word;
+            p_dw[1] = word;
+            p_dw[2] = word;
+            p_dw[3] = word;
+            p_dw[4] = word;
+            p_dw[5] = word;
+            p_dw[6] = word;
+            p_dw[7] = word;
+            p_dw += 8;
+            n -= 32u;
+        }
+        while (n >= 4u)
+        {
+            *p_dw++ = word;
+            n -= 4u;
+        }
+
+        p_d = (uint8_t *)p_dw;
+    }
+
+    while (n > 0u)
+    {
+        *p_d++ = byte;
+        n--;
+    }
+
+    return p_dest;
+}
+
+/***************************************************************************//**
+ * MRV_memcmp()
+ * See "miv_rv32_string.h" for details of how to use this function.
+ */
+MRV_STRING_FUNCTION
+int MRV_memcmp(const void * p_buf1, const void * p_buf2, size_t n)
+{
+    const uint8_t * p_1 = (const uint8_t *)p_buf1;
+    const uint8_t * p_2 = (const uint8_t *)p_buf2;
+
+    if ((n >= MRV_STRING_SMALL_SIZE) &&
+        (0u == (((uintptr_t)p_1 ^ (uintptr_t)p_2) & 3u)))
+    {
+        while (0u != ((uintptr_t)p_1 & 3u))
+        {
+            if (*p_1 != *p_2)
+            {
+                return (int)*p_1 - (int)*p_2;
+            }
+            p_1++;
+            p_2++;
+            n--;
+        }
+
+        /* The byte loop below locates the difference in a mismatching word. */
+        while ((n >= 4u) &&
+               (*(const mrv_word_t *)p_1 == *(const mrv_word_t *)p_2))
+        {
+            p_1 += 4;
+            p_2 += 4;
+            n -= 4u;
+        }
+    }
+
+    while (n > 0u)
+    {
+        if (*p_1 != *p_2)
+        {
+            return (int)*p_1 - (int)*p_2;
+        }
+        p_1++;
+        p_2++;
+        n--;
+    }
+
+    return 0;
+}
+
+#ifdef MRV_STRING_REPLACE_LIBC
+void * memcpy(void * p_dest, const void * p_src, size_t n)
+    __attribute__((alias("MRV_memcpy")));
+void * memset(void * p_dest, int value, size_t n)
+    __attribute__((alias("MRV_memset")));
+int memcmp(const void * p_buf1, const void * p_buf2, size_t n)
+    __attribute__((alias("MRV_memcmp")));
+#endif
+
+#ifdef __cplusplus
+}
+#endif
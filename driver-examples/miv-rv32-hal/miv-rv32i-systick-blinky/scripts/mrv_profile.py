@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+#
+# SPDX-License-Identifier: MIT
+#
+# Symbolizes the output of the MIV_RV32 HAL PC-sampling profiler
+# (MRV_profile_dump()) against the ELF file of the application.
+#
+# Usage:
+#   python3 mrv_profile.py <application.elf> <uart_log.txt> [--top N] [--lines]
+#
+# The UART log may contain any other text. Only the lines between
+# MRV_PROFILE_BEGIN and MRV_PROFILE_END are used. When the log contains more
+# than one profile, the last one is used unless --all is given, in which case
+# all of them are accumulated.
+#
+
+import argparse
+import re
+import subprocess
+import sys
+from collections import defaultdict
+
+BEGIN_RE = re.compile(r"MRV_PROFILE_BEGIN\s+samples=(\d+)\s+dropped=(\d+)"
+                      r"\s+shift=(\d+)")
+SAMPLE_RE = re.compile(r"^\s*0x([0-9a-fA-F]+)\s+(\d+)\s*$")
+END_RE = re.compile(r"MRV_PROFILE_END")
+
+
+def parse_log(path, accumulate):
+    profiles = []
+    current = None
+
+    with open(path, "r", errors="replace") as log:
+        for line in log:
+            match = BEGIN_RE.search(line)
+            if match:
+                current = {"samples": int(match.group(1)),
+                           "dropped": int(match.group(2)),
+                           "counts": defaultdict(int)}
+                continue
+
+            if current is None:
+                continue
+
+            if END_RE.search(line):
+                profiles.append(current)
+                current = None
+                continue
+
+            match = SAMPLE_RE.match(line)
+            if match:
+                current["counts"][int(match.group(1), 16)] += \
+                    int(match.group(2))
+
+    if not profiles:
+        sys.exit("error: no complete MRV_PROFILE block found in " + path)
+
+    if not accumulate:
+        return profiles[-1]
+
+    merged = {"samples": 0, "dropped": 0, "counts": defaultdict(int)}
+    for profile in profiles:
+        merged["samples"] += profile["samples"]
+        merged["dropped"] += profile["dropped"]
+        for addr, count in profile["counts"].items():
+            merged["counts"][addr] += count
+    return merged
+
+
+def symbolize(addr2line, elf, addresses):
+    """Return {address: (function, file:line)} using a single addr2line run."""
+    request = "\n".join("0x%08x" % addr for addr in addresses) + "\n"
+    try:
+        result = subprocess.run([addr2line, "-f", "-C", "-e", elf],
+                                input=request, capture_output=True,
+                                text=True, check=True)
+    except FileNotFoundError:
+        sys.exit("error: %s not found, use --addr2line to select the "
+                 "toolchain addr2line" % addr2line)
+
+    lines = result.stdout.splitlines()
+    symbols = {}
+    for idx, addr in enumerate(addresses):
+        function = lines[2 * idx] if 2 * idx < len(lines) else "??"
+        location = lines[2 * idx + 1] if 2 * idx + 1 < len(lines) else "??:0"
+        symbols[addr] = (function, location)
+    return symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Symbolize MIV_RV32 HAL profiler output.")
+    parser.add_argument("elf", help="application ELF file")
+    parser.add_argument("log", help="captured UART output")
+    parser.add_argument("--addr2line", default="riscv64-unknown-elf-addr2line",
+                        help="addr2line executable of the RISC-V toolchain")
+    parser.add_argument("--top", type=int, default=20,
+                        help="number of entries to print (default 20)")
+    parser.add_argument("--lines", action="store_true",
+                        help="also print the hottest source lines")
+    parser.add_argument("--all", action="store_true",
+                        help="accumulate all profiles found in the log")
+    args = parser.parse_args()
+
+    profile = parse_log(args.log, args.all)
+    counts = profile["counts"]
+    total = sum(counts.values())
+    if total == 0:
+        sys.exit("error: the profile does not contain any samples")
+
+    symbols = symbolize(args.addr2line, args.elf, sorted(counts))
+
+    per_function = defaultdict(int)
+    per_line = defaultdict(int)
+    for addr, count in counts.items():
+        function, location = symbols[addr]
+        per_function[function] += count
+        per_line[(function, location)] += count
+
+    print("samples: %d  dropped: %d" % (profile["samples"],
+                                        profile["dropped"]))
+    print()
+    print("%8s %7s  %s" % ("samples", "percent", "function"))
+    for function, count in sorted(per_function.items(),
+                                  key=lambda item: item[1],
+                                  reverse=True)[:args.top]:
+        print("%8d %6.2f%%  %s" % (count, 100.0 * count / total, function))
+
+    if args.lines:
+        print()
+        print("%8s %7s  %s" % ("samples", "percent", "source line"))
+        for (function, location), count in sorted(per_line.items(),
+                                                  key=lambda item: item[1],
+                                                  reverse=True)[:args.top]:
+            print("%8d %6.2f%%  %s (%s)" % (count, 100.0 * count / total,
+                                            location, function))
+
+
+if __name__ == "__main__":
+    main()
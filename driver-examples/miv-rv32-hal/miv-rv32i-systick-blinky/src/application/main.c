@@ -12,6 +12,9 @@
 #include "miv_rv32_hal/miv_rv32_hal.h"
 #include "drivers/fpga_ip/CoreGPIO/core_gpio.h"
 #include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.h"
+#ifdef MIV_RV32_PROFILER
+#include "miv_rv32_hal/miv_rv32_profile.h"
+#endif
 
 const char * g_hello_msg =
 "\r\n******************************************************************************\r\n\n\
@@ -60,6 +63,16 @@ void SysTick_Handler(void)
     printf("\r\nInternal System Timer Interrupt Counter = %d", interrupt_counter);
 }
 
+#ifdef MIV_RV32_PROFILER
+/*-----------------------------------------------------------------------------
+ * Output function used by MRV_profile_dump().
+ */
+static void profile_write(const char * str)
+{
+    UART_polled_tx_string(&g_uart, (const uint8_t *)str);
+}
+#endif
+
 /*-------------------------------------------------------------------------//**
   main() function.
 */
@@ -106,6 +119,12 @@ int main(void)
 
     MRV_systick_config(SYS_CLK_FREQ);
 
+#ifdef MIV_RV32_PROFILER
+    /* Each system tick records the interrupted PC. Press 'p' in the terminal
+     * to print the samples collected so far. */
+    MRV_profile_start();
+#endif
+
     /**************************************************************************
     * Loop
     *************************************************************************/
@@ -115,6 +134,12 @@ int main(void)
 
         if (g_rx_size > 0u)
         {
+#ifdef MIV_RV32_PROFILER
+            if ('p' == g_rx_buff[0])
+            {
+                MRV_profile_dump(profile_write);
+            }
+#endif
             /* Echo the characters received from the terminal */
             UART_polled_tx_string(&g_uart, (const uint8_t *)g_rx_buff);
             g_rx_size = 0u;
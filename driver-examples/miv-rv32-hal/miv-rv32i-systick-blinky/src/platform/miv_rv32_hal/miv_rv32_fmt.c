@@ -0,0 +1,756 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_fmt.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Small formatted output functions for Mi-V soft processors. See file
+ * "miv_rv32_fmt.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_fmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ * Conversion flags.
+ */
+#define FMT_LEFT                        0x01u
+#define FMT_ZERO                        0x02u
+#define FMT_PLUS                        0x04u
+#define FMT_SPACE                       0x08u
+#define FMT_ALT                         0x10u
+#define FMT_UPPER                       0x20u
+
+/*------------------------------------------------------------------------------
+ * Length modifiers.
+ */
+#define FMT_LEN_INT                     0u
+#define FMT_LEN_CHAR                    1u
+#define FMT_LEN_SHORT                   2u
+#define FMT_LEN_LONG                    3u
+#define FMT_LEN_LLONG                   4u
+#define FMT_LEN_SIZE                    5u
+#define FMT_LEN_PTRDIFF                 6u
+
+/*------------------------------------------------------------------------------
+ * Enough digits for a 64 bit value in octal.
+ */
+#define FMT_MAX_DIGITS                  22u
+
+/*------------------------------------------------------------------------------
+ * Output state, on the stack of the caller of MRV_vfmt().
+ */
+typedef struct
+{
+    mrv_fmt_sink_t sink;
+    void * p_ctx;
+    uint32_t count;
+    uint32_t fill;
+    char buf[MRV_FMT_BUFFER_SIZE];
+} fmt_out_t;
+
+/*------------------------------------------------------------------------------
+ * Destination of MRV_vsnprintf().
+ */
+typedef struct
+{
+    char * p_buf;
+    size_t size;
+    size_t pos;
+} fmt_string_t;
+
+/*------------------------------------------------------------------------------
+ * Conversion specification.
+ */
+typedef struct
+{
+    uint32_t flags;
+    int32_t width;
+    int32_t precision;
+    uint32_t length;
+} fmt_spec_t;
+
+static const char g_lower_digits[] = "0123456789abcdef";
+static const char g_upper_digits[] = "0123456789ABCDEF";
+
+/*------------------------------------------------------------------------------
+ * Output functions.
+ */
+static void out_flush(fmt_out_t * p_out)
+{
+    if (p_out->fill > 0u)
+    {
+        p_out->sink(p_out->p_ctx, p_out->buf, p_out->fill);
+        p_out->fill = 0u;
+    }
+}
+
+static void out_char(fmt_out_t * p_out, char c)
+{
+    p_out->buf[p_out->fill] = c;
+    p_out->fill++;
+    p_out->count++;
+
+    if (MRV_FMT_BUFFER_SIZE == p_out->fill)
+    {
+        out_flush(p_out);
+    }
+}
+
+static void out_repeat(fmt_out_t * p_out, char c, int32_t count)
+{
+    while (count > 0)
+    {
+        out_char(p_out, c);
+        count--;
+    }
+}
+
+/*
+ * Strings longer than the buffer, such as most literal parts of the format,
+ * are passed to the sink directly.
+ */
+static void out_string(fmt_out_t * p_out, const char * p_str, uint32_t length)
+{
+    if (length >= MRV_FMT_BUFFER_SIZE)
+    {
+        out_flush(p_out);
+        p_out->sink(p_out->p_ctx, p_str, length);
+        p_out->count += length;
+    }
+    else
+    {
+        while (length > 0u)
+        {
+            out_char(p_out, *p_str);
+            p_str++;
+            length--;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Write the digits of value backwards, ending at p_end, and return their
+ * number. No digit is written for 0. Decimal values switch to 32 bit
+ * divisions as soon as they fit, so that a 32 bit argument never calls the
+ * 64 bit division of libgcc.
+ */
+static uint32_t
+fmt_digits
+(
+    uint64_t value,
+    uint32_t base,
+    const char * p_digits,
+    char * p_end
+)
+{
+    char * p_char = p_end;
+
+    if (10u == base)
+    {
+        uint32_t value32;
+
+        while (value > 0xFFFFFFFFu)
+        {
+            *--p_char = (char)('0' + (uint32_t)(value % 10u));
+            value /= 10u;
+        }
+
+        value32 = (uint32_t)value;
+        while (0u != value32)
+        {
+            *--p_char = (char)('0' + (value32 % 10u));
+            value32 /= 10u;
+        }
+    }
+    else
+    {
+        uint32_t shift = (16u == base) ? 4u : 3u;
+
+        while (0u != value)
+        {
+            *--p_char = p_digits[(uint32_t)value & (base - 1u)];
+            value >>= shift;
+        }
+    }
+
+    return (uint32_t)(p_end - p_char);
+}
+
+/*------------------------------------------------------------------------------
+ * Write a number: padding, sign or 0x prefix, leading zeros and digits. For
+ * the q conversion, a decimal point is inserted before the last precision
+ * digits.
+ */
+static void
+fmt_number
+(
+    fmt_out_t * p_out,
+    const fmt_spec_t * p_spec,
+    uint64_t magnitude,
+    uint8_t negative,
+    uint32_t base,
+    char conversion
+)
+{
+    char digits[FMT_MAX_DIGITS];
+    char prefix[2];
+    uint32_t nb_prefix = 0u;
+    uint32_t nb_digits;
+    uint32_t flags = p_spec->flags;
+    int32_t min_digits;
+    int32_t nb_zeros;
+    int32_t point_pos = -1;
+    int32_t pad;
+    int32_t idx;
+
+    nb_digits = fmt_digits(magnitude, base,
+                           (0u != (flags & FMT_UPPER)) ? g_upper_digits
+                                                       : g_lower_digits,
+                           &digits[FMT_MAX_DIGITS]);
+
+    if ('q' == conversion)
+    {
+        int32_t fraction = (p_spec->precision < 0) ? 0 : p_spec->precision;
+
+        min_digits = fraction + 1;
+        if (fraction > 0)
+        {
+            point_pos = fraction;
+        }
+    }
+    else if (p_spec->precision < 0)
+    {
+        min_digits = 1;
+    }
+    else
+    {
+        /* An explicit precision disables zero padding. */
+        min_digits = p_spec->precision;
+        flags &= ~FMT_ZERO;
+    }
+
+    if (negative)
+    {
+        prefix[nb_prefix++] = '-';
+    }
+    else if ((0u != (flags & FMT_PLUS)) && (10u == base) && ('u' != conversion))
+    {
+        prefix[nb_prefix++] = '+';
+    }
+    else if ((0u != (flags & FMT_SPACE)) && (10u == base) && ('u' != conversion))
+    {
+        prefix[nb_prefix++] = ' ';
+    }
+    else if ((16u == base) && (0u != (flags & FMT_ALT)) &&
+             ((0u != magnitude) || ('p' == conversion)))
+    {
+        prefix[nb_prefix++] = '0';
+        prefix[nb_prefix++] = (0u != (flags & FMT_UPPER)) ? 'X' : 'x';
+    }
+    else if ((8u == base) && (0u != (flags & FMT_ALT)) &&
+             ((int32_t)nb_digits >= min_digits))
+    {
+        min_digits = (int32_t)nb_digits + 1;
+    }
+
+    nb_zeros = min_digits - (int32_t)nb_digits;
+    if (nb_zeros < 0)
+    {
+        nb_zeros = 0;
+    }
+
+    pad = p_spec->width - (int32_t)nb_prefix - nb_zeros - (int32_t)nb_digits;
+    if (point_pos >= 0)
+    {
+        pad--;
+    }
+
+    if (0u == (flags & (FMT_LEFT | FMT_ZERO)))
+    {
+        out_repeat(p_out, ' ', pad);
+    }
+
+    out_string(p_out, prefix, nb_prefix);
+
+    if (FMT_ZERO == (flags & (FMT_LEFT | FMT_ZERO)))
+    {
+        out_repeat(p_out, '0', pad);
+    }
+
+    /* idx counts the digits left to write, including the leading zeros. */
+    for (idx = nb_zeros + (int32_t)nb_digits; idx > 0; idx--)
+    {
+        if (idx == point_pos)
+        {
+            out_char(p_out, '.');
+        }
+        if (idx > (int32_t)nb_digits)
+        {
+            out_char(p_out, '0');
+        }
+        else
+        {
+            out_char(p_out, digits[FMT_MAX_DIGITS - (uint32_t)idx]);
+        }
+    }
+
+    if (0u != (flags & FMT_LEFT))
+    {
+        out_repeat(p_out, ' ', pad);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Write a string or a character with its padding.
+ */
+static void
+fmt_text
+(
+    fmt_out_t * p_out,
+    const fmt_spec_t * p_spec,
+    const char * p_str,
+    uint32_t length
+)
+{
+    int32_t pad = p_spec->width - (int32_t)length;
+
+    if (0u == (p_spec->flags & FMT_LEFT))
+    {
+        out_repeat(p_out, ' ', pad);
+    }
+
+    out_string(p_out, p_str, length);
+
+    if (0u != (p_spec->flags & FMT_LEFT))
+    {
+        out_repeat(p_out, ' ', pad);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ * Read an integer argument of the size given by the length modifier.
+ */
+static int64_t fmt_signed_arg(va_list * p_args, uint32_t length)
+{
+    int64_t value;
+
+    switch (length)
+    {
+        case FMT_LEN_CHAR:
+            value = (signed char)va_arg(*p_args, int);
+            break;
+
+        case FMT_LEN_SHORT:
+            value = (short)va_arg(*p_args, int);
+            break;
+
+        case FMT_LEN_LONG:
+            value = va_arg(*p_args, long);
+            break;
+
+        case FMT_LEN_LLONG:
+            value = va_arg(*p_args, long long);
+            break;
+
+        case FMT_LEN_SIZE:
+        case FMT_LEN_PTRDIFF:
+            value = va_arg(*p_args, ptrdiff_t);
+            break;
+
+        default:
+            value = va_arg(*p_args, int);
+            break;
+    }
+
+    return value;
+}
+
+static uint64_t fmt_unsigned_arg(va_list * p_args, uint32_t length)
+{
+    uint64_t value;
+
+    switch (length)
+    {
+        case FMT_LEN_CHAR:
+            value = (unsigned char)va_arg(*p_args, unsigned int);
+            break;
+
+        case FMT_LEN_SHORT:
+            value = (unsigned short)va_arg(*p_args, unsigned int);
+            break;
+
+        case FMT_LEN_LONG:
+            value = va_arg(*p_args, unsigned long);
+            break;
+
+        case FMT_LEN_LLONG:
+            value = va_arg(*p_args, unsigned long long);
+            break;
+
+        case FMT_LEN_SIZE:
+        case FMT_LEN_PTRDIFF:
+            value = va_arg(*p_args, size_t);
+            break;
+
+        default:
+            value = va_arg(*p_args, unsigned int);
+            break;
+    }
+
+    return value;
+}
+
+/*------------------------------------------------------------------------------
+ * Parse the flags, width, precision and length modifier following a '%'.
+ * Returns a pointer to the conversion character.
+ */
+static const char *
+fmt_parse_spec
+(
+    const char * p_format,
+    va_list * p_args,
+    fmt_spec_t * p_spec
+)
+{
+    uint8_t more_flags = 1u;
+
+    p_spec->flags = 0u;
+    p_spec->width = 0;
+    p_spec->precision = -1;
+    p_spec->length = FMT_LEN_INT;
+
+    while (more_flags)
+    {
+        switch (*p_format)
+        {
+            case '-':
+                p_spec->flags |= FMT_LEFT;
+                break;
+
+            case '0':
+                p_spec->flags |= FMT_ZERO;
+                break;
+
+            case '+':
+                p_spec->flags |= FMT_PLUS;
+                break;
+
+            case ' ':
+                p_spec->flags |= FMT_SPACE;
+                break;
+
+            case '#':
+                p_spec->flags |= FMT_ALT;
+                break;
+
+            default:
+                more_flags = 0u;
+                break;
+        }
+
+        if (more_flags)
+        {
+            p_format++;
+        }
+    }
+
+    if ('*' == *p_format)
+    {
+        p_spec->width = va_arg(*p_args, int);
+        if (p_spec->width < 0)
+        {
+            p_spec->flags |= FMT_LEFT;
+            p_spec->width = -p_spec->width;
+        }
+        p_format++;
+    }
+    else
+    {
+        while ((*p_format >= '0') && (*p_format <= '9'))
+        {
+            p_spec->width = (p_spec->width * 10) + (*p_format - '0');
+            p_format++;
+        }
+    }
+
+    if ('.' == *p_format)
+    {
+        p_format++;
+        p_spec->precision = 0;
+
+        if ('*' == *p_format)
+        {
+            p_spec->precision = va_arg(*p_args, int);
+            if (p_spec->precision < 0)
+            {
+                p_spec->precision = -1;
+            }
+            p_format++;
+        }
+        else
+        {
+            while ((*p_format >= '0') && (*p_format <= '9'))
+            {
+                p_spec->precision = (p_spec->precision * 10) + (*p_format - '0');
+                p_format++;
+            }
+        }
+    }
+
+    switch (*p_format)
+    {
+        case 'h':
+            p_format++;
+            p_spec->length = FMT_LEN_SHORT;
+            if ('h' == *p_format)
+            {
+                p_format++;
+                p_spec->length = FMT_LEN_CHAR;
+            }
+            break;
+
+        case 'l':
+            p_format++;
+            p_spec->length = FMT_LEN_LONG;
+            if ('l' == *p_format)
+            {
+                p_format++;
+                p_spec->length = FMT_LEN_LLONG;
+            }
+            break;
+
+        case 'j':
+            p_format++;
+            p_spec->length = FMT_LEN_LLONG;
+            break;
+
+        case 'z':
+            p_format++;
+            p_spec->length = FMT_LEN_SIZE;
+            break;
+
+        case 't':
+            p_format++;
+            p_spec->length = FMT_LEN_PTRDIFF;
+            break;
+
+        default:
+            break;
+    }
+
+    return p_format;
+}
+
+/***************************************************************************//**
+ * MRV_vfmt()
+ * See "miv_rv32_fmt.h" for details of how to use this function.
+ */
+int MRV_vfmt(mrv_fmt_sink_t sink,
+             void * p_ctx,
+             const char * p_format,
+             va_list args)
+{
+    fmt_out_t out;
+    va_list ap;
+
+    out.sink = sink;
+    out.p_ctx = p_ctx;
+    out.count = 0u;
+    out.fill = 0u;
+
+    /* A copy, so that the arguments can be read through a pointer. */
+    va_copy(ap, args);
+
+    while (0 != *p_format)
+    {
+        const char * p_start = p_format;
+        const char * p_percent;
+        fmt_spec_t spec;
+        int64_t value;
+        char conversion;
+
+        while ((0 != *p_format) && ('%' != *p_format))
+        {
+            p_format++;
+        }
+        out_string(&out, p_start, (uint32_t)(p_format - p_start));
+
+        if (0 == *p_format)
+        {
+            break;
+        }
+
+        p_percent = p_format;
+        p_format = fmt_parse_spec(p_format + 1, &ap, &spec);
+        conversion = *p_format;
+
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+            case 'q':
+                value = fmt_signed_arg(&ap, spec.length);
+                fmt_number(&out, &spec,
+                           (value < 0) ? (0u - (uint64_t)value) : (uint64_t)value,
+                           (value < 0) ? 1u : 0u, 10u, conversion);
+                break;
+
+            case 'u':
+                fmt_number(&out, &spec, fmt_unsigned_arg(&ap, spec.length),
+                           0u, 10u, conversion);
+                break;
+
+            case 'X':
+                spec.flags |= FMT_UPPER;
+                fmt_number(&out, &spec, fmt_unsigned_arg(&ap, spec.length),
+                           0u, 16u, conversion);
+                break;
+
+            case 'x':
+                fmt_number(&out, &spec, fmt_unsigned_arg(&ap, spec.length),
+                           0u, 16u, conversion);
+                break;
+
+            case 'o':
+                fmt_number(&out, &spec, fmt_unsigned_arg(&ap, spec.length),
+                           0u, 8u, conversion);
+                break;
+
+            case 'p':
+                spec.flags = (spec.flags & FMT_LEFT) | FMT_ALT;
+                spec.precision = (int32_t)(2u * sizeof(void *));
+                fmt_number(&out, &spec,
+                           (uintptr_t)va_arg(ap, void *), 0u, 16u, conversion);
+                break;
+
+            case 'c':
+            {
+                char c = (char)va_arg(ap, int);
+
+                fmt_text(&out, &spec, &c, 1u);
+                break;
+            }
+
+            case 's':
+            {
+                const char * p_str = va_arg(ap, const char *);
+                uint32_t length = 0u;
+
+                if (0 == p_str)
+                {
+                    p_str = "(null)";
+                }
+                while ((0 != p_str[length]) &&
+                       ((spec.precision < 0) ||
+                        (length < (uint32_t)spec.precision)))
+                {
+                    length++;
+                }
+                fmt_text(&out, &spec, p_str, length);
+                break;
+            }
+
+            case '%':
+                out_char(&out, '%');
+                break;
+
+            default:
+                /* Unsupported conversion: copied as it is. */
+                out_string(&out, p_percent,
+                           (uint32_t)(p_format - p_percent) +
+                           ((0 != conversion) ? 1u : 0u));
+                break;
+        }
+
+        if (0 != conversion)
+        {
+            p_format++;
+        }
+    }
+
+    va_end(ap);
+    out_flush(&out);
+
+    return (int)out.count;
+}
+
+/***************************************************************************//**
+ * MRV_fmt()
+ * See "miv_rv32_fmt.h" for details of how to use this function.
+ */
+int MRV_fmt(mrv_fmt_sink_t sink, void * p_ctx, const char * p_format, ...)
+{
+    va_list args;
+    int count;
+
+    va_start(args, p_format);
+    count = MRV_vfmt(sink, p_ctx, p_format, args);
+    va_end(args);
+
+    return count;
+}
+
+/*------------------------------------------------------------------------------
+ * Sink of MRV_vsnprintf(), keeping room for the terminating NUL character.
+ */
+static void string_sink(void * p_ctx, const char * p_buf, uint32_t length)
+{
+    fmt_string_t * p_string = (fmt_string_t *)p_ctx;
+
+    while ((length > 0u) && ((p_string->pos + 1u) < p_string->size))
+    {
+        p_string->p_buf[p_string->pos] = *p_buf;
+        p_string->pos++;
+        p_buf++;
+        length--;
+    }
+}
+
+/***************************************************************************//**
+ * MRV_vsnprintf()
+ * See "miv_rv32_fmt.h" for details of how to use this function.
+ */
+int MRV_vsnprintf(char * p_buf, size_t size, const char * p_format, va_list args)
+{
+    fmt_string_t string;
+    int count;
+
+    string.p_buf = p_buf;
+    string.size = size;
+    string.pos = 0u;
+
+    count = MRV_vfmt(string_sink, &string, p_format, args);
+
+    if (size > 0u)
+    {
+        p_buf[string.pos] = 0;
+    }
+
+    return count;
+}
+
+/***************************************************************************//**
+ * MRV_snprintf()
+ * See "miv_rv32_fmt.h" for details of how to use this function.
+ */
+int MRV_snprintf(char * p_buf, size_t size, const char * p_format, ...)
+{
+    va_list args;
+    int count;
+
+    va_start(args, p_format);
+    count = MRV_vsnprintf(p_buf, size, p_format, args);
+    va_end(args);
+
+    return count;
+}
+
+#ifdef __cplusplus
+}
+#endif
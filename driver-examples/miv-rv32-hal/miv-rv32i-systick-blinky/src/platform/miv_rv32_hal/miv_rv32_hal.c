@@ -10,6 +10,9 @@
  */
 #include <unistd.h>
 #include "miv_rv32_hal.h"
+#ifdef MIV_RV32_PROFILER
+#include "miv_rv32_profile.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -222,6 +225,11 @@ void handle_m_timer_interrupt(void)
 
     WRITE_MTIMECMP(g_systick_cmp_value);
 
+#ifdef MIV_RV32_PROFILER
+    /* mepc holds the address of the code interrupted by this tick. */
+    MRV_profile_sample(read_csr(mepc));
+#endif
+
     SysTick_Handler();
 
     set_csr(mie, MIP_MTIP);
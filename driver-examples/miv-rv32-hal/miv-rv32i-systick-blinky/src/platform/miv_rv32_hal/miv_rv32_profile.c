@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file miv_rv32_profile.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Statistical PC-sampling profiler for Mi-V soft processors. See file
+ * "miv_rv32_profile.h" for description of the functions implemented in this
+ * file.
+ *
+ */
+#include "miv_rv32_profile.h"
+#include "miv_rv32_fmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROFILE_TABLE_MASK              (MRV_PROFILE_TABLE_SIZE - 1u)
+#define PROFILE_LINE_SIZE               64u
+
+typedef struct
+{
+    uintptr_t pc;
+    uint32_t  count;
+} mrv_profile_entry_t;
+
+static mrv_profile_entry_t g_profile_table[MRV_PROFILE_TABLE_SIZE];
+static volatile uint8_t g_profile_running = 0u;
+static volatile uint32_t g_profile_samples = 0u;
+static volatile uint32_t g_profile_dropped = 0u;
+
+/***************************************************************************//**
+ * MRV_profile_start()
+ * See "miv_rv32_profile.h" for details of how to use this function.
+ */
+void MRV_profile_start(void)
+{
+    uint32_t idx;
+
+    g_profile_running = 0u;
+
+    for (idx = 0u; idx < MRV_PROFILE_TABLE_SIZE; idx++)
+    {
+        g_profile_table[idx].pc = 0u;
+        g_profile_table[idx].count = 0u;
+    }
+    g_profile_samples = 0u;
+    g_profile_dropped = 0u;
+
+    g_profile_running = 1u;
+}
+
+/***************************************************************************//**
+ * MRV_profile_stop()
+ * See "miv_rv32_profile.h" for details of how to use this function.
+ */
+void MRV_profile_stop(void)
+{
+    g_profile_running = 0u;
+}
+
+/***************************************************************************//**
+ * MRV_profile_sample()
+ * See "miv_rv32_profile.h" for details of how to use this function.
+ */
+void MRV_profile_sample(uintptr_t pc)
+{
+    uintptr_t key;
+    uint32_t idx;
+    uint32_t probe;
+
+    if (0u == g_profile_running)
+    {
+        return;
+    }
+
+    key = pc >> MRV_PROFILE_PC_SHIFT;
+    idx = (uint32_t)(key ^ (key >> 9u)) & PROFILE_TABLE_MASK;
+
+    for (probe = 0u; probe < MRV_PROFILE_MAX_PROBE; probe++)
+    {
+        mrv_profile_entry_t * p_entry = &g_profile_table[idx];
+
+        if (0u == p_entry->count)
+        {
+            p_entry->pc = key;
+            p_entry->count = 1u;
+            g_profile_samples++;
+            return;
+        }
+
+        if (key == p_entry->pc)
+        {
+            p_entry->count++;
+            g_profile_samples++;
+            return;
+        }
+
+        idx = (idx + 1u) & PROFILE_TABLE_MASK;
+    }
+
+    g_profile_dropped++;
+}
+
+/***************************************************************************//**
+ * MRV_profile_dump()
+ * See "miv_rv32_profile.h" for details of how to use this function.
+ */
+void MRV_profile_dump(mrv_profile_write_t write_fn)
+{
+    char line[PROFILE_LINE_SIZE];
+    uint8_t was_running = g_profile_running;
+    uint32_t idx;
+
+    if (0 == write_fn)
+    {
+        return;
+    }
+
+    g_profile_running = 0u;
+
+    (void)MRV_snprintf(line, sizeof(line),
+                       "MRV_PROFILE_BEGIN samples=%u dropped=%u shift=%u\r\n",
+                       g_profile_samples, g_profile_dropped,
+                       (uint32_t)MRV_PROFILE_PC_SHIFT);
+    write_fn(line);
+
+    for (idx = 0u; idx < MRV_PROFILE_TABLE_SIZE; idx++)
+    {
+        if (0u != g_profile_table[idx].count)
+        {
+            (void)MRV_snprintf(line, sizeof(line), "0x%08x %u\r\n",
+                               (uint32_t)(g_profile_table[idx].pc <<
+                                          MRV_PROFILE_PC_SHIFT),
+                               g_profile_table[idx].count);
+            write_fn(line);
+        }
+    }
+
+    write_fn("MRV_PROFILE_END\r\n");
+
+    g_profile_running = was_running;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+#
+# SPDX-License-Identifier: MIT
+#
+# Generates the C++ register and field types used with src/platform/hal/
+# hal_reg.hpp from the C register definitions of a driver.
+#
+# Usage:
+#   python3 gen_regs_hpp.py <driver>_regs.h [...]
+#
+# For each xxx_regs.h file, xxx_regs.hpp is written next to it. It declares
+# hal::xxx::regs<Base, T>, where Base is the base address of the peripheral
+# and T the type of its registers, which depends on the APB data width the
+# peripheral was configured with:
+#   - each NAME_REG_OFFSET definition becomes a register type NAME_REG
+#   - each NAME_OFFSET/NAME_MASK/NAME_SHIFT triplet becomes a field type NAME
+#     of the register located at the same offset
+#
+# The generated types refer to the C definitions by name, so the generated
+# file only has to be regenerated when registers or fields are added or
+# removed.
+#
+
+import os
+import re
+import sys
+
+DEFINE_RE = re.compile(r"^\s*#define\s+(\w+)\s+\(?\s*(0x[0-9a-fA-F]+|\d+)"
+                       r"[uUlL]*\s*\)?\s*(?:/[*/].*)?$")
+
+
+def read_defines(path):
+    defines = {}
+    with open(path, "r", errors="replace") as header:
+        for line in header:
+            match = DEFINE_RE.match(line)
+            if match:
+                defines[match.group(1)] = int(match.group(2), 0)
+    return defines
+
+
+def find_register(field, offset, registers):
+    """Return the register holding a field: the register at the same offset
+    whose name is the longest prefix of the field name, or the first register
+    defined at that offset."""
+    candidates = [name for name, reg_offset in registers if reg_offset == offset]
+    if not candidates:
+        return None
+    prefixed = [name for name in candidates if field.startswith(name)]
+    if prefixed:
+        return max(prefixed, key=len)
+    return candidates[0]
+
+
+def generate(path):
+    defines = read_defines(path)
+    header_name = os.path.basename(path)
+    stem = os.path.splitext(header_name)[0]
+    namespace = re.sub(r"_regs$", "", stem).lower()
+    guard = stem.upper() + "_HPP"
+
+    registers = [(name[:-len("_REG_OFFSET")], value)
+                 for name, value in defines.items()
+                 if name.endswith("_REG_OFFSET")]
+
+    fields = []
+    skipped = []
+    for name, offset in defines.items():
+        if not name.endswith("_OFFSET") or name.endswith("_REG_OFFSET"):
+            continue
+        base = name[:-len("_OFFSET")]
+        if (base + "_MASK") not in defines or (base + "_SHIFT") not in defines:
+            continue
+        register = find_register(base, offset, registers)
+        if register is None:
+            skipped.append(base)
+        else:
+            fields.append((base, register))
+
+    lines = []
+    lines.append("/*" + "*" * 78 + "\n")
+    lines.append(" * Copyright 2025 Microchip FPGA Embedded Systems Solutions.\n")
+    lines.append(" *\n")
+    lines.append(" * SPDX-License-Identifier: MIT\n")
+    lines.append(" *\n")
+    lines.append(" * Generated by scripts/gen_regs_hpp.py from %s.\n" % header_name)
+    lines.append(" * Do not edit, regenerate when the C register definitions change.\n")
+    lines.append(" */\n")
+    lines.append("#ifndef %s\n" % guard)
+    lines.append("#define %s\n\n" % guard)
+    lines.append("#include \"hal/hal_reg.hpp\"\n")
+    lines.append("#include \"%s\"\n\n" % header_name)
+    lines.append("namespace hal\n{\nnamespace %s\n{\n\n" % namespace)
+    lines.append("template <uintptr_t Base, typename T = uint32_t>\n")
+    lines.append("struct regs\n{\n")
+
+    for name, _offset in registers:
+        lines.append("    using %s_REG = reg<T, Base + %s_REG_OFFSET>;\n"
+                     % (name, name))
+
+    if fields:
+        lines.append("\n")
+    for name, register in fields:
+        lines.append("    using %s = field<%s_REG, %s_SHIFT, %s_MASK>;\n"
+                     % (name, register, name, name))
+
+    lines.append("};\n\n")
+    lines.append("} /* namespace %s */\n} /* namespace hal */\n\n" % namespace)
+    lines.append("#endif /* %s */\n" % guard)
+
+    output = os.path.join(os.path.dirname(path), stem + ".hpp")
+    with open(output, "w") as hpp:
+        hpp.writelines(lines)
+
+    print("%s: %d registers, %d fields" % (output, len(registers), len(fields)))
+    for name in skipped:
+        print("  warning: no register at the offset of field %s" % name)
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit("usage: %s <driver>_regs.h [...]" % sys.argv[0])
+    for path in sys.argv[1:]:
+        generate(path)
+
+
+if __name__ == "__main__":
+    main()
@@ -30,9 +30,23 @@
 #include "raytracer.hpp"
 #endif
 
+/***************************************************************************//**
+ * Define DEMO_REGISTER_BENCHMARK in the project settings to print the cost of
+ * the C HAL register accesses and of the C++ register templates before the
+ * demo starts.
+*/
+
+#ifdef DEMO_REGISTER_BENCHMARK
+#include "reg_benchmark.hpp"
+#endif
+
 int main()
 {
 
+#ifdef DEMO_REGISTER_BENCHMARK
+  demoRegisterBenchmark();
+#endif
+
 #ifdef DEMO_MANDELBROT
   demoMandelbrot();
 #else
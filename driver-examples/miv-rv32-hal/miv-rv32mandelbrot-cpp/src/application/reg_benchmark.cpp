@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file reg_benchmark.cpp
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Compares the cost of the C HAL register access macros with the C++
+ * register templates
+ *
+ * The same CoreUARTapb registers are accessed BENCHMARK_LOOPS times through
+ * the hal.h macros, which call the HW_xxx functions of hw_reg_access.S, and
+ * through hal::core_uart_apb, which inlines the accesses. The fields are
+ * written back with their current value so the UART configuration does not
+ * change. The average number of mcycle cycles per access is printed.
+ *
+ */
+
+#include <stdio.h>
+#include "hal/hal.h"
+#include "miv_rv32_hal/miv_rv32_hal.h"
+#include "drivers/fpga_ip/CoreUARTapb/core_uart_apb.hpp"
+#include "reg_benchmark.hpp"
+
+#ifndef BENCHMARK_LOOPS
+#define BENCHMARK_LOOPS 1000u
+#endif
+
+using uart = hal::core_uart_apb<COREUARTAPB0_BASE_ADDR>;
+
+static volatile uint32_t sink;
+
+static inline uint32_t cycles()
+{
+  return read_csr(mcycle);
+}
+
+static void printResult(const char *name, uint32_t cCycles, uint32_t cppCycles)
+{
+  printf("%-26s %8u %8u\r\n", name,
+         (unsigned)(cCycles / BENCHMARK_LOOPS),
+         (unsigned)(cppCycles / BENCHMARK_LOOPS));
+}
+
+void demoRegisterBenchmark(void)
+{
+  const uint8_t parity = HAL_get_8bit_reg_field(COREUARTAPB0_BASE_ADDR, CTRL2_PARITY_EN);
+  const uint8_t baud = HAL_get_8bit_reg(COREUARTAPB0_BASE_ADDR, CTRL1);
+  uint32_t start;
+  uint32_t cCycles;
+  uint32_t cppCycles;
+  uint32_t sum;
+
+  printf("\r\nRegister access cost, cycles per access (%u loops)\r\n", (unsigned)BENCHMARK_LOOPS);
+  printf("%-26s %8s %8s\r\n", "access", "C HAL", "C++");
+
+  // Register write
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    HAL_set_8bit_reg(COREUARTAPB0_BASE_ADDR, CTRL1, baud);
+  }
+  cCycles = cycles() - start;
+
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    uart::regs::CTRL1_REG::write(baud);
+  }
+  cppCycles = cycles() - start;
+  printResult("register write", cCycles, cppCycles);
+
+  // Field read
+  sum = 0;
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    sum += HAL_get_8bit_reg_field(COREUARTAPB0_BASE_ADDR, STATUS_TXRDY);
+  }
+  cCycles = cycles() - start;
+
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    sum += uart::regs::STATUS_TXRDY::read();
+  }
+  cppCycles = cycles() - start;
+  sink = sum;
+  printResult("field read", cCycles, cppCycles);
+
+  // Field read-modify-write
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    HAL_set_8bit_reg_field(COREUARTAPB0_BASE_ADDR, CTRL2_PARITY_EN, parity);
+  }
+  cCycles = cycles() - start;
+
+  start = cycles();
+  for (uint32_t i = 0; i < BENCHMARK_LOOPS; i++)
+  {
+    uart::regs::CTRL2_PARITY_EN::write(parity);
+  }
+  cppCycles = cycles() - start;
+  printResult("field read-modify-write", cCycles, cppCycles);
+}
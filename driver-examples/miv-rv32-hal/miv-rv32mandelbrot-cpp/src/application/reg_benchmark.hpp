@@ -0,0 +1,20 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file reg_benchmark.hpp
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Compares the cost of the C HAL register access macros with the C++
+ * register templates
+ *
+ */
+
+#ifndef SRC_APPLICATION_REG_BENCHMARK_HPP_
+#define SRC_APPLICATION_REG_BENCHMARK_HPP_
+
+
+extern void demoRegisterBenchmark(void);
+
+
+#endif /* SRC_APPLICATION_REG_BENCHMARK_HPP_ */
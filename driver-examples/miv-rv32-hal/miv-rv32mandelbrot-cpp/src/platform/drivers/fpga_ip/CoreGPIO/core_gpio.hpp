@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file core_gpio.hpp
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief C++ compile-time driver for CoreGPIO.
+ *
+ * hal::core_gpio<BASE_ADDR> provides the configuration and input/output
+ * operations of the C driver (core_gpio.h) for a CoreGPIO instance whose base
+ * address is known at compile time and which is connected to a 32 bit APB
+ * bus (GPIO_APB_32_BITS_BUS). Each operation is inlined into a few load and
+ * store instructions.
+ *
+ *     using leds = hal::core_gpio<COREGPIO_OUT_BASE_ADDR>;
+ *
+ *     leds::config<GPIO_0>(GPIO_OUTPUT_MODE);
+ *     leds::set_output<GPIO_0>(1u);
+ */
+#ifndef CORE_GPIO_HPP
+#define CORE_GPIO_HPP
+
+#include <stdint.h>
+#include "core_gpio.h"
+#include "coregpio_regs.hpp"
+
+namespace hal
+{
+
+template <uintptr_t Base>
+class core_gpio
+{
+public:
+    using regs = coregpio::regs<Base, uint32_t>;
+
+    /* One configuration register per GPIO, starting at the base address. */
+    template <unsigned Port>
+    using CONFIG_REG = reg<uint32_t, Base + (Port * 4u)>;
+
+    static constexpr unsigned nb_of_gpio = 32u;
+
+    template <unsigned Port>
+    static inline void config(uint32_t config)
+    {
+        static_assert(Port < nb_of_gpio, "invalid GPIO port");
+        CONFIG_REG<Port>::write(config);
+    }
+
+    static inline void set_outputs(uint32_t value)
+    {
+        regs::GPIO_OUT_REG::write(value);
+    }
+
+    static inline uint32_t get_outputs()
+    {
+        return regs::GPIO_OUT_REG::read();
+    }
+
+    static inline uint32_t get_inputs()
+    {
+        return regs::GPIO_IN_REG::read();
+    }
+
+    /***************************************************************************
+     * Set or clear one output with a single read-modify-write of the output
+     * register.
+     */
+    template <unsigned Port>
+    static inline void set_output(uint32_t value)
+    {
+        static_assert(Port < nb_of_gpio, "invalid GPIO port");
+        if (value != 0u)
+        {
+            regs::GPIO_OUT_REG::set_bits(1u << Port);
+        }
+        else
+        {
+            regs::GPIO_OUT_REG::clear_bits(1u << Port);
+        }
+    }
+
+    static inline void clear_irq(unsigned port)
+    {
+        regs::IRQ_REG::write(1u << port);
+    }
+};
+
+} /* namespace hal */
+
+#endif /* CORE_GPIO_HPP */
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Generated by scripts/gen_regs_hpp.py from coregpio_regs.h.
+ * Do not edit, regenerate when the C register definitions change.
+ */
+#ifndef COREGPIO_REGS_HPP
+#define COREGPIO_REGS_HPP
+
+#include "hal/hal_reg.hpp"
+#include "coregpio_regs.h"
+
+namespace hal
+{
+namespace coregpio
+{
+
+template <uintptr_t Base, typename T = uint32_t>
+struct regs
+{
+    using IRQ_REG = reg<T, Base + IRQ_REG_OFFSET>;
+    using IRQ0_REG = reg<T, Base + IRQ0_REG_OFFSET>;
+    using IRQ1_REG = reg<T, Base + IRQ1_REG_OFFSET>;
+    using IRQ2_REG = reg<T, Base + IRQ2_REG_OFFSET>;
+    using IRQ3_REG = reg<T, Base + IRQ3_REG_OFFSET>;
+    using GPIO_IN_REG = reg<T, Base + GPIO_IN_REG_OFFSET>;
+    using GPIO_IN0_REG = reg<T, Base + GPIO_IN0_REG_OFFSET>;
+    using GPIO_IN1_REG = reg<T, Base + GPIO_IN1_REG_OFFSET>;
+    using GPIO_IN2_REG = reg<T, Base + GPIO_IN2_REG_OFFSET>;
+    using GPIO_IN3_REG = reg<T, Base + GPIO_IN3_REG_OFFSET>;
+    using GPIO_OUT_REG = reg<T, Base + GPIO_OUT_REG_OFFSET>;
+    using GPIO_OUT0_REG = reg<T, Base + GPIO_OUT0_REG_OFFSET>;
+    using GPIO_OUT1_REG = reg<T, Base + GPIO_OUT1_REG_OFFSET>;
+    using GPIO_OUT2_REG = reg<T, Base + GPIO_OUT2_REG_OFFSET>;
+    using GPIO_OUT3_REG = reg<T, Base + GPIO_OUT3_REG_OFFSET>;
+};
+
+} /* namespace coregpio */
+} /* namespace hal */
+
+#endif /* COREGPIO_REGS_HPP */
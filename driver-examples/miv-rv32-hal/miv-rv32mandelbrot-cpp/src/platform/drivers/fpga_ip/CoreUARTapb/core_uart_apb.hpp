@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file core_uart_apb.hpp
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief C++ compile-time driver for CoreUARTapb.
+ *
+ * hal::core_uart_apb<BASE_ADDR> provides the polled operations of the C
+ * driver (core_uart_apb.h) for a CoreUARTapb instance whose base address is
+ * known at compile time. There is no instance structure: every register
+ * access is resolved to a constant address, so each operation is inlined into
+ * a few load and store instructions.
+ *
+ *     using uart = hal::core_uart_apb<COREUARTAPB0_BASE_ADDR>;
+ *
+ *     uart::init(BAUD_VALUE_115200, DATA_8_BITS | NO_PARITY);
+ *     uart::polled_tx_string("Hello\r\n");
+ *
+ * The C driver and this class can be used on the same instance.
+ */
+#ifndef CORE_UART_APB_HPP
+#define CORE_UART_APB_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "core_uart_apb.h"
+#include "coreuartapb_regs.hpp"
+
+namespace hal
+{
+
+template <uintptr_t Base>
+class core_uart_apb
+{
+public:
+    using regs = coreuartapb::regs<Base, uint8_t>;
+
+    /***************************************************************************
+     * Same as UART_init(): set the baud value and line configuration, then
+     * flush the receive data register.
+     */
+    static inline void init(uint16_t baud_value, uint8_t line_config)
+    {
+        regs::CTRL1_REG::write(static_cast<uint8_t>(baud_value));
+        regs::CTRL2_REG::write(static_cast<uint8_t>(
+            line_config |
+            regs::CTRL2_BAUDVALUE::value(static_cast<uint8_t>(baud_value >> 8u)).bits));
+
+        while (regs::STATUS_RXFULL::is_set())
+        {
+            (void)regs::RXDATA_REG::read();
+        }
+    }
+
+    static inline bool tx_ready()
+    {
+        return regs::STATUS_TXRDY::is_set();
+    }
+
+    static inline bool rx_ready()
+    {
+        return regs::STATUS_RXFULL::is_set();
+    }
+
+    /***************************************************************************
+     * Wait for the transmit data register to be free, then write one byte.
+     */
+    static inline void putc(uint8_t data)
+    {
+        while (!tx_ready())
+        {
+            ;
+        }
+        regs::TXDATA_REG::write(data);
+    }
+
+    static inline void polled_tx(const uint8_t * p_buffer, size_t size)
+    {
+        for (size_t idx = 0u; idx < size; ++idx)
+        {
+            putc(p_buffer[idx]);
+        }
+    }
+
+    static inline void polled_tx_string(const char * p_string)
+    {
+        while (*p_string != '\0')
+        {
+            putc(static_cast<uint8_t>(*p_string++));
+        }
+    }
+
+    /***************************************************************************
+     * Read one byte if one was received. Returns false when the receive data
+     * register is empty.
+     */
+    static inline bool getc(uint8_t & data)
+    {
+        if (!rx_ready())
+        {
+            return false;
+        }
+        data = regs::RXDATA_REG::read();
+        return true;
+    }
+
+    /***************************************************************************
+     * Error flags of the status register, as the UART_APB_PARITY_ERROR,
+     * UART_APB_OVERFLOW_ERROR and UART_APB_FRAMING_ERROR bits returned by
+     * UART_get_rx_status(). Unlike the C driver, which accumulates the flags
+     * seen by its receive functions, this reads the status register.
+     */
+    static inline uint8_t get_rx_status()
+    {
+        constexpr uint8_t error_mask =
+            STATUS_PARITYERR_MASK | STATUS_OVERFLOW_MASK | STATUS_FRAMERR_MASK;
+
+        return static_cast<uint8_t>((regs::STATUS_REG::read() & error_mask) >>
+                                    STATUS_PARITYERR_SHIFT);
+    }
+};
+
+} /* namespace hal */
+
+#endif /* CORE_UART_APB_HPP */
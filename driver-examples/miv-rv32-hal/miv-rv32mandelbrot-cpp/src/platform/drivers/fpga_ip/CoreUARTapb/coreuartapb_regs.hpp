@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Generated by scripts/gen_regs_hpp.py from coreuartapb_regs.h.
+ * Do not edit, regenerate when the C register definitions change.
+ */
+#ifndef COREUARTAPB_REGS_HPP
+#define COREUARTAPB_REGS_HPP
+
+#include "hal/hal_reg.hpp"
+#include "coreuartapb_regs.h"
+
+namespace hal
+{
+namespace coreuartapb
+{
+
+template <uintptr_t Base, typename T = uint32_t>
+struct regs
+{
+    using TXDATA_REG = reg<T, Base + TXDATA_REG_OFFSET>;
+    using RXDATA_REG = reg<T, Base + RXDATA_REG_OFFSET>;
+    using CTRL1_REG = reg<T, Base + CTRL1_REG_OFFSET>;
+    using CTRL2_REG = reg<T, Base + CTRL2_REG_OFFSET>;
+    using StatusReg_REG = reg<T, Base + StatusReg_REG_OFFSET>;
+    using STATUS_REG = reg<T, Base + STATUS_REG_OFFSET>;
+
+    using TXDATA = field<TXDATA_REG, TXDATA_SHIFT, TXDATA_MASK>;
+    using RXDATA = field<RXDATA_REG, RXDATA_SHIFT, RXDATA_MASK>;
+    using CTRL1_BAUDVALUE = field<CTRL1_REG, CTRL1_BAUDVALUE_SHIFT, CTRL1_BAUDVALUE_MASK>;
+    using CTRL2_BIT_LENGTH = field<CTRL2_REG, CTRL2_BIT_LENGTH_SHIFT, CTRL2_BIT_LENGTH_MASK>;
+    using CTRL2_PARITY_EN = field<CTRL2_REG, CTRL2_PARITY_EN_SHIFT, CTRL2_PARITY_EN_MASK>;
+    using CTRL2_ODD_EVEN = field<CTRL2_REG, CTRL2_ODD_EVEN_SHIFT, CTRL2_ODD_EVEN_MASK>;
+    using CTRL2_BAUDVALUE = field<CTRL2_REG, CTRL2_BAUDVALUE_SHIFT, CTRL2_BAUDVALUE_MASK>;
+    using STATUS_TXRDY = field<STATUS_REG, STATUS_TXRDY_SHIFT, STATUS_TXRDY_MASK>;
+    using STATUS_RXFULL = field<STATUS_REG, STATUS_RXFULL_SHIFT, STATUS_RXFULL_MASK>;
+    using STATUS_PARITYERR = field<STATUS_REG, STATUS_PARITYERR_SHIFT, STATUS_PARITYERR_MASK>;
+    using STATUS_OVERFLOW = field<STATUS_REG, STATUS_OVERFLOW_SHIFT, STATUS_OVERFLOW_MASK>;
+    using STATUS_FRAMERR = field<STATUS_REG, STATUS_FRAMERR_SHIFT, STATUS_FRAMERR_MASK>;
+};
+
+} /* namespace coreuartapb */
+} /* namespace hal */
+
+#endif /* COREUARTAPB_REGS_HPP */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright 2025 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file hal_reg.hpp
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief C++17 compile-time register and register field access templates.
+ *
+ * The C register access macros of hal.h build the address, shift and mask of
+ * a register field from the FIELD_OFFSET/FIELD_SHIFT/FIELD_MASK definitions
+ * of the *_regs.h files and pass them to the HW_xxx functions implemented in
+ * hw_reg_access.S, so every access costs a function call. The templates
+ * below carry the same information as template parameters: the base address,
+ * offset, shift and mask are constants in the generated code and a field
+ * read-modify-write compiles to a single load, and, or and store sequence.
+ *
+ * The register and field types of a peripheral are generated from its
+ * *_regs.h file by scripts/gen_regs_hpp.py, for example:
+ *
+ *     using uart = hal::coreuartapb::regs<COREUARTAPB0_BASE_ADDR, uint8_t>;
+ *
+ *     if (uart::STATUS_TXRDY::is_set())
+ *     {
+ *         uart::TXDATA_REG::write('A');
+ *     }
+ *     uart::CTRL2_PARITY_EN::write(1u);
+ *     uart::CTRL2_REG::modify(uart::CTRL2_PARITY_EN::value(1u),
+ *                             uart::CTRL2_ODD_EVEN::value(0u));
+ *
+ * modify() updates several fields of one register with a single read and a
+ * single write.
+ */
+#ifndef HAL_REG_HPP
+#define HAL_REG_HPP
+
+#include <stdint.h>
+#include <type_traits>
+
+namespace hal
+{
+
+/***************************************************************************//**
+ * Value of a register field shifted in place, together with the field mask.
+ * It is returned by field::value() and consumed by reg::modify().
+ */
+template <typename T>
+struct field_value
+{
+    T mask;
+    T bits;
+};
+
+/***************************************************************************//**
+ * Register of type T located at Address.
+ */
+template <typename T, uintptr_t Address>
+struct reg
+{
+    static_assert(std::is_unsigned<T>::value,
+                  "register type must be an unsigned integer");
+
+    using value_type = T;
+    static constexpr uintptr_t address = Address;
+
+    static inline value_type read()
+    {
+        return *reinterpret_cast<volatile value_type *>(address);
+    }
+
+    static inline void write(value_type value)
+    {
+        *reinterpret_cast<volatile value_type *>(address) = value;
+    }
+
+    static inline void set_bits(value_type mask)
+    {
+        write(static_cast<value_type>(read() | mask));
+    }
+
+    static inline void clear_bits(value_type mask)
+    {
+        write(static_cast<value_type>(read() & static_cast<value_type>(~mask)));
+    }
+
+    template <typename... Values>
+    static inline void modify(Values... values)
+    {
+        static_assert(sizeof...(Values) > 0u, "nothing to modify");
+
+        const value_type mask = static_cast<value_type>((values.mask | ...));
+        const value_type bits = static_cast<value_type>((values.bits | ...));
+
+        write(static_cast<value_type>((read() & static_cast<value_type>(~mask)) |
+                                      bits));
+    }
+};
+
+/***************************************************************************//**
+ * Field of register Reg, selected by Mask once shifted by Shift.
+ */
+template <typename Reg, unsigned Shift, typename Reg::value_type Mask>
+struct field
+{
+    using reg_type = Reg;
+    using value_type = typename Reg::value_type;
+
+    static constexpr unsigned shift = Shift;
+    static constexpr value_type mask = Mask;
+
+    static_assert(Mask != 0u, "empty field mask");
+    static_assert(((Mask >> Shift) << Shift) == Mask,
+                  "field mask has bits below the field shift");
+
+    static constexpr field_value<value_type> value(value_type value)
+    {
+        return field_value<value_type>{
+            mask, static_cast<value_type>((value << shift) & mask)};
+    }
+
+    static inline value_type read()
+    {
+        return static_cast<value_type>((Reg::read() & mask) >> shift);
+    }
+
+    static inline void write(value_type value)
+    {
+        Reg::modify(field::value(value));
+    }
+
+    static inline bool is_set()
+    {
+        return (Reg::read() & mask) != 0u;
+    }
+};
+
+} /* namespace hal */
+
+#endif /* HAL_REG_HPP */